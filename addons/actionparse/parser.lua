@@ -21,11 +21,18 @@
 
 require 'common';
 
-local breader = require 'bitreader';
+local breader  = require 'bitreader';
+local entities = require 'ffxi.entities';
 
 -- Action parser table..
 local parser = T{};
 
+-- Action packet field widths, in bits..
+local action_fields = T{ 32, 6, 4, 4, 32, 32, };
+local result_fields = T{ 3, 2, 12, 5, 5, 17, 10, 31, };
+local proc_fields   = T{ 6, 4, 17, 10, };
+local react_fields  = T{ 6, 4, 14, 10, };
+
 --[[
 * Locates and returns the name of the actor of the given server id.
 *
@@ -33,14 +40,7 @@ local parser = T{};
 * @return {string} The actor name.
 --]]
 local function get_actor_name(id)
-    local ret = 'Unknown';
-    for x = 0, 2302 do
-        local e = GetEntity(x);
-        if (e and e.ServerId == id) then
-            return e.Name;
-        end
-    end
-    return ret;
+    return entities.get_name(id) or 'Unknown';
 end
 
 --[[
@@ -50,18 +50,16 @@ end
 * @return {table} The parsed action packet.
 --]]
 parser.parse = function (packet)
-    local reader = breader:new();
-    reader:set_data(packet);
-    reader:set_pos(5);
+    local reader = breader:new(nil, packet, 5);
 
     local action        = T{};
-    action.m_uID        = reader:read(32);
+    action.m_uID,
+    action.trg_sum,
+    action.res_sum,
+    action.cmd_no,
+    action.cmd_arg,
+    action.info         = reader:read_fields(action_fields);
     action.caster_name  = get_actor_name(action.m_uID);
-    action.trg_sum      = reader:read(6);
-    action.res_sum      = reader:read(4);
-    action.cmd_no       = reader:read(4);
-    action.cmd_arg      = reader:read(32);
-    action.info         = reader:read(32);
     action.target       = T{};
 
     for _ = 0, action.trg_sum - 1 do
@@ -73,21 +71,21 @@ parser.parse = function (packet)
 
         for _ = 0, target.result_sum - 1 do
             local result    = T{};
-            result.miss     = reader:read(3);
-            result.kind     = reader:read(2);
-            result.sub_kind = reader:read(12);
-            result.info     = reader:read(5);
-            result.scale    = reader:read(5);
-            result.value    = reader:read(17);
-            result.message  = reader:read(10);
-            result.bit      = reader:read(31);
+            result.miss,
+            result.kind,
+            result.sub_kind,
+            result.info,
+            result.scale,
+            result.value,
+            result.message,
+            result.bit      = reader:read_fields(result_fields);
 
             if (reader:read(1) > 0) then
                 result.has_proc     = true;
-                result.proc_kind    = reader:read(6);
-                result.proc_info    = reader:read(4);
-                result.proc_value   = reader:read(17);
-                result.proc_message = reader:read(10);
+                result.proc_kind,
+                result.proc_info,
+                result.proc_value,
+                result.proc_message = reader:read_fields(proc_fields);
             else
                 result.has_proc     = false;
                 result.proc_kind    = 0;
@@ -98,10 +96,10 @@ parser.parse = function (packet)
 
             if (reader:read(1) > 0) then
                 result.has_react    = true;
-                result.react_kind   = reader:read(6);
-                result.react_info   = reader:read(4);
-                result.react_value  = reader:read(14);
-                result.react_message= reader:read(10);
+                result.react_kind,
+                result.react_info,
+                result.react_value,
+                result.react_message= reader:read_fields(react_fields);
             else
                 result.has_react    = false;
                 result.react_kind   = 0;
@@ -27,8 +27,9 @@ addon.link      = 'https://ashitaxi.com/';
 
 require 'common';
 
-local d3d8  = require 'd3d8';
-local imgui = require 'imgui';
+local d3d8           = require 'd3d8';
+local entitysnapshot = require 'ffxi.entitysnapshot';
+local imgui          = require 'imgui';
 
 -- ChamCham Variables
 local chamcham = {
@@ -37,20 +38,16 @@ local chamcham = {
     color_mob = { 1.0, 0.0, 0.0, 1.0 },
     color_npc = { 0.0, 1.0, 0.0, 1.0 },
     color_pc = { 0.0, 0.0, 1.0, 1.0 },
+    snapshot = entitysnapshot.new({ 'flags', 'actor', }),
 };
 
 --[[
 * Applies the cham color to an entity based on its type.
 *
-* @param {object} e - The entity object to apply the cham to.
+* @param {number} actor - The entity actor pointer.
+* @param {number} f - The entity spawn flags.
 --]]
-local function apply_cham(e)
-    if (e == nil) then
-        return;
-    end
-
-    -- Obtain the entity spawn flags..
-    local f = e.SpawnFlags;
+local function apply_cham(actor, f)
     local c = chamcham.color_pc;
 
     -- Determine the entity type and apply the proper color..
@@ -62,7 +59,7 @@ local function apply_cham(e)
         c = chamcham.color_mob;
     end
 
-    ashita.memory.write_uint32(e.ActorPointer + chamcham.offset, d3d8.D3DCOLOR_COLORVALUE(c[3], c[2], c[1], c[4]));
+    ashita.memory.write_uint32(actor + chamcham.offset, d3d8.D3DCOLOR_COLORVALUE(c[3], c[2], c[1], c[4]));
 end
 
 --[[
@@ -100,10 +97,9 @@ ashita.events.register('d3d_present', 'present_cb', function ()
     end
 
     -- Apply the cham colors..
-    for x = 0, 2303 do
-        local e = GetEntity(x);
-        if (e ~= nil and e.ActorPointer ~= 0) then
-            apply_cham(e);
-        end
+    local snap = chamcham.snapshot;
+    snap:capture();
+    for n = 0, snap.count - 1 do
+        apply_cham(snap.actor[n], snap.spawn_flags[n]);
     end
 end);
\ No newline at end of file
@@ -50,6 +50,7 @@ local default_settings = T{
 local fps = T{
     count = 0,
     timer = 0,
+    freq = ashita.time.query_performance_frequency().q,
     frame = 0,
     font = nil,
     show = true,
@@ -270,12 +271,13 @@ ashita.events.register('d3d_present', 'present_cb', function ()
         return;
     end
 
-    -- Calculate the current frames per second..
+    -- Calculate the current frames per second over (at least) the last second..
+    local now = ashita.time.query_performance_counter().q;
     fps.count = fps.count + 1;
-    if (os.time() >= fps.timer + 1) then
-        fps.frame = fps.count;
+    if (now - fps.timer >= fps.freq) then
+        fps.frame = math.round(fps.count * fps.freq / (now - fps.timer));
         fps.count = 0;
-        fps.timer = os.time();
+        fps.timer = now;
     end
 
     -- Update the FPS font object..
@@ -21,8 +21,9 @@
 
 require 'common';
 
-local chat  = require 'chat';
-local imgui = require 'imgui';
+local chat           = require 'chat';
+local imgui          = require 'imgui';
+local inventoryindex = require 'ffxi.inventoryindex';
 
 -- ItemWatch Editor Variables
 local editor = {
@@ -490,22 +491,12 @@ function editor.render_watchlist_overlay()
     imgui.SetNextWindowBgAlpha(editor.overlay.opacity[1]);
     if (imgui.Begin('itemwatch_overlay', editor.overlay.is_open, flags)) then
 
-        local inv = AshitaCore:GetMemoryManager():GetInventory();
         local ply = AshitaCore:GetMemoryManager():GetPlayer();
 
         -- Display the watched items..
         if (editor.lstMgr.watched_items_count() > 0) then
             editor.lstMgr.watched_items:each(function (v)
-                local total = 0;
-                for x = 0, 16 do
-                    for y = 0, 80 do
-                        local item = inv:GetContainerItem(x, y);
-                        if (item ~= nil and item.Id == v[1]) then
-                            total = total + item.Count;
-                        end
-                    end
-                end
-                imgui.Text(('%4d %s'):fmt(total, v[2]));
+                imgui.Text(('%4d %s'):fmt(inventoryindex.get_item_total(v[1]), v[2]));
             end);
         end
 
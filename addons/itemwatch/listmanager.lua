@@ -21,7 +21,8 @@
 
 require 'common';
 
-local settings = require 'settings';
+local nameindex = require 'ffxi.nameindex';
+local settings  = require 'settings';
 
 -- ListManager Variables
 local listmanager = T{
@@ -159,6 +160,27 @@ function listmanager.clear_watched_keyitems()
     listmanager.watched_keyitems = T{ };
 end
 
+--[[
+* Returns the names of the given name index that contain the given partial name.
+*
+* @param {table} idx - The name index to search.
+* @param {string} name - The partial name to look for.
+* @return {T} Table containing any found matches.
+--]]
+local function find_names(idx, name)
+    local ids = name:len() > 0 and idx:find_substring(name) or idx.ids;
+
+    local ret = T{ };
+    ids:each(function (v)
+        local n = idx:get_name(v);
+        if (n:len() > 1) then
+            ret:append({ v, n });
+        end
+    end);
+
+    return ret;
+end
+
 --[[
 * Returns a list of items that contain the given partial name.
 *
@@ -166,18 +188,7 @@ end
 * @return {T} Table containing any found matches.
 --]]
 function listmanager.find_items(name)
-    local items = T{ };
-
-    for x = 0, 65535 do
-        local item = AshitaCore:GetResourceManager():GetItemById(x);
-        if (item ~= nil and item.Name[1] ~= nil and item.Name[1]:len() > 1) then
-            if (item.Name[1]:lower():contains(name:lower())) then
-                items:append({ x, item.Name[1] });
-            end
-        end
-    end
-
-    return items;
+    return find_names(nameindex.items(), name);
 end
 
 --[[
@@ -187,18 +198,7 @@ end
 * @return {T} Table containing any found matches.
 --]]
 function listmanager.find_keyitems(name)
-    local items = T{ };
-
-    for x = 0, 65535 do
-        local n = AshitaCore:GetResourceManager():GetString('keyitems.names', x);
-        if (n ~= nil and n:len() > 1) then
-            if (n:lower():contains(name:lower())) then
-                items:append({ x, n });
-            end
-        end
-    end
-
-    return items;
+    return find_names(nameindex.strings('keyitems.names'), name);
 end
 
 --[[
@@ -29,11 +29,15 @@ Ashita Table -> Events ('ashita.events')
 ashita.events = {};
 
 ---Registers an event handler for the given event.
+---
+---_The options table is only available when the 'packetevents' library is required. It can be used with the
+---'packet_in' and 'packet_out' events to only receive the given packet ids. ({ ids = { 0x0028, }, })_
 ---@param event_name string
 ---@param event_alias string
 ---@param callback function
+---@param options? table
 ---@return boolean
-function ashita.events.register(event_name, event_alias, callback) end
+function ashita.events.register(event_name, event_alias, callback, options) end
 
 ---Unregisters an existing event handler.
 ---@param event_name string
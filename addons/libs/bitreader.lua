@@ -21,20 +21,89 @@
 
 require 'common';
 
+local ffi = require 'ffi';
+
+-- Powers of two used to combine the bytes of a value without overflowing the 32bit bit library..
+local pow2 = T{};
+for x = 0, 63 do
+    pow2[x] = 2 ^ x;
+end
+
 ---@class BitReader
----@field data table The data table being read from.
+---@field data ffi.cdata* The data being read from. (const uint8_t*)
+---@field size number The size, in bytes, of the data being read from.
+---@field src any The source object of the data. (Holds a reference to prevent it from being collected.)
 ---@field bit number The current bit position.
 ---@field pos number The current byte position.
+---@field fields table The scratch table used to return multiple values from read_fields.
 local breader = T{
     data    = nil,
+    size    = 0,
+    src     = nil,
     bit     = 0,
     pos     = 0,
 };
 
+---Reads a packed value from the given data, without a reader instance.
+---
+---_Values are read least significant bit first. (Matching Ashita::BinaryData::UnpackBitsBE.) Values
+---up to 53 bits wide are returned exactly. The read is not bounds checked; the caller must ensure it
+---is within the data._
+---@param data ffi.cdata* The data to read from. (const uint8_t*)
+---@param pos number The bit position to read from.
+---@param bits number The number of bits to read.
+---@return number, number # The read value and the bit position following it.
+local function read_bits(data, pos, bits)
+    local idx   = bit.rshift(pos, 3);
+    local off   = bit.band(pos, 7);
+    local ret   = 0;
+    local shift = 0;
+    local left  = bits;
+
+    while (left > 0) do
+        local take = 8 - off;
+        if (take > left) then
+            take = left;
+        end
+
+        ret     = ret + bit.band(bit.rshift(data[idx], off), bit.lshift(1, take) - 1) * pow2[shift];
+        shift   = shift + take;
+        left    = left - take;
+        off     = 0;
+        idx     = idx + 1;
+    end
+
+    return ret, pos + bits;
+end
+
+-- Scratch union used to reinterpret read values as floats..
+local float_buff = ffi.new('union { uint32_t u; float f; }');
+
+---Converts a read unsigned value to a signed value of the given width.
+---@param value number The read value.
+---@param bits number The bit width of the value.
+---@return number
+function breader.to_signed(value, bits)
+    if (value >= pow2[bits - 1]) then
+        return value - pow2[bits];
+    end
+    return value;
+end
+
+---Converts a read unsigned 32bit value to a float.
+---@param value number The read value.
+---@return number
+function breader.to_float(value)
+    float_buff.u = value;
+    return float_buff.f;
+end
+
+breader.read_bits = read_bits;
+
 ---Creates and returns a new bit reader instance.
 ---@param self BitReader
 ---@param o nil|table The default object, if provided.
----@param data nil|string|table The data to be used with this reader.
+---@param data nil|string|table|ffi.cdata* The data to be used with this reader.
 ---@param pos nil|number The position within the data, if provided.
 ---@return BitReader
 function breader:new(o, data, pos)
@@ -43,12 +112,14 @@ function breader:new(o, data, pos)
     setmetatable(o, self);
     self.__index = self;
 
+    o.fields = T{};
+
     if (data ~= nil) then
-        self:set_data(data);
+        o:set_data(data);
     end
 
     if (pos ~= nil) then
-        self:set_pos(pos);
+        o:set_pos(pos);
     end
 
     return o;
@@ -56,30 +127,43 @@ end
 
 ---Set the current reader data. (Resets the current position.)
 ---
----_The data passed to this function should either be a string containing hexadecimal
----values or a table of bytes. If the data is a string, it will be converted to a
----byte table automatically. (String usage is intended for use with literal strings
----such as packet data from the Ashita packet events.)_
+---_The data passed to this function should either be a string of raw bytes, a table of bytes
+---or an FFI pointer along with its size. Strings and pointers are read from directly without
+---being copied. (String usage is intended for use with literal strings such as packet data from
+---the Ashita packet events.)_
+---
+---_The reader never modifies the given data._
 ---@param self BitReader
----@param data string|table The data to be used with the reader.
-function breader:set_data(data)
+---@param data string|table|ffi.cdata* The data to be used with the reader.
+---@param size nil|number The size of the data, in bytes. (Required when data is an FFI pointer.)
+function breader:set_data(data, size)
     self.bit    = 0;
-    self.data   = T{};
     self.pos    = 0;
 
     switch(type(data), T{
         ['string'] = function ()
-            data:tohex():replace(' ', ''):gsub('(%x%x)', function (x)
-                return self.data:insert(tonumber(x, 16));
-            end);
+            self.src    = data;
+            self.data   = ffi.cast('const uint8_t*', data);
+            self.size   = data:len();
         end,
         ['table'] = function ()
-            if (getmetatable(data) == nil) then
-                data = T(data);
+            local buff = ffi.new('uint8_t[?]', math.max(#data, 1));
+            for x = 1, #data do
+                buff[x - 1] = data[x];
+            end
+
+            self.src    = buff;
+            self.data   = ffi.cast('const uint8_t*', buff);
+            self.size   = #data;
+        end,
+        ['cdata'] = function ()
+            if (size == nil) then
+                error('[bitreader] Invalid data size; a size is required when using a pointer.');
             end
 
-            ---@cast data table
-            self.data = data;
+            self.src    = data;
+            self.data   = ffi.cast('const uint8_t*', data);
+            self.size   = size;
         end,
         [switch.default] = function ()
             error('[bitreader] Invalid data type given for bit reader: ' .. type(data));
@@ -89,7 +173,9 @@ end
 
 ---Sets the current reader bit position.
 ---
----_This method does not reset the byte position!_
+---_This method does not reset the byte position! The bit position is relative to the current byte
+---position and may be larger than 7; it is folded into the byte position by the next read, so
+---repeated calls always set the same position._
 ---@param self BitReader
 ---@param pos number The bit position to set the reader to.
 function breader:set_bit_pos(pos)
@@ -107,51 +193,73 @@ function breader:set_pos(pos)
 end
 
 ---Reads a packed value from the current data.
+---
+---_Values are read least significant bit first. (Matching Ashita::BinaryData::UnpackBitsBE.) Values
+---up to 53 bits wide are returned exactly._
 ---@param self BitReader
 ---@param bits number The number of bits to read.
 ---@return number
 function breader:read(bits)
-    local ret = 0;
+    local data = self.data;
+    local pos  = self.pos;
+    local off  = self.bit;
 
-    if (self.data == nil) then
-        error('[bitreader] Invalid ');
+    if (data == nil) then
+        error('[bitreader] Invalid data; no data has been set.');
     end
 
-    if (self.pos >= self.data:len()) then
-        error(('[bitreader] Invalid read attempt, buffer overrun. [pos: %d, len: %d]'):fmt(self.pos, self.data:len()));
+    if ((pos * 8) + off + bits > self.size * 8) then
+        error(('[bitreader] Invalid read attempt, buffer overrun. [pos: %d, bit: %d, bits: %d, len: %d]'):fmt(pos, off, bits, self.size));
     end
 
-    -- Optimized read.. (8 bits)
-    if (bits == 8 and self.bit == 0) then
-        self.pos = self.pos + 1;
-        return self.data[self.pos];
+    -- Optimized reads.. (8, 16 and 32 bits)
+    if (off == 0) then
+        if (bits == 8) then
+            self.pos = pos + 1;
+            return data[pos];
+        end
+        if (bits == 16) then
+            self.pos = pos + 2;
+            return data[pos] + data[pos + 1] * 0x100;
+        end
+        if (bits == 32) then
+            self.pos = pos + 4;
+            return data[pos] + data[pos + 1] * 0x100 + data[pos + 2] * 0x10000 + data[pos + 3] * 0x1000000;
+        end
     end
 
-    -- Optimized read.. (16 bits)
-    if (bits == 16 and self.bit == 0) then
-        self.pos = self.pos + 2;
-        return bit.bor(bit.lshift(self.data[self.pos], 8), self.data[self.pos - 1]);
-    end
+    -- Read the value a byte at a time..
+    local ret, p = read_bits(data, pos * 8 + off, bits);
 
-    -- Optimized read.. (32 bits)
-    if (bits == 32 and self.bit == 0) then
-        self.pos = self.pos + 4;
-        return bit.bor(bit.lshift(self.data[self.pos], 24), bit.lshift(self.data[self.pos - 1], 16), bit.lshift(self.data[self.pos - 2], 8), self.data[self.pos - 3]);
-    end
+    self.pos = bit.rshift(p, 3);
+    self.bit = bit.band(p, 7);
 
-    for x = 0, bits - 1 do
-        local val = bit.lshift(bit.band(self.data[self.pos + 1], 1), x);
-        self.data[self.pos + 1] = bit.rshift(self.data[self.pos + 1], 1);
-        ret = bit.bor(ret, val);
+    return ret;
+end
 
-        self.bit = self.bit + 1;
-        if (self.bit == 8) then
-            self.bit = 0;
-            self.pos = self.pos + 1;
-        end
+---Reads multiple packed values from the current data.
+---
+---_The values are read in order and returned as multiple return values._
+---
+---```lua
+---local kind, sub_kind, value = reader:read_fields({ 2, 12, 17 });
+---```
+---@param self BitReader
+---@param fields table The number of bits to read for each value.
+---@return number ...
+function breader:read_fields(fields)
+    local ret = self.fields;
+    if (ret == nil) then
+        ret = T{};
+        self.fields = ret;
     end
 
-    return ret;
+    local cnt = #fields;
+    for x = 1, cnt do
+        ret[x] = self:read(fields[x]);
+    end
+
+    return unpack(ret, 1, cnt);
 end
 
 return breader;
\ No newline at end of file
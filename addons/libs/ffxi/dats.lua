@@ -27,21 +27,22 @@ local C     = ffi.C;
 
 -- FFI Prototypes
 ffi.cdef[[
-    typedef struct __IO_FILE FILE;
-        
-    FILE* __cdecl   fopen(const char* _FileName, const char* _Mode);
-    int32_t __cdecl fseek(FILE* _Stream, long _Offset, int32_t _Origin);
-    long    __cdecl ftell(FILE* _Stream);
-    int32_t __cdecl fread(void* _Buffer, size_t _ElementSize, size_t _ElementCount, FILE* _Stream);
-    int32_t __cdecl fclose(FILE* _Stream);
-
-    enum {
-        SEEK_SET = 0,
-        SEEK_CUR = 1,
-        SEEK_END = 2,
-    };
+    HANDLE  __stdcall CreateFileA(const char* lpFileName, DWORD dwDesiredAccess, DWORD dwShareMode, LPVOID lpSecurityAttributes, DWORD dwCreationDisposition, DWORD dwFlagsAndAttributes, HANDLE hTemplateFile);
+    BOOL    __stdcall GetFileSizeEx(HANDLE hFile, LARGE_INTEGER* lpFileSize);
+    HANDLE  __stdcall CreateFileMappingA(HANDLE hFile, LPVOID lpFileMappingAttributes, DWORD flProtect, DWORD dwMaximumSizeHigh, DWORD dwMaximumSizeLow, const char* lpName);
+    LPVOID  __stdcall MapViewOfFile(HANDLE hFileMappingObject, DWORD dwDesiredAccess, DWORD dwFileOffsetHigh, DWORD dwFileOffsetLow, SIZE_T dwNumberOfBytesToMap);
+    BOOL    __stdcall UnmapViewOfFile(LPVOID lpBaseAddress);
+    BOOL    __stdcall CloseHandle(HANDLE hObject);
 ]];
 
+local GENERIC_READ          = 0x80000000;
+local FILE_SHARE_READ       = 0x00000001;
+local OPEN_EXISTING         = 3;
+local FILE_ATTRIBUTE_NORMAL = 0x00000080;
+local PAGE_READONLY         = 0x02;
+local FILE_MAP_READ         = 0x04;
+local INVALID_HANDLE_VALUE  = ffi.cast('HANDLE', -1);
+
 -- Dats Variables
 local dats = T{
     -- Dat lookup variables..
@@ -49,12 +50,62 @@ local dats = T{
     ftable = nil,
     vtable = nil,
 
+    -- Mapped file view cache..
+    views = T{
+        cache       = T{},                  -- The cached views, keyed by file id..
+        order       = T{},                  -- The cached file ids, least recently used first..
+        max_views   = 32,                   -- The maximum number of cached views..
+        max_bytes   = 64 * 1024 * 1024,     -- The maximum size of the cached views, in bytes..
+        bytes       = 0,                    -- The size of the cached views, in bytes..
+        hits        = 0,                    -- The number of views returned from the cache..
+        misses      = 0,                    -- The number of views that mapped their file..
+    },
+
     -- Predefined lists..
     lists = T{
         npcs = require 'ffxi.dats.npcs',
     },
 };
 
+--[[
+* Maps a file into memory for reading.
+*
+* @param {string} path - The path to the file.
+* @return {cdata|nil, number} The mapped file data and its size on success, nil otherwise.
+* @notes
+*
+*   The data is unmapped once it is garbage collected; callers must keep a reference to it while it is in use.
+--]]
+local function map_file(path)
+    local f = C.CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nil, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nil);
+    if (f == INVALID_HANDLE_VALUE) then
+        return nil, 0;
+    end
+
+    local size = ffi.new('LARGE_INTEGER[1]');
+    if (C.GetFileSizeEx(f, size) == 0 or size[0].QuadPart == 0) then
+        C.CloseHandle(f);
+        return nil, 0;
+    end
+
+    local m = C.CreateFileMappingA(f, nil, PAGE_READONLY, 0, 0, nil);
+    C.CloseHandle(f);
+    if (m == nil) then
+        return nil, 0;
+    end
+
+    -- The view keeps the mapping alive once mapped, so both handles can be closed..
+    local data = C.MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+    C.CloseHandle(m);
+    if (data == nil) then
+        return nil, 0;
+    end
+
+    return ffi.gc(ffi.cast('const uint8_t*', data), function (v)
+        C.UnmapViewOfFile(ffi.cast('LPVOID', v));
+    end), tonumber(size[0].QuadPart);
+end
+
 -- Obtain the install path to Final Fantasy XI..
 do
     local lang = AshitaCore:GetConfigurationManager():GetInt32('boot', 'ashita.language', 'playonline', 2);
@@ -68,7 +119,7 @@ do
     dats.path = ashita.fs.get_install_dir(lang, 1);
 end
 
--- Read and populate the file index tables..
+-- Map and merge the file index tables of each ROM folder; entries of later folders override earlier ones..
 do
     local paths = T{
         { '/FTABLE.DAT',        '/VTABLE.DAT', },
@@ -82,62 +133,35 @@ do
         { '/ROM9/FTABLE9.DAT',  '/ROM9/VTABLE9.DAT', },
     };
 
-    do
-        -- Read the main FTABLE.DAT file..
-        local f = C.fopen(dats.path + paths[1][1], 'rb');
-        C.fseek(f, 0, C.SEEK_END);
-        local s = C.ftell(f);
-        C.fseek(f, 0, C.SEEK_SET);
-        dats.ftable = ffi.new('uint16_t[?]', s / 2);
-        C.fread(dats.ftable, s, 1, f);
-        C.fclose(f);
-
-        -- Read the main VTABLE.DAT file..
-        f = C.fopen(dats.path + paths[1][2], 'rb');
-        C.fseek(f, 0, C.SEEK_END);
-        s = C.ftell(f);
-        C.fseek(f, 0, C.SEEK_SET);
-        dats.vtable = ffi.new('uint8_t[?]', s);
-        C.fread(dats.vtable, s, 1, f);
-        C.fclose(f);
-    end
-
-    do
-        -- Read the additional FTABLE/VTABLE files and merge them together..
-        for x = 2, #paths do
-            local tempFTable = nil;
-            local tempVTable = nil;
-
-            -- Read the FTABLE DAT file..
-            local f = C.fopen(dats.path + paths[x][1], 'rb');
-            C.fseek(f, 0, C.SEEK_END);
-            local s = C.ftell(f);
-            C.fseek(f, 0, C.SEEK_SET);
-            tempFTable = ffi.new('uint16_t[?]', s / 2);
-            C.fread(tempFTable, s, 1, f);
-            C.fclose(f);
-
-            for y = 0, (s / 2) do
-                if (tempFTable[y] > 0) then
-                    dats.ftable[y] = tempFTable[y];
-                end
-            end
+    local tables = T{};
+    local count  = 0;
+
+    for x = 1, #paths do
+        local fdata, fsize = map_file(dats.path + paths[x][1]);
+        local vdata, vsize = map_file(dats.path + paths[x][2]);
 
-            -- Read the VTABLE DAT file..
-            f = C.fopen(dats.path + paths[x][2], 'rb');
-            C.fseek(f, 0, C.SEEK_END);
-            s = C.ftell(f);
-            C.fseek(f, 0, C.SEEK_SET);
-            tempVTable = ffi.new('uint8_t[?]', s);
-            C.fread(tempVTable, s, 1, f);
-            C.fclose(f);
-
-            for y = 0, s do
-                if (tempVTable[y] > 0) then
-                    dats.vtable[y] = tempVTable[y];
+        if (fdata ~= nil and vdata ~= nil) then
+            local n = math.min(vsize, math.floor(fsize / 2));
+            tables:append(T{ ffi.cast('const uint16_t*', fdata), vdata, n, fdata, });
+            count = math.max(count, n);
+        end
+    end
+
+    if (count > 0) then
+        dats.ftable = ffi.new('uint16_t[?]', count);
+        dats.vtable = ffi.new('uint8_t[?]', count);
+
+        tables:each(function (t)
+            local ftable, vtable = t[1], t[2];
+            for y = 0, t[3] - 1 do
+                if (ftable[y] > 0) then
+                    dats.ftable[y] = ftable[y];
+                end
+                if (vtable[y] > 0) then
+                    dats.vtable[y] = vtable[y];
                 end
             end
-        end
+        end);
     end
 end
 
@@ -151,7 +175,7 @@ dats.get_file_path = function (fileid)
     end
 
     -- Ensure the file id is within a valid range..
-    if (fileid > ffi.sizeof(dats.vtable) or fileid < 0) then
+    if (fileid >= ffi.sizeof(dats.vtable) or fileid < 0) then
         return nil;
     end
 
@@ -164,6 +188,68 @@ dats.get_file_path = function (fileid)
     return ('%s\\%s\\%s\\%s.DAT'):fmt(dats.path, (r == 1 and 'ROM' or ('ROM'):append(r)), bit.rshift(dats.ftable[fileid], 0x07), bit.band(dats.ftable[fileid], 0x7F));
 end
 
+---Returns a mapped, read-only view of a DAT file by its lookup id.
+---
+---The view holds the file data (`view.data`, a `const uint8_t*`) and its size (`view.size`). The data is read
+---directly from the mapped file, without copying, and stays mapped while the view is referenced. Views are
+---cached; the least recently used views are released once the cache is full.
+---@param fileid number
+---@return table|nil
+---@nodiscard
+dats.get_file_view = function (fileid)
+    local views = dats.views;
+
+    local view = views.cache[fileid];
+    if (view ~= nil) then
+        views.order:delete(fileid);
+        views.order:append(fileid);
+        views.hits = views.hits + 1;
+        return view;
+    end
+
+    local path = dats.get_file_path(fileid);
+    if (path == nil) then
+        return nil;
+    end
+
+    local data, size = map_file(path);
+    if (data == nil) then
+        return nil;
+    end
+
+    view = T{ fileid = fileid, data = data, size = size, };
+    views.misses = views.misses + 1;
+
+    -- Files larger than the cache are returned without being cached..
+    if (size <= views.max_bytes) then
+        views.cache[fileid] = view;
+        views.order:append(fileid);
+        views.bytes = views.bytes + size;
+
+        while (#views.order > views.max_views or views.bytes > views.max_bytes) do
+            local id = table.remove(views.order, 1);
+            views.bytes = views.bytes - views.cache[id].size;
+            views.cache[id] = nil;
+        end
+    end
+
+    return view;
+end
+
+---Sets the limits of the view cache, releasing views as needed.
+---@param max_views number The maximum number of cached views.
+---@param max_bytes number The maximum size of the cached views, in bytes.
+dats.set_view_limits = function (max_views, max_bytes)
+    dats.views.max_views = max_views;
+    dats.views.max_bytes = max_bytes;
+
+    while (#dats.views.order > 0 and (#dats.views.order > max_views or dats.views.bytes > max_bytes)) do
+        local id = table.remove(dats.views.order, 1);
+        dats.views.bytes = dats.views.bytes - dats.views.cache[id].size;
+        dats.views.cache[id] = nil;
+    end
+end
+
 ---Returns the DAT id for the file containing the given zones npc list.
 ---
 ---The zone id and sub id can be obtained from the `Zone Enter (0x000A)` packet.
@@ -198,5 +284,18 @@ dats.get_zone_npclist = function (zid, zsubid)
     return dats.get_file_path(dats.get_zone_npclist_id(zid, zsubid));
 end
 
+---Returns a mapped, read-only view of the DAT file containing the given zones npc list.
+---
+---The zone id and sub id can be obtained from the `Zone Enter (0x000A)` packet.
+--- - Offset: `0x30` = Zone Id
+--- - Offset: `0x9E` = Zone Sub Id
+---@param zid number
+---@param zsubid number
+---@return table|nil
+---@nodiscard
+dats.get_zone_npclist_view = function (zid, zsubid)
+    return dats.get_file_view(dats.get_zone_npclist_id(zid, zsubid));
+end
+
 -- Return the modules table.
 return dats;
\ No newline at end of file
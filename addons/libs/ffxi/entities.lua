@@ -0,0 +1,178 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+--[[
+* Entities
+*
+* Maps entity server ids to their entity (target) index in constant time, replacing sweeps over every
+* entity slot. The map is kept up to date from the entity update packets (0x000D, 0x000E) and the zone
+* packets (0x000A, 0x000B). (The same rules as the SDK's EntityIdMap.h.)
+*
+* Lookups are verified against the entity manager. If the map has no entry for a server id, or the entry
+* has since been reused by another entity, the map is rebuilt from the entity manager once; further misses
+* return nil until the next zone packet clears the map. Entity packets only update the index they name, so
+* they never cause a rebuild.
+--]]
+
+local entitieslib = T{
+    ids     = T{}, -- Server id to entity index..
+    indexes = T{}, -- Entity index to server id..
+    scanned = false,
+};
+
+---Sets the server id of the given entity index, replacing any previous mapping of either.
+---@param index number The entity index.
+---@param server_id number The entity server id.
+local function set(index, server_id)
+    local old = entitieslib.indexes[index];
+    if (old == server_id) then
+        return;
+    end
+    if (old ~= nil) then
+        entitieslib.ids[old] = nil;
+    end
+
+    if (server_id == nil or server_id == 0) then
+        entitieslib.indexes[index] = nil;
+        return;
+    end
+
+    local prev = entitieslib.ids[server_id];
+    if (prev ~= nil) then
+        entitieslib.indexes[prev] = nil;
+    end
+
+    entitieslib.ids[server_id]  = index;
+    entitieslib.indexes[index]  = server_id;
+end
+
+---Clears the map.
+local function clear()
+    entitieslib.ids     = T{};
+    entitieslib.indexes = T{};
+    entitieslib.scanned = false;
+end
+
+---Rebuilds the map from the entity manager.
+entitieslib.rebuild = function ()
+    clear();
+
+    local em = AshitaCore:GetMemoryManager():GetEntity();
+    for x = 0, 2303 do
+        local id = em:GetServerId(x);
+        if (id ~= nil and id ~= 0) then
+            set(x, id);
+        end
+    end
+
+    entitieslib.scanned = true;
+end
+
+---Returns the entity index of the given server id.
+---@param server_id number The entity server id.
+---@return number|nil
+---@nodiscard
+entitieslib.get_index = function (server_id)
+    if (server_id == nil or server_id == 0) then
+        return nil;
+    end
+
+    local em  = AshitaCore:GetMemoryManager():GetEntity();
+    local idx = entitieslib.ids[server_id];
+
+    -- Verify the entry; entities spawned by a packet still being handled have no server id yet..
+    if (idx ~= nil) then
+        local id = em:GetServerId(idx);
+        if (id == server_id or id == 0) then
+            return idx;
+        end
+        set(idx, id);
+    end
+
+    if (entitieslib.scanned) then
+        return nil;
+    end
+
+    entitieslib.rebuild();
+    return entitieslib.ids[server_id];
+end
+
+---Returns the entity of the given server id.
+---@param server_id number The entity server id.
+---@return entity_t|nil
+---@nodiscard
+entitieslib.get_entity = function (server_id)
+    local idx = entitieslib.get_index(server_id);
+    if (idx == nil) then
+        return nil;
+    end
+    return GetEntity(idx);
+end
+
+---Returns the name of the entity of the given server id.
+---@param server_id number The entity server id.
+---@return string|nil
+---@nodiscard
+entitieslib.get_name = function (server_id)
+    local idx = entitieslib.get_index(server_id);
+    if (idx == nil) then
+        return nil;
+    end
+    return AshitaCore:GetMemoryManager():GetEntity():GetName(idx);
+end
+
+--[[
+* event: packet_in
+* desc : Event called when the addon is processing incoming packets.
+--]]
+ashita.events.register('packet_in', '__entities_packet_in_cb', function (e)
+    -- Packet: Zone Enter
+    if (e.id == 0x000A) then
+        clear();
+        set(struct.unpack('H', e.data, 0x08 + 0x01), struct.unpack('I', e.data, 0x04 + 0x01));
+        return;
+    end
+
+    -- Packet: Zone Leave
+    if (e.id == 0x000B) then
+        clear();
+        return;
+    end
+
+    -- Packet: Player Update / Entity Update
+    if (e.id == 0x000D or e.id == 0x000E) then
+        local id    = struct.unpack('I', e.data, 0x04 + 0x01);
+        local idx   = struct.unpack('H', e.data, 0x08 + 0x01);
+
+        -- The update flags mark the entity as despawned..
+        if (bit.band(struct.unpack('B', e.data, 0x0A + 0x01), 0x20) ~= 0) then
+            if (entitieslib.ids[id] == idx) then
+                set(idx, nil);
+            end
+        else
+            set(idx, id);
+        end
+    end
+end);
+
+return entitieslib;
\ No newline at end of file
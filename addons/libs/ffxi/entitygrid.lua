@@ -0,0 +1,376 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+--[[
+* Entity Grid
+*
+* A spatial index over the entity table, for nearest, radius and cone queries. (The same grid as the
+* SDK's EntityGrid.h.)
+*
+* Entities are bucketed into a uniform grid of cells over their X and Z positions. The grid is refreshed
+* from the entity manager at most once per frame, on the first query of the frame, so any number of queries
+* share a single pass over the entity table. Queries only visit the cells overlapping their search area.
+*
+* Only entities with an actor (ie. spawned and rendered) are in the grid.
+*
+* Query filters are tables with the following optional fields:
+*
+*   spawn_flags     - Entities must have any of these spawn flags set.
+*   types           - Entities must be one of these types. (Bitmask of bit.lshift(1, type).)
+*   render_flags0   - Entities must have all of these render flags set.
+*   exclude         - The entity index to exclude. (ie. the player.)
+*   func            - Additional predicate entities must match. (Called with the entity index.)
+--]]
+
+local CELL_SIZE = 16.0;
+local GRID_SIZE = 64;
+local MAX_RINGS = GRID_SIZE / 2;
+local MAX_ENTS  = 2304;
+
+local gridlib = T{
+    dirty   = true,
+    count   = 0,
+    buckets = T{}, -- The first entity of each bucket..
+    bucket  = T{}, -- The bucket each entity is linked into..
+    prev    = T{}, -- The previous entity of each entities bucket..
+    next    = T{}, -- The next entity of each entities bucket..
+    x       = T{},
+    z       = T{},
+    flags   = T{}, -- The entity spawn flags..
+    types   = T{}, -- The entity types..
+    render  = T{}, -- The entity render flags..
+};
+
+local function get_cell(v)
+    return math.floor(math.min(math.max(v / CELL_SIZE, -1048576), 1048576));
+end
+
+local function get_bucket(cx, cz)
+    return bit.band(cz, GRID_SIZE - 1) * GRID_SIZE + bit.band(cx, GRID_SIZE - 1);
+end
+
+local function unlink(index)
+    local g = gridlib;
+    local b = g.bucket[index];
+    if (b == nil) then
+        return;
+    end
+
+    local p, n = g.prev[index], g.next[index];
+    if (p ~= nil) then
+        g.next[p] = n;
+    else
+        g.buckets[b] = n;
+    end
+    if (n ~= nil) then
+        g.prev[n] = p;
+    end
+
+    g.bucket[index] = nil;
+    g.prev[index]   = nil;
+    g.next[index]   = nil;
+    g.count         = g.count - 1;
+end
+
+local function matches(index, filter)
+    if (filter == nil) then
+        return true;
+    end
+
+    local g = gridlib;
+    if (filter.exclude == index) then
+        return false;
+    end
+    if (filter.spawn_flags ~= nil and filter.spawn_flags ~= 0 and bit.band(g.flags[index], filter.spawn_flags) == 0) then
+        return false;
+    end
+    if (filter.types ~= nil and filter.types ~= 0 and (g.types[index] >= 32 or bit.band(bit.rshift(filter.types, g.types[index]), 1) == 0)) then
+        return false;
+    end
+    if (filter.render_flags0 ~= nil and bit.band(g.render[index], filter.render_flags0) ~= bit.tobit(filter.render_flags0)) then
+        return false;
+    end
+    if (filter.func ~= nil and not filter.func(index)) then
+        return false;
+    end
+    return true;
+end
+
+---Adds or moves an entity within the grid.
+---@param index number The entity index.
+---@param x number The entity X position.
+---@param z number The entity Z position.
+---@param spawn_flags number The entity spawn flags.
+---@param etype number The entity type.
+---@param render_flags0 number The entity render flags.
+gridlib.update = function (index, x, z, spawn_flags, etype, render_flags0)
+    -- Reject non-finite positions..
+    if (x ~= x or z ~= z or x == math.huge or x == -math.huge or z == math.huge or z == -math.huge) then
+        return;
+    end
+
+    local g = gridlib;
+    g.x[index]      = x;
+    g.z[index]      = z;
+    g.flags[index]  = spawn_flags;
+    g.types[index]  = etype;
+    g.render[index] = render_flags0;
+
+    -- Relink the entity only if it has moved into another bucket..
+    local b = get_bucket(get_cell(x), get_cell(z));
+    if (g.bucket[index] == b) then
+        return;
+    end
+
+    unlink(index);
+
+    local n = g.buckets[b];
+    g.bucket[index] = b;
+    g.next[index]   = n;
+    if (n ~= nil) then
+        g.prev[n] = index;
+    end
+    g.buckets[b] = index;
+    g.count      = g.count + 1;
+end
+
+---Removes an entity from the grid.
+---@param index number The entity index.
+gridlib.remove = function (index)
+    unlink(index);
+end
+
+---Removes every entity from the grid.
+gridlib.clear = function ()
+    for x = 0, MAX_ENTS - 1 do
+        unlink(x);
+    end
+end
+
+---Updates the grid from the entity manager.
+gridlib.refresh = function ()
+    local em = AshitaCore:GetMemoryManager():GetEntity();
+    for x = 0, MAX_ENTS - 1 do
+        if (em:GetActorPointer(x) == 0) then
+            unlink(x);
+        else
+            gridlib.update(x, em:GetLocalPositionX(x), em:GetLocalPositionZ(x), em:GetSpawnFlags(x), em:GetType(x), em:GetRenderFlags0(x));
+        end
+    end
+    gridlib.dirty = false;
+end
+
+--[[
+* Visits the entities of the cells around a position, in rings of cells moving outwards.
+*
+* @param {number} x - The X position.
+* @param {number} z - The Z position.
+* @param {number} radius - The radius to visit within.
+* @param {function} visit - Called with each entity index and its squared distance; returns false to stop.
+* @param {function|nil} stop - Called after each ring with the distance fully searched; returns true to stop.
+* @return {boolean} True if the visit was stopped early, false otherwise.
+--]]
+local function visit_cells(x, z, radius, visit, stop)
+    local g = gridlib;
+    if (g.dirty) then
+        g.refresh();
+    end
+
+    local function visit_bucket(b)
+        local index = g.buckets[b];
+        while (index ~= nil) do
+            local dx, dz = g.x[index] - x, g.z[index] - z;
+            if (not visit(index, dx * dx + dz * dz)) then
+                return false;
+            end
+            index = g.next[index];
+        end
+        return true;
+    end
+
+    local cx, cz = get_cell(x), get_cell(z);
+    local rings  = math.min(math.ceil(math.min(radius, 1048576) / CELL_SIZE), MAX_RINGS);
+
+    -- Searches wider than the grid visit every bucket once instead..
+    if (rings >= MAX_RINGS) then
+        for b = 0, GRID_SIZE * GRID_SIZE - 1 do
+            if (not visit_bucket(b)) then
+                return true;
+            end
+        end
+        return false;
+    end
+
+    for ring = 0, rings do
+        for z0 = cz - ring, cz + ring do
+            -- Inner rows only have the two edge cells of the ring..
+            local step = (z0 == cz - ring or z0 == cz + ring) and 1 or math.max(ring * 2, 1);
+            for x0 = cx - ring, cx + ring, step do
+                if (not visit_bucket(get_bucket(x0, z0))) then
+                    return true;
+                end
+            end
+        end
+
+        -- Every entity nearer than the distance to the edge of this ring has been visited..
+        if (stop ~= nil and stop(ring * CELL_SIZE)) then
+            return true;
+        end
+    end
+
+    return false;
+end
+
+---Returns the indexes of the entities within the given radius of a position.
+---@param x number The X position.
+---@param z number The Z position.
+---@param radius number The radius to search within.
+---@param filter table|nil The filter entities must match.
+---@return table
+---@nodiscard
+gridlib.within = function (x, z, radius, filter)
+    local ret = T{};
+    if (x == nil or z == nil or radius == nil or radius < 0) then
+        return ret;
+    end
+
+    local r2 = radius * radius;
+    visit_cells(x, z, radius, function (index, d2)
+        if (d2 <= r2 and matches(index, filter)) then
+            ret:append(index);
+        end
+        return true;
+    end);
+
+    return ret;
+end
+
+---Returns the indexes of the entities within the given cone.
+---@param x number The X position of the cone origin.
+---@param z number The Z position of the cone origin.
+---@param yaw number The heading of the cone, in radians. (ie. an entities Movement.LocalPosition.Yaw.)
+---@param angle number The half angle of the cone, in radians.
+---@param radius number The length of the cone.
+---@param filter table|nil The filter entities must match.
+---@return table
+---@nodiscard
+gridlib.cone = function (x, z, yaw, angle, radius, filter)
+    local ret = T{};
+    if (x == nil or z == nil or yaw == nil or angle == nil or radius == nil or radius < 0) then
+        return ret;
+    end
+
+    -- The client heading points along +X at 0 and turns towards -Z..
+    local dx, dz = math.cos(yaw), -math.sin(yaw);
+    local cosine = math.cos(math.min(math.max(angle, 0), math.pi));
+    local r2     = radius * radius;
+
+    visit_cells(x, z, radius, function (index, d2)
+        if (d2 > r2) then
+            return true;
+        end
+
+        -- Entities at the origin of the cone are always within it..
+        local ex, ez = gridlib.x[index] - x, gridlib.z[index] - z;
+        if (d2 > 0 and (ex * dx + ez * dz) < cosine * math.sqrt(d2)) then
+            return true;
+        end
+
+        if (matches(index, filter)) then
+            ret:append(index);
+        end
+        return true;
+    end);
+
+    return ret;
+end
+
+---Returns the indexes of the entities nearest to a position, ordered by their distance.
+---@param x number The X position.
+---@param z number The Z position.
+---@param count number The number of entities to find.
+---@param filter table|nil The filter entities must match.
+---@param max_distance number|nil The maximum distance to search within. (Unlimited if nil.)
+---@return table
+---@nodiscard
+gridlib.nearest = function (x, z, count, filter, max_distance)
+    local ret   = T{};
+    local dists = T{};
+    if (x == nil or z == nil or count == nil or count < 1) then
+        return ret;
+    end
+
+    max_distance = max_distance or math.huge;
+    local m2 = max_distance * max_distance;
+
+    local function visit(index, d2)
+        if (d2 > m2) then
+            return true;
+        end
+        if (#ret == count and d2 >= dists[count]) then
+            return true;
+        end
+        if (not matches(index, filter)) then
+            return true;
+        end
+
+        -- Insert the entity into the sorted results..
+        local pos = #ret < count and #ret + 1 or count;
+        while (pos > 1 and dists[pos - 1] > d2) do
+            dists[pos] = dists[pos - 1];
+            ret[pos]   = ret[pos - 1];
+            pos        = pos - 1;
+        end
+        dists[pos] = d2;
+        ret[pos]   = index;
+        return true;
+    end
+
+    local function stop(searched)
+        -- Stop expanding once every remaining entity is further than the worst match..
+        return #ret == count and dists[count] <= searched * searched;
+    end
+
+    -- Search outwards ring by ring; searches that reach past the grid start over and visit every bucket..
+    local range = math.min(max_distance, (MAX_RINGS - 1) * CELL_SIZE);
+    if (visit_cells(x, z, range, visit, stop) or range == max_distance) then
+        return ret;
+    end
+
+    ret   = T{};
+    dists = T{};
+    visit_cells(x, z, max_distance, visit, stop);
+
+    return ret;
+end
+
+--[[
+* event: d3d_present
+* desc : Event called when the Direct3D device is presenting a scene.
+--]]
+ashita.events.register('d3d_present', '__entitygrid_present_cb', function ()
+    -- Refresh the grid on the first query of the next frame..
+    gridlib.dirty = true;
+end);
+
+return gridlib;
\ No newline at end of file
@@ -0,0 +1,196 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+local ffi = require 'ffi';
+
+--[[
+* Entity Snapshot
+*
+* Copies selected fields of every valid entity into contiguous structure-of-arrays buffers, once per frame,
+* so per-frame consumers can iterate the entities with plain array loads instead of creating an entity object
+* per slot. (The same snapshot as the SDK's EntitySnapshot.h.)
+*
+* An entity is valid if it has an actor. (ie. it is spawned and rendered.) Entry n (0 based) of every array
+* belongs to the entity at snapshot.index[n]; arrays of fields that were not selected are left untouched.
+*
+* Each capture that changes the snapshot increments its generation. Consumers can store the generation they
+* last processed and skip their work while it has not changed.
+*
+* Usage:
+*
+*   local snap = entitysnapshot.new(T{ 'position', 'flags', });
+*   if (snap:capture()) then
+*       for n = 0, snap.count - 1 do
+*           print(snap.index[n], snap.x[n], snap.z[n], snap.spawn_flags[n]);
+*       end
+*   end
+--]]
+
+local MAX_ENTS = 2304;
+
+local entitysnapshot = T{
+    -- The available fields and the arrays they fill..
+    fields = T{
+        server_id   = T{ 'server_id', },
+        position    = T{ 'x', 'y', 'z', 'yaw', },
+        hpp         = T{ 'hpp', },
+        status      = T{ 'status', },
+        flags       = T{ 'type', 'spawn_flags', 'render_flags0', },
+        distance    = T{ 'distance', },
+        actor       = T{ 'actor', },
+    },
+
+    -- The array types of each field..
+    types = T{
+        index           = 'uint16_t[?]',
+        server_id       = 'uint32_t[?]',
+        x               = 'float[?]',
+        y               = 'float[?]',
+        z               = 'float[?]',
+        yaw             = 'float[?]',
+        hpp             = 'uint8_t[?]',
+        status          = 'uint32_t[?]',
+        type            = 'uint8_t[?]',
+        spawn_flags     = 'uint32_t[?]',
+        render_flags0   = 'uint32_t[?]',
+        distance        = 'float[?]',
+        actor           = 'uint32_t[?]',
+    },
+
+    frame = 0, -- The current frame number. (Incremented on each present.)
+};
+
+local snapshot = {};
+snapshot.__index = snapshot;
+
+---Creates a new entity snapshot.
+---@param fields table|nil The fields to capture. (server_id, position, hpp, status, flags, distance, actor; all if nil.)
+---@return table
+---@nodiscard
+entitysnapshot.new = function (fields)
+    local o = setmetatable({
+        count       = 0,
+        generation  = 0,
+        frame       = -1,
+    }, snapshot);
+
+    if (fields == nil) then
+        fields = entitysnapshot.fields:keys();
+    end
+
+    o.index = ffi.new(entitysnapshot.types.index, MAX_ENTS);
+    for _, f in ipairs(fields) do
+        local arrays = entitysnapshot.fields[f];
+        if (arrays == nil) then
+            error(('entitysnapshot: unknown field \'%s\''):fmt(tostring(f)));
+        end
+
+        arrays:each(function (v)
+            o[v] = ffi.new(entitysnapshot.types[v], MAX_ENTS);
+        end);
+    end
+
+    return o;
+end
+
+---Captures the selected fields of every valid entity. Captures at most once per frame.
+---@return boolean True if the snapshot changed, false otherwise.
+function snapshot:capture()
+    if (self.frame == entitysnapshot.frame) then
+        return false;
+    end
+    self.frame = entitysnapshot.frame;
+
+    local em        = AshitaCore:GetMemoryManager():GetEntity();
+    local changed   = false;
+    local n         = 0;
+
+    local index, server_id, x, y, z, yaw = self.index, self.server_id, self.x, self.y, self.z, self.yaw;
+    local hpp, status, etype, spawn_flags, render_flags0 = self.hpp, self.status, self.type, self.spawn_flags, self.render_flags0;
+    local distance, actor = self.distance, self.actor;
+
+    -- Stores a value into an array, flagging the snapshot as changed if it differs..
+    local function store(arr, v)
+        if (arr[n] ~= v) then
+            arr[n]  = v;
+            changed = true;
+        end
+    end
+
+    for idx = 0, MAX_ENTS - 1 do
+        local ptr = em:GetActorPointer(idx);
+        if (ptr ~= 0) then
+            store(index, idx);
+
+            if (server_id) then
+                store(server_id, em:GetServerId(idx));
+            end
+            if (x) then
+                store(x, em:GetLocalPositionX(idx));
+                store(y, em:GetLocalPositionY(idx));
+                store(z, em:GetLocalPositionZ(idx));
+                store(yaw, em:GetLocalPositionYaw(idx));
+            end
+            if (hpp) then
+                store(hpp, em:GetHPPercent(idx));
+            end
+            if (status) then
+                store(status, em:GetStatus(idx));
+            end
+            if (etype) then
+                store(etype, em:GetType(idx));
+                store(spawn_flags, em:GetSpawnFlags(idx));
+                store(render_flags0, em:GetRenderFlags0(idx));
+            end
+            if (distance) then
+                store(distance, em:GetDistance(idx));
+            end
+            if (actor) then
+                store(actor, ptr);
+            end
+
+            n = n + 1;
+        end
+    end
+
+    if (self.count ~= n) then
+        self.count  = n;
+        changed     = true;
+    end
+
+    if (changed) then
+        self.generation = self.generation + 1;
+    end
+
+    return changed;
+end
+
+--[[
+* event: d3d_present
+* desc : Event called when the Direct3D device is presenting a scene.
+--]]
+ashita.events.register('d3d_present', '__entitysnapshot_present_cb', function ()
+    entitysnapshot.frame = entitysnapshot.frame + 1;
+end);
+
+return entitysnapshot;
\ No newline at end of file
@@ -0,0 +1,208 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+local chat = require 'chat';
+
+--[[
+* Inventory Index
+*
+* Aggregates the players containers by item id; holding the total count of each item and the slots it is
+* stored in. (The same index as the SDK's InventoryIndex.h.)
+*
+* The index is only refreshed when the inventory ContainerUpdateCounter has changed, so lookups cost a single
+* call while nothing changes. When it does change, only the changed slots touch the index, and the changed
+* slots are passed to every registered change callback.
+*
+* The temporary recycle bin container is not indexed.
+*
+* Usage:
+*
+*   local inventoryindex = require 'ffxi.inventoryindex';
+*   local total = inventoryindex.get_item_total(4096);
+*
+*   inventoryindex.register('my_cb', function (changes)
+*       changes:each(function (v)
+*           print(v.container, v.index, v.old_id, v.new_id, v.old_count, v.new_count);
+*       end);
+*   end);
+--]]
+
+local MAX_CONTAINERS    = 17;
+local MAX_SLOTS         = 81;
+
+local inventoryindex = T{
+    counter     = nil,  -- The update counter the index was last updated with..
+    ids         = T{},  -- The item id in each slot. (Keyed by container * 81 + index.)
+    counts      = T{},  -- The item count in each slot. (Keyed by container * 81 + index.)
+    totals      = T{},  -- The total count of each item id..
+    slots       = T{},  -- The slots holding each item id. (Keyed by container * 81 + index.)
+    callbacks   = T{},  -- The registered change callbacks..
+};
+
+local function link(id, count, key)
+    if (id == 0) then
+        return;
+    end
+
+    inventoryindex.totals[id] = (inventoryindex.totals[id] or 0) + count;
+
+    local s = inventoryindex.slots[id];
+    if (s == nil) then
+        s = T{};
+        inventoryindex.slots[id] = s;
+    end
+    s[key] = true;
+end
+
+local function unlink(id, count, key)
+    if (id == 0) then
+        return;
+    end
+
+    local total = (inventoryindex.totals[id] or 0) - count;
+    inventoryindex.totals[id] = total > 0 and total or nil;
+
+    local s = inventoryindex.slots[id];
+    if (s ~= nil) then
+        s[key] = nil;
+        if (next(s) == nil) then
+            inventoryindex.slots[id] = nil;
+        end
+    end
+end
+
+---Updates the index, if the inventory contents have changed.
+---@param force boolean|nil Flag to refresh the index even if the update counter has not changed.
+---@return table|nil The changed slots if any slot changed, nil otherwise.
+inventoryindex.update = function (force)
+    local inv     = AshitaCore:GetMemoryManager():GetInventory();
+    local counter = inv:GetContainerUpdateCounter();
+    if (not force and counter == inventoryindex.counter) then
+        return nil;
+    end
+    inventoryindex.counter = counter;
+
+    local changes = T{};
+    for c = 0, MAX_CONTAINERS - 1 do
+        for x = 0, MAX_SLOTS - 1 do
+            local item  = inv:GetContainerItem(c, x);
+            local id    = 0;
+            local count = 0;
+            if (item ~= nil and item.Id ~= 0 and item.Id ~= 65535) then
+                id      = item.Id;
+                count   = item.Count;
+            end
+
+            local key   = c * MAX_SLOTS + x;
+            local oid   = inventoryindex.ids[key] or 0;
+            local ocnt  = inventoryindex.counts[key] or 0;
+            if (oid ~= id or ocnt ~= count) then
+                changes:append(T{
+                    container   = c,
+                    index       = x,
+                    old_id      = oid,
+                    new_id      = id,
+                    old_count   = ocnt,
+                    new_count   = count,
+                });
+
+                unlink(oid, ocnt, key);
+                link(id, count, key);
+
+                inventoryindex.ids[key]     = id;
+                inventoryindex.counts[key]  = count;
+            end
+        end
+    end
+
+    if (#changes == 0) then
+        return nil;
+    end
+
+    inventoryindex.callbacks:each(function (cb)
+        local res, err = pcall(cb, changes);
+        if (not res) then
+            print(chat.header(addon.name):append(chat.error('[lib.inventoryindex] Callback error: ')):append(chat.error(tostring(err))));
+        end
+    end);
+
+    return changes;
+end
+
+---Returns the total count of the given item across the indexed containers.
+---@param id number The item id.
+---@return number
+---@nodiscard
+inventoryindex.get_item_total = function (id)
+    inventoryindex.update();
+    return inventoryindex.totals[id] or 0;
+end
+
+---Returns the slots holding the given item.
+---@param id number The item id.
+---@return table A table of slots, each holding the container and index of the slot.
+---@nodiscard
+inventoryindex.get_item_slots = function (id)
+    inventoryindex.update();
+
+    local ret = T{};
+    local s   = inventoryindex.slots[id];
+    if (s ~= nil) then
+        for key, _ in pairs(s) do
+            ret:append(T{ container = math.floor(key / MAX_SLOTS), index = key % MAX_SLOTS, });
+        end
+        ret:sort(function (a, b)
+            if (a.container ~= b.container) then
+                return a.container < b.container;
+            end
+            return a.index < b.index;
+        end);
+    end
+    return ret;
+end
+
+---Registers a callback invoked with the changed slots whenever the inventory changes.
+---@param alias string The callback alias.
+---@param callback function The callback function.
+inventoryindex.register = function (alias, callback)
+    inventoryindex.callbacks[alias] = callback;
+end
+
+---Unregisters a previously registered change callback.
+---@param alias string The callback alias.
+inventoryindex.unregister = function (alias)
+    inventoryindex.callbacks[alias] = nil;
+end
+
+--[[
+* event: d3d_present
+* desc : Event called when the Direct3D device is presenting a scene.
+--]]
+ashita.events.register('d3d_present', '__inventoryindex_present_cb', function ()
+    -- Poll for changes only while callbacks are registered; lookups update the index themselves..
+    if (next(inventoryindex.callbacks) ~= nil) then
+        inventoryindex.update();
+    end
+end);
+
+return inventoryindex;
\ No newline at end of file
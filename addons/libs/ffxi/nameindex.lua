@@ -0,0 +1,361 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+--[[
+* Name Index
+*
+* Indexes the names of a resource table (ie. the item names of a language, or a d_msg string table) for
+* fast reverse lookups and searches, instead of calling into the resource manager for every id of the table
+* on each search. (The same index as the SDK's NameIndex.h.)
+*
+* Names are case-folded (ASCII only; the trail bytes of Shift-JIS characters are left as-is) so every lookup
+* is case-insensitive. Each index is built once, the first time it is requested, and cached for the session.
+*
+* Usage:
+*
+*   local nameindex = require 'ffxi.nameindex';
+*   local items = nameindex.items();
+*
+*   local id = items:find('Hi-Potion');
+*   items:find_substring('potion'):each(function (v)
+*       print(v, items:get_name(v));
+*   end);
+*
+*   local keyitems = nameindex.strings('keyitems.names');
+--]]
+
+local nameindex = T{
+    cache = T{}, -- The built indexes, keyed by source..
+};
+
+local index = {};
+index.__index = index;
+
+---Returns the case-folded copy of the given string.
+---@param str string The string to fold.
+---@return string
+---@nodiscard
+local function fold(str)
+    if (not str:find('[\128-\255]')) then
+        return str:lower();
+    end
+
+    -- Skip the trail byte of Shift-JIS characters, which can fall within the ASCII letters..
+    local ret = T{};
+    local x   = 1;
+    while (x <= #str) do
+        local c = str:byte(x);
+        if ((c >= 0x81 and c <= 0x9F) or (c >= 0xE0 and c <= 0xFC)) then
+            ret:append(str:sub(x, x + 1));
+            x = x + 2;
+        else
+            ret:append(str:sub(x, x):lower());
+            x = x + 1;
+        end
+    end
+    return ret:concat();
+end
+
+---Creates a new name index.
+---@param count number The number of ids to read.
+---@param getter function The function returning the name of an id. (nil or empty names are skipped.)
+---@return table
+---@nodiscard
+nameindex.new = function (count, getter)
+    local o = setmetatable({
+        ids     = T{},  -- The indexed ids, in ascending order..
+        names   = T{},  -- The name of each entry..
+        folded  = T{},  -- The folded name of each entry..
+        by_id   = T{},  -- The entry of each id..
+        by_name = T{},  -- The entries of each folded name..
+        sorted  = T{},  -- The entries, ordered by folded name..
+    }, index);
+
+    for x = 0, count - 1 do
+        local name = getter(x);
+        if (name ~= nil and name:len() > 0) then
+            local n = #o.ids + 1;
+            o.ids[n]    = x;
+            o.names[n]  = name;
+            o.folded[n] = fold(name);
+            o.by_id[x]  = n;
+
+            local f = o.folded[n];
+            if (o.by_name[f] == nil) then
+                o.by_name[f] = T{};
+            end
+            o.by_name[f]:append(n);
+
+            o.sorted[n] = n;
+        end
+    end
+
+    table.sort(o.sorted, function (a, b)
+        if (o.folded[a] ~= o.folded[b]) then
+            return o.folded[a] < o.folded[b];
+        end
+        return a < b;
+    end);
+
+    return o;
+end
+
+---Returns the cached index of a source, building it if needed.
+---@param key string The cache key.
+---@param count number The number of ids to read.
+---@param getter function The function returning the name of an id.
+---@return table
+---@nodiscard
+local function get_cached(key, count, getter)
+    local idx = nameindex.cache[key];
+    if (idx == nil) then
+        idx = nameindex.new(count, getter);
+        nameindex.cache[key] = idx;
+    end
+    return idx;
+end
+
+---Returns the index of the item names of the given language.
+---@param lang number|nil The language index. (1 = Default, 2 = Japanese, 3 = English; 1 if nil.)
+---@return table
+---@nodiscard
+nameindex.items = function (lang)
+    lang = lang or 1;
+    return get_cached(('items:%d'):fmt(lang), 65536, function (id)
+        local item = AshitaCore:GetResourceManager():GetItemById(id);
+        return item ~= nil and item.Name[lang] or nil;
+    end);
+end
+
+---Returns the index of the ability names of the given language.
+---@param lang number|nil The language index. (1 = Default, 2 = Japanese, 3 = English; 1 if nil.)
+---@return table
+---@nodiscard
+nameindex.abilities = function (lang)
+    lang = lang or 1;
+    return get_cached(('abilities:%d'):fmt(lang), 4096, function (id)
+        local ability = AshitaCore:GetResourceManager():GetAbilityById(id);
+        return ability ~= nil and ability.Name[lang] or nil;
+    end);
+end
+
+---Returns the index of the spell names of the given language.
+---@param lang number|nil The language index. (1 = Default, 2 = Japanese, 3 = English; 1 if nil.)
+---@return table
+---@nodiscard
+nameindex.spells = function (lang)
+    lang = lang or 1;
+    return get_cached(('spells:%d'):fmt(lang), 1024, function (id)
+        local spell = AshitaCore:GetResourceManager():GetSpellById(id);
+        return spell ~= nil and spell.Name[lang] or nil;
+    end);
+end
+
+---Returns the index of a string table of the given language.
+---@param name string The string table name. (ie. keyitems.names)
+---@param lang number|nil The language id. (0 = Default, 1 = Japanese, 2 = English; the client language if nil.)
+---@param count number|nil The number of string indexes to read. (65536 if nil.)
+---@return table
+---@nodiscard
+nameindex.strings = function (name, lang, count)
+    return get_cached(('strings:%s:%s'):fmt(name, tostring(lang)), count or 65536, function (id)
+        if (lang == nil) then
+            return AshitaCore:GetResourceManager():GetString(name, id);
+        end
+        return AshitaCore:GetResourceManager():GetString(name, id, lang);
+    end);
+end
+
+---Returns the ids of the given entries, ordered by id.
+---@param entries table The entry numbers.
+---@param max number|nil The maximum number of ids to return.
+---@return table
+---@nodiscard
+function index:collect(entries, max)
+    table.sort(entries);
+
+    local ret = T{};
+    for _, n in ipairs(entries) do
+        if (max ~= nil and #ret >= max) then
+            break;
+        end
+        ret:append(self.ids[n]);
+    end
+    return ret;
+end
+
+---Returns the number of names in the index.
+---@return number
+---@nodiscard
+function index:get_count()
+    return #self.ids;
+end
+
+---Returns the name of the given id.
+---@param id number The resource id.
+---@return string|nil
+---@nodiscard
+function index:get_name(id)
+    local n = self.by_id[id];
+    return n ~= nil and self.names[n] or nil;
+end
+
+---Returns the lowest id of the given name. (Case-insensitive.)
+---@param name string The name to find.
+---@return number|nil
+---@nodiscard
+function index:find(name)
+    local e = self.by_name[fold(name)];
+    return e ~= nil and self.ids[e[1]] or nil;
+end
+
+---Returns the ids of the given name. (Case-insensitive.)
+---@param name string The name to find.
+---@return table
+---@nodiscard
+function index:find_all(name)
+    local e = self.by_name[fold(name)];
+    return e ~= nil and self:collect(e:copy()) or T{};
+end
+
+---Returns the ids of the names starting with the given prefix. (Case-insensitive.)
+---@param prefix string The prefix to find.
+---@param max number|nil The maximum number of ids to return.
+---@return table
+---@nodiscard
+function index:find_prefix(prefix, max)
+    prefix = fold(prefix);
+    if (prefix:len() == 0) then
+        return T{};
+    end
+
+    -- Find the first name not ordered before the prefix..
+    local lo, hi = 1, #self.sorted + 1;
+    while (lo < hi) do
+        local mid = math.floor((lo + hi) / 2);
+        if (self.folded[self.sorted[mid]] < prefix) then
+            lo = mid + 1;
+        else
+            hi = mid;
+        end
+    end
+
+    local entries = T{};
+    local len     = prefix:len();
+    while (lo <= #self.sorted and self.folded[self.sorted[lo]]:sub(1, len) == prefix) do
+        entries:append(self.sorted[lo]);
+        lo = lo + 1;
+    end
+    return self:collect(entries, max);
+end
+
+---Returns the ids of the names containing the given string. (Case-insensitive.)
+---@param str string The string to find.
+---@param max number|nil The maximum number of ids to return.
+---@return table
+---@nodiscard
+function index:find_substring(str, max)
+    str = fold(str);
+    if (str:len() == 0) then
+        return T{};
+    end
+
+    local ret = T{};
+    for n = 1, #self.folded do
+        if (max ~= nil and #ret >= max) then
+            break;
+        end
+        if (self.folded[n]:find(str, 1, true) ~= nil) then
+            ret:append(self.ids[n]);
+        end
+    end
+    return ret;
+end
+
+---Returns the ids of the names approximately containing the given string. (Case-insensitive.)
+---@param str string The string to find.
+---@param max_distance number|nil The maximum number of edits between the string and the best matching part of a name. (2 if nil.)
+---@param max number|nil The maximum number of ids to return.
+---@return table The ids, ordered by their distance, then by id.
+---@nodiscard
+function index:find_fuzzy(str, max_distance, max)
+    str          = fold(str);
+    max_distance = max_distance or 2;
+
+    local len = str:len();
+    if (len == 0) then
+        return T{};
+    end
+
+    local chars = T{ str:byte(1, len) };
+    local found = T{};
+    local col   = T{};
+
+    for n = 1, #self.folded do
+        local name = self.folded[n];
+
+        -- Names shorter than the string by more than the distance cannot match..
+        if (name:len() + max_distance >= len) then
+            -- Edit distance of the string against the best matching part of the name. (Free leading and trailing characters.)
+            for y = 0, len do
+                col[y] = y;
+            end
+
+            local best = col[len];
+            for y = 1, name:len() do
+                local c     = name:byte(y);
+                local diag  = col[0];
+                for z = 1, len do
+                    local prev  = col[z];
+                    col[z]      = math.min(col[z] + 1, col[z - 1] + 1, diag + (chars[z] == c and 0 or 1));
+                    diag        = prev;
+                end
+                if (col[len] < best) then
+                    best = col[len];
+                end
+            end
+
+            if (best <= max_distance) then
+                found:append(T{ best, n });
+            end
+        end
+    end
+
+    table.sort(found, function (a, b)
+        if (a[1] ~= b[1]) then
+            return a[1] < b[1];
+        end
+        return a[2] < b[2];
+    end);
+
+    local ret = T{};
+    for _, v in ipairs(found) do
+        if (max ~= nil and #ret >= max) then
+            break;
+        end
+        ret:append(self.ids[v[2]]);
+    end
+    return ret;
+end
+
+return nameindex;
\ No newline at end of file
@@ -22,8 +22,9 @@
 require 'common';
 require 'win32types';
 
-local chat  = require 'chat';
-local ffi   = require 'ffi';
+local chat       = require 'chat';
+local entitygrid = require 'ffxi.entitygrid';
+local ffi        = require 'ffi';
 
 ffi.cdef[[
     typedef struct {
@@ -133,34 +134,23 @@ targetslib.get_ht = function ()
         return nil;
     end
 
-    local dst = 0.0;
-    local ent = nil;
-
-    table.range(0, 2302)
-        :map(GetEntity)
-        :filter(function (e)
-            if (e.ActorPointer == nil) then
-                return false;
-            end
-            if (bit.band(e.Render.Flags0, 0x2000) == 0 or bit.band(e.Render.Flags1, 0x1000000) == 0) then
-                return false;
-            end
-            if (e.Status == 2 or e.Status == 3) then
+    local em  = AshitaCore:GetMemoryManager():GetEntity();
+    local idx = entitygrid.nearest(player.Movement.LocalPosition.X, player.Movement.LocalPosition.Z, 1, T{
+        exclude         = AshitaCore:GetMemoryManager():GetParty():GetMemberTargetIndex(0),
+        render_flags0   = 0x2000,
+        func            = function (x)
+            if (bit.band(em:GetRenderFlags1(x), 0x1000000) == 0) then
                 return false;
             end
-            return true;
-        end)
-        :each(function (e)
-            local x = (player.Movement.LocalPosition.X - e.Movement.LocalPosition.X);
-            local y = (player.Movement.LocalPosition.Z - e.Movement.LocalPosition.Z) * -1.0;
-            local d = math.sqrt(y * y + x * x);
-            if (dst == 0.0 or d < dst) then
-                dst = d;
-                ent = e;
-            end
-        end);
+            local status = em:GetStatus(x);
+            return status ~= 2 and status ~= 3;
+        end,
+    })[1];
 
-    return ent;
+    if (idx == nil) then
+        return nil;
+    end
+    return GetEntity(idx);
 end
 
 ---Returns the entity of the last selected target.
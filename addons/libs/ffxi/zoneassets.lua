@@ -0,0 +1,251 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+local dats  = require 'ffxi.dats';
+local ffi   = require 'ffi';
+
+--[[
+* Zone Assets
+*
+* Caches the parsed assets (npc list) of zones, and prefetches the assets of the likely next zone while the
+* client is zoning, so they are ready when the zone is entered. (The same cache as the SDK's ZoneAssetCache.h.)
+*
+* The Zone Exit (0x000B) packet does not hold the destination zone, so the likely destinations are learned
+* from the zone changes seen this session. Prefetched zones are parsed over several frames, a few entries per
+* frame, so prefetching does not stall the client while it loads the zone. A zone that is requested before its
+* prefetch completes is finished immediately.
+*
+* Assets are cached per zone id and sub id; the least recently used zones are dropped once the cache is full.
+*
+* Usage:
+*
+*   local zoneassets = require 'ffxi.zoneassets';
+*
+*   local assets = zoneassets.get(zid, zsubid);
+*   assets.npcs:each(function (v)
+*       print(v.id, v.index, v.name);
+*   end);
+--]]
+
+local zoneassets = T{
+    cache       = T{},  -- The cached zone assets, keyed by zone key..
+    order       = T{},  -- The cached zone keys, least recently used first..
+    max_zones   = 8,    -- The maximum number of cached zones..
+    transitions = T{},  -- The zones entered from each zone, most recent first. (Keyed by zone key.)
+    current     = nil,  -- The current zone key..
+    pending     = T{},  -- The zone keys queued for prefetching..
+    job         = nil,  -- The prefetch currently parsing. (Holds the zone key and coroutine.)
+    budget      = 128,  -- The number of npc entries parsed per frame while prefetching..
+};
+
+local MAX_TRANSITIONS = 3;
+
+---Returns the cache key of a zone.
+---@param zid number The zone id.
+---@param zsubid number The zone sub id.
+---@return number
+---@nodiscard
+local function get_key(zid, zsubid)
+    return zid * 65536 + zsubid;
+end
+
+---Parses the assets of a zone. Yields every budget entries, if a budget is given.
+---@param key number The zone key.
+---@param budget number|nil The number of entries to parse between yields.
+---@return table|nil
+local function parse(key, budget)
+    local zid       = math.floor(key / 65536);
+    local zsubid    = key % 65536;
+    local assets    = T{ zone_id = zid, sub_id = zsubid, npcs = T{}, };
+
+    local view = dats.get_zone_npclist_view(zid, zsubid);
+    if (view == nil or (view.size % 0x20) ~= 0) then
+        return nil;
+    end
+
+    -- Parse the npc list; each entry is a 28 byte name followed by the npc server id..
+    for x = 0, (view.size / 0x20) - 1 do
+        local entry = view.data + (x * 0x20);
+        local id    = ffi.cast('const uint32_t*', entry + 28)[0];
+
+        assets.npcs:append(T{
+            id      = id,
+            index   = bit.band(id, 0x0FFF),
+            name    = ffi.string(entry, 28):trim('\0'),
+        });
+
+        if (budget ~= nil and ((x + 1) % budget) == 0) then
+            coroutine.yield();
+        end
+    end
+
+    return assets;
+end
+
+---Stores the assets of a zone in the cache, dropping the least recently used zones if full.
+---@param key number The zone key.
+---@param assets table The zone assets.
+local function store(key, assets)
+    if (zoneassets.cache[key] == nil) then
+        zoneassets.order:append(key);
+    end
+    zoneassets.cache[key] = assets;
+
+    while (#zoneassets.order > zoneassets.max_zones) do
+        zoneassets.cache[table.remove(zoneassets.order, 1)] = nil;
+    end
+end
+
+---Returns the assets of a zone, parsing them if they are not cached.
+---@param zid number The zone id. (Zone Enter (0x000A) offset 0x30.)
+---@param zsubid number The zone sub id. (Zone Enter (0x000A) offset 0x9E.)
+---@return table|nil
+zoneassets.get = function (zid, zsubid)
+    local key = get_key(zid, zsubid);
+
+    local assets = zoneassets.cache[key];
+    if (assets ~= nil) then
+        zoneassets.order:delete(key);
+        zoneassets.order:append(key);
+        return assets;
+    end
+
+    -- Finish the zones prefetch if it is parsing, otherwise parse the zone now..
+    local job = zoneassets.job;
+    if (job ~= nil and job.key == key) then
+        while (coroutine.status(job.co) ~= 'dead') do
+            coroutine.resume(job.co);
+        end
+        assets = job.assets;
+        zoneassets.job = nil;
+    else
+        assets = parse(key, nil);
+    end
+
+    zoneassets.pending:delete(key);
+    if (assets ~= nil) then
+        store(key, assets);
+    end
+
+    return assets;
+end
+
+---Returns the assets of the current zone.
+---@return table|nil
+zoneassets.get_current = function ()
+    if (zoneassets.current == nil) then
+        return nil;
+    end
+    return zoneassets.get(math.floor(zoneassets.current / 65536), zoneassets.current % 65536);
+end
+
+---Queues the assets of a zone to be prefetched, if they are not already cached.
+---@param zid number The zone id.
+---@param zsubid number The zone sub id.
+zoneassets.prefetch = function (zid, zsubid)
+    local key = get_key(zid, zsubid);
+    if (zoneassets.cache[key] ~= nil or zoneassets.pending:hasval(key) or (zoneassets.job ~= nil and zoneassets.job.key == key)) then
+        return;
+    end
+    zoneassets.pending:append(key);
+end
+
+--[[
+* event: packet_in
+* desc : Event called when the addon is processing incoming packets.
+--]]
+ashita.events.register('packet_in', '__zoneassets_packet_in_cb', function (e)
+    -- Packet: Zone Enter
+    if (e.id == 0x000A) then
+        if (struct.unpack('b', e.data_modified, 0x80 + 0x01) == 1) then
+            return;
+        end
+
+        local zid   = struct.unpack('H', e.data_modified, 0x30 + 0x01);
+        local sid   = struct.unpack('H', e.data_modified, 0x9E + 0x01);
+        local key   = get_key(zid, sid);
+
+        -- Remember the zone change, most recent destination first..
+        local prev = zoneassets.current;
+        if (prev ~= nil and prev ~= key) then
+            local dests = zoneassets.transitions[prev] or T{};
+            dests:delete(key);
+            table.insert(dests, 1, key);
+            if (#dests > MAX_TRANSITIONS) then
+                table.remove(dests);
+            end
+            zoneassets.transitions[prev] = dests;
+        end
+
+        zoneassets.current = key;
+        zoneassets.get(zid, sid);
+        return;
+    end
+
+    -- Packet: Zone Exit
+    if (e.id == 0x000B) then
+        -- Ignore logouts..
+        if (struct.unpack('b', e.data, 0x04 + 0x01) == 1 or zoneassets.current == nil) then
+            return;
+        end
+
+        local dests = zoneassets.transitions[zoneassets.current];
+        if (dests ~= nil) then
+            dests:each(function (v)
+                zoneassets.prefetch(math.floor(v / 65536), v % 65536);
+            end);
+        end
+        return;
+    end
+end);
+
+--[[
+* event: d3d_present
+* desc : Event called when the Direct3D device is presenting a scene.
+--]]
+ashita.events.register('d3d_present', '__zoneassets_present_cb', function ()
+    -- Start the next queued prefetch..
+    if (zoneassets.job == nil) then
+        if (#zoneassets.pending == 0) then
+            return;
+        end
+
+        local job = T{ key = table.remove(zoneassets.pending, 1), };
+        job.co = coroutine.create(function ()
+            job.assets = parse(job.key, zoneassets.budget);
+        end);
+        zoneassets.job = job;
+    end
+
+    -- Parse the next part of the prefetch..
+    local job = zoneassets.job;
+    coroutine.resume(job.co);
+    if (coroutine.status(job.co) == 'dead') then
+        zoneassets.job = nil;
+        if (job.assets ~= nil and zoneassets.cache[job.key] == nil) then
+            store(job.key, job.assets);
+        end
+    end
+end);
+
+return zoneassets;
\ No newline at end of file
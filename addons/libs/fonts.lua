@@ -72,6 +72,12 @@ local fontlib = T{
             color           = 0xFFFFFFFF,
         },
     },
+    stats = T{
+        updates         = 0, -- The number of property sets applied during the current frame..
+        skipped         = 0, -- The number of property sets skipped during the current frame, as the value was unchanged..
+        last_updates    = 0, -- The number of property sets applied during the last frame..
+        last_skipped    = 0, -- The number of property sets skipped during the last frame..
+    },
     mouse_events = T{
         [0x200] = 'mouse_move',
         [0x201] = 'left_click_down',
@@ -209,6 +215,28 @@ fontlib.methods_bg = T{
     },
 };
 
+--[[
+* Forwards a property set to the given object, skipping it if the value is unchanged.
+*
+* @param {userdata} obj - The font object (or font object background) to set the property of.
+* @param {table} m - The method forwards of the property.
+* @param {any} v - The value to set.
+* @note
+*   Setting a font property marks the font dirty, causing it to be rebuilt on the next render, even if the value did not
+*   change. Addons commonly set their font properties every frame, so unchanged values are skipped by comparing against
+*   the current value first.
+--]]
+local function set_property(obj, m, v)
+    local g = m[1];
+    if (type(g) == 'string' and obj[g] ~= nil and obj[g](obj) == v) then
+        fontlib.stats.skipped = fontlib.stats.skipped + 1;
+        return;
+    end
+
+    fontlib.stats.updates = fontlib.stats.updates + 1;
+    obj[m[2]](obj, v);
+end
+
 --[[
 * Font Object Wrapper Metatable Overrides
 *
@@ -259,7 +287,7 @@ fontlib.fontobj_mt = {
         if (fontlib.methods:containskey(k)) then
             local f = fontlib.methods[k][2];
             if (type(f) == 'string') then
-                self.obj[f](self.obj, v);
+                set_property(self.obj, fontlib.methods[k], v);
             elseif (type(f) == 'function') then
                 f(self.obj, v);
             end
@@ -323,7 +351,7 @@ fontlib.fontobj_bg_mt = {
         if (fontlib.methods_bg:containskey(k)) then
             local f = fontlib.methods_bg[k][2];
             if (type(f) == 'string') then
-                self.obj[f](self.obj, v);
+                set_property(self.obj, fontlib.methods_bg[k], v);
             elseif (type(f) == 'function') then
                 f(self.obj, v);
             end
@@ -362,6 +390,18 @@ do
         end);
     end
 
+    --[[
+    * event: d3d_present
+    * desc : Event called when the Direct3D device is presenting a scene.
+    --]]
+    ashita.events.register('d3d_present', '__fontlib_present_cb', function ()
+        -- Roll the font property set counters over to the next frame..
+        fontlib.stats.last_updates  = fontlib.stats.updates;
+        fontlib.stats.last_skipped  = fontlib.stats.skipped;
+        fontlib.stats.updates       = 0;
+        fontlib.stats.skipped       = 0;
+    end);
+
     --[[
     * event: mouse
     * desc : Event called when the addon is processing mouse input. (WNDPROC)
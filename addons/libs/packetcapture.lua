@@ -0,0 +1,291 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+local ffi = require 'ffi';
+
+ffi.cdef[[
+    typedef struct packetcaptureheader_t {
+        char        Magic[4];
+        uint16_t    Version;
+        uint16_t    Size;
+        uint64_t    StartTime;
+    } packetcaptureheader_t;
+
+    typedef struct packetcapturerecord_t {
+        uint32_t    Length;
+        uint16_t    Id;
+        uint16_t    Size;
+        uint8_t     Direction;
+        uint8_t     Flags;
+        uint16_t    Reserved;
+        uint32_t    Sequence;
+        uint64_t    Timestamp;
+    } packetcapturerecord_t;
+]];
+
+--[[
+* Packet Capture
+*
+* Reads and writes packet capture files. (The same format as the SDK's PacketCapture.h.) Captures can be
+* written from an addons packet_in and packet_out events, and replayed through a set of packet handlers
+* outside of a live session to measure their cost.
+--]]
+
+-- Packet capture library table..
+local capture = T{
+    FLAG_INJECTED   = 0x01,
+    FLAG_BLOCKED    = 0x02,
+    VERSION         = 1,
+};
+
+-- Timer used to measure handler durations, in nanoseconds..
+local qpc   = ashita.time.query_performance_counter;
+local scale = 1e9 / ashita.time.query_performance_frequency().q;
+local function timer()
+    return qpc().q * scale;
+end
+
+--[[
+* Packet Capture Writer
+--]]
+
+---@class PacketCaptureWriter
+---@field file file* The open capture file.
+---@field sequence number The next record sequence number.
+---@field start number The time the capture was started, in nanoseconds.
+---@field record ffi.cdata* The reusable record header.
+local writer = T{};
+writer.__index = writer;
+
+--[[
+* Opens a new capture file, replacing any existing file.
+*
+* @param {string} path - The path to the capture file.
+* @return {PacketCaptureWriter|nil} The writer on success, nil otherwise.
+--]]
+function capture.open_writer(path)
+    local f = io.open(path, 'wb');
+    if (f == nil) then
+        return nil;
+    end
+
+    local header = ffi.new('packetcaptureheader_t');
+    ffi.copy(header.Magic, 'APKT', 4);
+    header.Version      = capture.VERSION;
+    header.Size         = ffi.sizeof('packetcaptureheader_t');
+    header.StartTime    = os.time() * 1000;
+
+    f:write(ffi.string(header, ffi.sizeof(header)));
+
+    return setmetatable({
+        file        = f,
+        sequence    = 0,
+        start       = timer(),
+        record      = ffi.new('packetcapturerecord_t'),
+    }, writer);
+end
+
+--[[
+* Writes a packet to the capture file.
+*
+* @param {PacketCaptureWriter} self - The writer object.
+* @param {string} direction - The packet direction. ('in' or 'out')
+* @param {number} id - The packet id.
+* @param {string} data - The packet data.
+* @param {boolean|nil} injected - Flag if the packet was injected.
+* @param {boolean|nil} blocked - Flag if the packet was blocked.
+--]]
+function writer:write(direction, id, data, injected, blocked)
+    if (self.file == nil) then
+        return;
+    end
+
+    local size  = data:len();
+    local len   = bit.band(ffi.sizeof('packetcapturerecord_t') + size + 7, bit.bnot(7));
+    local r     = self.record;
+
+    r.Length    = len;
+    r.Id        = id;
+    r.Size      = size;
+    r.Direction = direction == 'in' and 0 or 1;
+    r.Flags     = bit.bor(injected and capture.FLAG_INJECTED or 0, blocked and capture.FLAG_BLOCKED or 0);
+    r.Sequence  = self.sequence;
+    r.Timestamp = timer() - self.start;
+
+    self.sequence = self.sequence + 1;
+
+    self.file:write(ffi.string(r, ffi.sizeof(r)), data, ('\0'):rep(len - ffi.sizeof(r) - size));
+end
+
+--[[
+* Flushes and closes the capture file.
+*
+* @param {PacketCaptureWriter} self - The writer object.
+--]]
+function writer:close()
+    if (self.file ~= nil) then
+        self.file:close();
+        self.file = nil;
+    end
+end
+
+--[[
+* Reads every record of the given capture file.
+*
+* @param {string} path - The path to the capture file.
+* @return {table|nil} The records on success, nil otherwise. (Each record holds: id, direction, data, injected, blocked, sequence, timestamp)
+--]]
+function capture.read(path)
+    local f = io.open(path, 'rb');
+    if (f == nil) then
+        return nil;
+    end
+
+    local raw = f:read('*a');
+    f:close();
+
+    local hsize = ffi.sizeof('packetcaptureheader_t');
+    if (raw:len() < hsize) then
+        return nil;
+    end
+
+    local ptr       = ffi.cast('const uint8_t*', raw);
+    local header    = ffi.cast('const packetcaptureheader_t*', ptr);
+    if (ffi.string(header.Magic, 4) ~= 'APKT' or header.Version ~= capture.VERSION or header.Size < hsize) then
+        return nil;
+    end
+
+    local ret   = T{};
+    local rsize = ffi.sizeof('packetcapturerecord_t');
+    local off   = header.Size;
+
+    while (off + rsize <= raw:len()) do
+        local r = ffi.cast('const packetcapturerecord_t*', ptr + off);
+        if (r.Length < rsize + r.Size or off + r.Length > raw:len()) then
+            break;
+        end
+
+        ret:append(T{
+            id          = r.Id,
+            direction   = r.Direction == 0 and 'in' or 'out',
+            data        = ffi.string(ptr + off + rsize, r.Size),
+            injected    = bit.band(r.Flags, capture.FLAG_INJECTED) ~= 0,
+            blocked     = bit.band(r.Flags, capture.FLAG_BLOCKED) ~= 0,
+            sequence    = r.Sequence,
+            timestamp   = tonumber(r.Timestamp),
+        });
+
+        off = off + r.Length;
+    end
+
+    return ret;
+end
+
+--[[
+* Returns the summary of the given sorted durations.
+--]]
+local function summarize(name, times)
+    local count = #times;
+    if (count == 0) then
+        return T{ name = name, count = 0, mean = 0, p50 = 0, p90 = 0, p99 = 0, max = 0, };
+    end
+
+    table.sort(times);
+
+    local total = 0;
+    for x = 1, count do
+        total = total + times[x];
+    end
+
+    local function pct(p)
+        return times[math.max(1, math.ceil(count * p / 100))];
+    end
+
+    return T{ name = name, count = count, mean = total / count, p50 = pct(50), p90 = pct(90), p99 = pct(99), max = times[count], };
+end
+
+--[[
+* Replays the given records through a set of packet handlers as fast as possible, timing each handler.
+*
+* Handlers are called with an event table similar to the one passed to the packet_in and packet_out events.
+* (id, size, data, data_modified, injected, blocked) Handlers are called in the given order, and a handler
+* blocking a packet (e.blocked = true) is passed on to the following handlers.
+*
+* @param {table} records - The records to replay. (See: capture.read)
+* @param {table} handlers - The handlers to replay through. ({ { name = 'name', packet_in = func, packet_out = func, }, ... })
+* @param {number|nil} iterations - The number of times to replay the records. (Default: 1)
+* @return {table} The per-handler timing summaries, in nanoseconds. ({ name, count, mean, p50, p90, p99, max })
+--]]
+function capture.replay(records, handlers, iterations)
+    local times = T{};
+    for x = 1, #handlers do
+        times[x] = T{};
+    end
+
+    local e = T{};
+    for _ = 1, iterations or 1 do
+        for _, r in ipairs(records) do
+            local event = r.direction == 'in' and 'packet_in' or 'packet_out';
+
+            e.id            = r.id;
+            e.size          = r.data:len();
+            e.data          = r.data;
+            e.data_modified = r.data;
+            e.injected      = r.injected;
+            e.blocked       = r.blocked;
+
+            for x = 1, #handlers do
+                local cb = handlers[x][event];
+                if (cb ~= nil) then
+                    local s = timer();
+                    cb(e);
+                    local t = times[x];
+                    t[#t + 1] = timer() - s;
+                end
+            end
+        end
+    end
+
+    local ret = T{};
+    for x = 1, #handlers do
+        ret:append(summarize(handlers[x].name or tostring(x), times[x]));
+    end
+
+    return ret;
+end
+
+--[[
+* Returns a printable report of the given replay summaries.
+*
+* @param {table} summaries - The replay summaries. (See: capture.replay)
+* @return {string} The report, one line per handler.
+--]]
+function capture.report(summaries)
+    local lines = T{ ('%-24s %12s %10s %10s %10s %10s %10s'):fmt('handler', 'packets', 'mean(ns)', 'p50(ns)', 'p90(ns)', 'p99(ns)', 'max(ns)'), };
+    for _, s in ipairs(summaries) do
+        lines:append(('%-24s %12d %10.1f %10d %10d %10d %10d'):fmt(s.name, s.count, s.mean, s.p50, s.p90, s.p99, s.max));
+    end
+    return lines:concat('\n');
+end
+
+return capture;
\ No newline at end of file
@@ -0,0 +1,167 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+--[[
+* Packet Events
+*
+* Adds packet id filtering to the 'packet_in' and 'packet_out' events. Requiring this library extends
+* ashita.events.register with an optional options table:
+*
+*   ashita.events.register('packet_in', 'my_cb', function (e) ... end, { ids = { 0x0028, 0x0029, }, });
+*
+* Filtered handlers are held in a 512 entry packet id to handler list table. A single handler is
+* registered with Ashita per event, which only enters the handlers subscribed to the packets id. Handlers
+* registered without an options table are passed directly to Ashita and receive every packet as before.
+*
+* An alias names one handler per event, filtered or not. Registering an alias again, with or without an
+* options table, replaces the existing handler of that alias.
+*
+* Dispatch order: filtered handlers are called together, in the order they were registered, from the single
+* handler this library registers with Ashita. That handler is registered when the first filtered handler of
+* an event is registered, and unregistered when the last one is removed, so filtered handlers run where that
+* handler sits among the unfiltered handlers of the event, not at their own registration points. Addons that
+* depend on the order between filtered and unfiltered handlers should use one kind for both.
+--]]
+
+-- Packet events library table..
+local packetevents = T{
+    -- The original event functions..
+    register    = ashita.events.register,
+    unregister  = ashita.events.unregister,
+
+    -- The filtered handlers of each event..
+    events = T{
+        ['packet_in']   = T{ alias = '__packetevents_packet_in',  ids = T{}, handlers = T{}, registered = false, },
+        ['packet_out']  = T{ alias = '__packetevents_packet_out', ids = T{}, handlers = T{}, registered = false, },
+    },
+};
+
+-- Prepare the packet id tables..
+for _, v in pairs(packetevents.events) do
+    for x = 0, 511 do
+        v.ids[x] = false;
+    end
+end
+
+--[[
+* Rebuilds the packet id to handler list table of the given event.
+*
+* Handler lists are rebuilt on registration changes, not on dispatch, keeping them in registration order.
+*
+* @param {table} ev - The event table.
+--]]
+local function rebuild(ev)
+    for x = 0, 511 do
+        ev.ids[x] = false;
+    end
+
+    for _, h in ipairs(ev.handlers) do
+        for _, id in ipairs(h.ids) do
+            if (id >= 0 and id < 512) then
+                local list = ev.ids[id];
+                if (not list) then
+                    list = T{};
+                    ev.ids[id] = list;
+                end
+                list:append(h.callback);
+            end
+        end
+    end
+end
+
+--[[
+* Registers an event handler for the given event.
+*
+* @param {string} event_name - The name of the event.
+* @param {string} event_alias - The alias of the handler.
+* @param {function} callback - The handler callback.
+* @param {table|nil} options - The optional handler options. ({ ids = { ... } } to filter packet events by id.)
+* @return {boolean} True on success, false otherwise.
+--]]
+function packetevents.register_event(event_name, event_alias, callback, options)
+    local ev = packetevents.events[event_name];
+    if (ev == nil) then
+        return packetevents.register(event_name, event_alias, callback);
+    end
+
+    -- Replace any existing handler of the same alias, filtered or not..
+    packetevents.unregister_event(event_name, event_alias);
+
+    if (options == nil or options.ids == nil) then
+        return packetevents.register(event_name, event_alias, callback);
+    end
+
+    ev.handlers:append(T{ alias = event_alias, callback = callback, ids = T{ unpack(options.ids) }, });
+    rebuild(ev);
+
+    if (not ev.registered) then
+        local ids = ev.ids;
+        packetevents.register(event_name, ev.alias, function (e)
+            local list = ids[e.id];
+            if (not list) then
+                return;
+            end
+            for x = 1, #list do
+                list[x](e);
+            end
+        end);
+        ev.registered = true;
+    end
+
+    return true;
+end
+
+--[[
+* Unregisters an existing event handler.
+*
+* @param {string} event_name - The name of the event.
+* @param {string} event_alias - The alias of the handler.
+* @return {boolean} True on success, false otherwise.
+--]]
+function packetevents.unregister_event(event_name, event_alias)
+    local ev = packetevents.events[event_name];
+    if (ev == nil) then
+        return packetevents.unregister(event_name, event_alias);
+    end
+
+    local idx = ev.handlers:find_if(function (v) return v.alias == event_alias; end);
+    if (idx == nil) then
+        return packetevents.unregister(event_name, event_alias);
+    end
+
+    ev.handlers:remove(idx);
+    rebuild(ev);
+
+    if (#ev.handlers == 0 and ev.registered) then
+        packetevents.unregister(event_name, ev.alias);
+        ev.registered = false;
+    end
+
+    return true;
+end
+
+-- Extend the Ashita event functions..
+ashita.events.register      = packetevents.register_event;
+ashita.events.unregister    = packetevents.unregister_event;
+
+return packetevents;
\ No newline at end of file
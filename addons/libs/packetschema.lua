@@ -0,0 +1,265 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+local breader = require 'bitreader';
+local ffi     = require 'ffi';
+
+---@class PacketSchema
+---@field id number The packet id of the schema.
+---@field direction string The packet direction of the schema. ('in' or 'out')
+---@field fields table The field declarations of the schema.
+---@field source string The generated source of the schemas decoder.
+---@field decoder function The compiled decoder of the schema.
+---@field view table The reusable view used when decoding without a given view.
+
+-- Packet schema library table..
+local schema = T{
+    registry = T{
+        ['in']  = T{},
+        ['out'] = T{},
+    },
+};
+
+--[[
+* Emits the source resetting the given field declarations of a skipped conditional block.
+*
+* @param {table} lines - The table of source lines being generated.
+* @param {table} fields - The field declarations to reset.
+* @param {string} rec - The name of the local holding the current record table.
+* @param {number} depth - The current nesting depth.
+--]]
+local function emit_zero(lines, fields, rec, depth)
+    local indent = ('    '):rep(depth + 1);
+
+    for _, f in ipairs(fields) do
+        if (f.array ~= nil) then
+            lines:append(indent .. ('%s[%q] = nil;'):fmt(rec, f[1]));
+        elseif (f.bytes ~= nil) then
+            lines:append(indent .. ('%s[%q] = \'\';'):fmt(rec, f[1]));
+        elseif (f.when ~= nil) then
+            emit_zero(lines, f[1], rec, depth);
+        elseif (f.seek == nil and f.skip == nil) then
+            lines:append(indent .. ('%s[%q] = 0;'):fmt(rec, f[1]));
+        end
+    end
+end
+
+--[[
+* Emits the decode source of the given field declarations.
+*
+* @param {table} lines - The table of source lines being generated.
+* @param {table} fields - The field declarations to emit.
+* @param {string} rec - The name of the local holding the current record table.
+* @param {number} depth - The current nesting depth.
+--]]
+local function emit_fields(lines, fields, rec, depth)
+    local indent = ('    '):rep(depth + 1);
+    local function emit(fmt, ...)
+        lines:append(indent .. fmt:fmt(...));
+    end
+
+    for _, f in ipairs(fields) do
+        if (f.seek ~= nil) then
+            -- Seek to the given byte offset..
+            emit('p = %d;', f.seek * 8 + (f.bit or 0));
+        elseif (f.skip ~= nil) then
+            -- Skip the given number of bits..
+            emit('p = p + %d;', f.skip);
+        elseif (f.bytes ~= nil) then
+            -- Raw block of bytes..
+            emit('if (p + %d > lim or p %% 8 ~= 0) then return nil; end', f.bytes * 8);
+            emit('%s[%q] = ffi.string(d + p / 8, %d);', rec, f[1], f.bytes);
+            emit('p = p + %d;', f.bytes * 8);
+        elseif (f.array ~= nil) then
+            -- Array of records..
+            local arr = ('a%d'):fmt(depth);
+            local cnt = ('n%d'):fmt(depth);
+            local elm = ('e%d'):fmt(depth);
+            local counted = type(f.array) ~= 'number';
+
+            emit('do');
+            if (counted) then
+                -- Guard against malformed counts; every element must consume at least one bit..
+                emit('local %s = %s[%q];', cnt, rec, f.array);
+                emit('if (%s > lim - p) then return nil; end', cnt);
+            else
+                emit('local %s = %d;', cnt, f.array);
+            end
+            emit('local %s = %s[%q];', arr, rec, f[1]);
+            emit('if (%s == nil) then %s = {}; %s[%q] = %s; end', arr, arr, rec, f[1], arr);
+            emit('for i%d = 1, %s do', depth, cnt);
+            emit('    local %s = %s[i%d];', elm, arr, depth);
+            emit('    if (%s == nil) then %s = {}; %s[i%d] = %s; end', elm, elm, arr, depth, elm);
+            if (counted) then
+                emit('    local s%d = p;', depth);
+            end
+            emit_fields(lines, f[2], elm, depth + 1);
+            if (counted) then
+                emit('    if (p <= s%d) then return nil; end', depth);
+            end
+            emit('end');
+            emit('for i%d = %s + 1, #%s do %s[i%d] = nil; end', depth, cnt, arr, arr, depth);
+            emit('end');
+        elseif (f.when ~= nil) then
+            -- Conditional block of fields..
+            emit('if (%s[%q] ~= 0) then', rec, f.when);
+            emit_fields(lines, f[1], rec, depth + 1);
+            emit('else');
+            emit_zero(lines, f[1], rec, depth + 1);
+            emit('end');
+        else
+            -- Value field..
+            local bits = f[2];
+            if (type(bits) ~= 'number' or bits < 1 or bits > 53) then
+                error(('[packetschema] Invalid field width for field: %s'):fmt(tostring(f[1])));
+            end
+
+            emit('if (p + %d > lim) then return nil; end', bits);
+            if (f[3] == 'signed') then
+                emit('v, p = rd(d, p, %d); %s[%q] = sg(v, %d);', bits, rec, f[1], bits);
+            elseif (f[3] == 'float') then
+                emit('v, p = rd(d, p, %d); %s[%q] = fl(v);', bits, rec, f[1]);
+            else
+                emit('%s[%q], p = rd(d, p, %d);', rec, f[1], bits);
+            end
+        end
+    end
+end
+
+--[[
+* Creates and compiles a new packet schema.
+*
+* Field declarations are processed in order, reading from a cursor that advances as each field is read.
+* Offsets are relative to the start of the packet data, including the packet header.
+*
+*   { 'name', bits[, 'signed'|'float'] }        - A value field.
+*   { 'name', bytes = size }                    - A raw block of bytes, returned as a string.
+*   { seek = byte_offset[, bit = bit_offset] }  - Moves the cursor.
+*   { skip = bits }                             - Skips the given number of bits.
+*   { 'name', { ... }, array = 'field'|count }  - An array of records. (Count read from a previously read field.)
+*                                                 Counted arrays reject packets whose count exceeds the bits
+*                                                 remaining, or whose elements do not consume at least one bit.
+*   { { ... }, when = 'field' }                 - Fields only present if a previously read field is non-zero.
+*
+* @param {number} id - The packet id.
+* @param {string} direction - The packet direction. ('in' or 'out')
+* @param {table} fields - The field declarations.
+* @return {PacketSchema} The compiled schema.
+--]]
+function schema.new(id, direction, fields)
+    if (direction ~= 'in' and direction ~= 'out') then
+        error('[packetschema] Invalid packet direction: ' .. tostring(direction));
+    end
+
+    local lines = T{
+        'local ffi, rd, sg, fl = ...;',
+        'return function (d, lim, view)',
+        '    local p, v = 0, 0;',
+    };
+
+    emit_fields(lines, fields, 'view', 0);
+
+    lines:append('    return view;');
+    lines:append('end');
+
+    local source = lines:concat('\n');
+    local func, err = loadstring(source, ('=packetschema[0x%04X:%s]'):fmt(id, direction));
+    if (func == nil) then
+        error(('[packetschema] Failed to compile schema: %s'):fmt(err));
+    end
+
+    local s = T{
+        id          = id,
+        direction   = direction,
+        fields      = fields,
+        source      = source,
+        decoder     = func(ffi, breader.read_bits, breader.to_signed, breader.to_float),
+        view        = T{},
+    };
+
+    return setmetatable(s, { __index = schema });
+end
+
+--[[
+* Decodes the given packet data with the schema.
+*
+* The returned view (and every array record within it) is reused between calls. Callers that need to hold
+* onto decoded values past the current event should copy them, or pass their own view table.
+*
+* @param {PacketSchema} self - The schema object.
+* @param {string|cdata} data - The packet data.
+* @param {number|nil} size - The size of the packet data, in bytes. (Required when data is an FFI pointer.)
+* @param {table|nil} view - The table to decode into, if provided.
+* @return {table|nil} The decoded view on success, nil otherwise.
+--]]
+function schema:decode(data, size, view)
+    if (type(data) == 'string') then
+        size = size or data:len();
+    elseif (type(data) ~= 'cdata' or size == nil) then
+        return nil;
+    end
+
+    return self.decoder(ffi.cast('const uint8_t*', data), size * 8, view or self.view);
+end
+
+--[[
+* Registers a schema, replacing any previously registered schema of the same packet.
+*
+* @param {PacketSchema} s - The schema to register.
+* @return {PacketSchema} The registered schema.
+--]]
+function schema.register(s)
+    schema.registry[s.direction][s.id] = s;
+    return s;
+end
+
+--[[
+* Returns the registered schema of the given packet.
+*
+* @param {string} direction - The packet direction. ('in' or 'out')
+* @param {number} id - The packet id.
+* @return {PacketSchema|nil} The schema if registered, nil otherwise.
+--]]
+function schema.get(direction, id)
+    local r = schema.registry[direction];
+    return r and r[id] or nil;
+end
+
+--[[
+* Decodes the given packet with its registered schema.
+*
+* @param {string} direction - The packet direction. ('in' or 'out')
+* @param {number} id - The packet id.
+* @param {string|cdata} data - The packet data.
+* @param {number|nil} size - The size of the packet data, in bytes.
+* @return {table|nil} The decoded view on success, nil otherwise.
+--]]
+function schema.decode_packet(direction, id, data, size)
+    local s = schema.get(direction, id);
+    if (s == nil) then
+        return nil;
+    end
+    return s:decode(data, size);
+end
+
+return schema;
\ No newline at end of file
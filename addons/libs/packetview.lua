@@ -0,0 +1,318 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+require 'table.clear';
+
+local breader = require 'bitreader';
+local ffi     = require 'ffi';
+
+---@class PacketView
+---@field ptr ffi.cdata* The packet data being viewed. (const uint8_t*)
+---@field size number The size, in bytes, of the packet data.
+---@field src any The source object of the data. (Holds a reference to prevent it from being collected.)
+---@field schema PacketSchema|nil The schema used to access named fields, if any.
+---@field cache table The cached named field values of the current packet.
+---@field full table The fully decoded packet. (Only filled when a field without a static position is accessed.)
+---@field decoded boolean Flag set if the full packet has been decoded.
+---@field valid boolean Flag set if the full packet was decoded successfully.
+local view = T{};
+view.__index = view;
+
+-- Packet view library table..
+local packetview = T{};
+
+--[[
+* Returns the static bit positions of the root fields of the given schema.
+*
+* Fields following an array or conditional block depend on earlier fields and have no static position.
+* The positions are computed once and stored on the schema.
+*
+* @param {PacketSchema} s - The schema object.
+* @return {table} The table of field name to position info.
+--]]
+local function get_positions(s)
+    if (s.positions ~= nil) then
+        return s.positions;
+    end
+
+    local ret = T{};
+    local pos = 0;
+
+    for _, f in ipairs(s.fields) do
+        if (f.seek ~= nil) then
+            pos = f.seek * 8 + (f.bit or 0);
+        elseif (pos == nil) then
+            -- Position unknown until the next seek..
+        elseif (f.skip ~= nil) then
+            pos = pos + f.skip;
+        elseif (f.bytes ~= nil) then
+            ret[f[1]] = T{ pos = pos, bytes = f.bytes, };
+            pos = pos + f.bytes * 8;
+        elseif (f.array ~= nil or f.when ~= nil) then
+            pos = nil;
+        else
+            ret[f[1]] = T{ pos = pos, bits = f[2], kind = f[3], };
+            pos = pos + f[2];
+        end
+    end
+
+    s.positions = ret;
+    return ret;
+end
+
+--[[
+* Creates and returns a new packet view.
+*
+* @param {string|userdata|cdata|nil} data - The packet data. (ie. e.data or e.data_modified_raw of the packet events.)
+* @param {number|nil} size - The size of the packet data, in bytes. (Required when data is a pointer.)
+* @param {PacketSchema|nil} s - The schema used to access named fields, if any.
+* @return {PacketView} The new view.
+--]]
+function packetview.new(data, size, s)
+    local o = setmetatable({
+        ptr     = nil,
+        size    = 0,
+        src     = nil,
+        schema  = s,
+        cache   = {},
+        full    = {},
+        decoded = false,
+        valid   = false,
+    }, view);
+
+    if (data ~= nil) then
+        o:reset(data, size);
+    end
+
+    return o;
+end
+
+--[[
+* Points the view at new packet data, invalidating any cached fields.
+*
+* @param {PacketView} self - The view object.
+* @param {string|userdata|cdata} data - The packet data.
+* @param {number|nil} size - The size of the packet data, in bytes. (Required when data is a pointer.)
+--]]
+function view:reset(data, size)
+    if (type(data) == 'string') then
+        size = size or data:len();
+    elseif (size == nil) then
+        error('[packetview] Invalid data size; a size is required when using a pointer.');
+    end
+
+    self.src        = data;
+    self.ptr        = ffi.cast('const uint8_t*', data);
+    self.size       = size;
+    self.decoded    = false;
+
+    table.clear(self.cache);
+end
+
+--[[
+* Returns the packet id. (Read from the packet header.)
+*
+* @param {PacketView} self - The view object.
+* @return {number} The packet id.
+--]]
+function view:id()
+    return self:bits(0, 0, 9);
+end
+
+--[[
+* Reads an unsigned 8bit value from the packet data.
+*
+* @param {PacketView} self - The view object.
+* @param {number} offset - The byte offset to read from.
+* @return {number} The read value, or 0 if out of range.
+--]]
+function view:u8(offset)
+    if (offset + 1 > self.size) then return 0; end
+    return self.ptr[offset];
+end
+
+--[[
+* Reads an unsigned 16bit value from the packet data.
+*
+* @param {PacketView} self - The view object.
+* @param {number} offset - The byte offset to read from.
+* @return {number} The read value, or 0 if out of range.
+--]]
+function view:u16(offset)
+    if (offset + 2 > self.size) then return 0; end
+    return ffi.cast('const uint16_t*', self.ptr + offset)[0];
+end
+
+--[[
+* Reads an unsigned 32bit value from the packet data.
+*
+* @param {PacketView} self - The view object.
+* @param {number} offset - The byte offset to read from.
+* @return {number} The read value, or 0 if out of range.
+--]]
+function view:u32(offset)
+    if (offset + 4 > self.size) then return 0; end
+    return ffi.cast('const uint32_t*', self.ptr + offset)[0];
+end
+
+--[[
+* Reads a signed 8bit value from the packet data.
+*
+* @param {PacketView} self - The view object.
+* @param {number} offset - The byte offset to read from.
+* @return {number} The read value, or 0 if out of range.
+--]]
+function view:i8(offset)
+    if (offset + 1 > self.size) then return 0; end
+    return ffi.cast('const int8_t*', self.ptr + offset)[0];
+end
+
+--[[
+* Reads a signed 16bit value from the packet data.
+*
+* @param {PacketView} self - The view object.
+* @param {number} offset - The byte offset to read from.
+* @return {number} The read value, or 0 if out of range.
+--]]
+function view:i16(offset)
+    if (offset + 2 > self.size) then return 0; end
+    return ffi.cast('const int16_t*', self.ptr + offset)[0];
+end
+
+--[[
+* Reads a signed 32bit value from the packet data.
+*
+* @param {PacketView} self - The view object.
+* @param {number} offset - The byte offset to read from.
+* @return {number} The read value, or 0 if out of range.
+--]]
+function view:i32(offset)
+    if (offset + 4 > self.size) then return 0; end
+    return ffi.cast('const int32_t*', self.ptr + offset)[0];
+end
+
+--[[
+* Reads a 32bit float value from the packet data.
+*
+* @param {PacketView} self - The view object.
+* @param {number} offset - The byte offset to read from.
+* @return {number} The read value, or 0 if out of range.
+--]]
+function view:f32(offset)
+    if (offset + 4 > self.size) then return 0; end
+    return ffi.cast('const float*', self.ptr + offset)[0];
+end
+
+--[[
+* Reads a packed value from the packet data.
+*
+* Values are read least significant bit first. (Matching Ashita::BinaryData::UnpackBitsBE.)
+*
+* @param {PacketView} self - The view object.
+* @param {number} byte_offset - The byte offset to read from.
+* @param {number} bit_offset - The bit offset to read from.
+* @param {number} len - The number of bits to read. (1 to 53.)
+* @return {number} The read value, or 0 if out of range.
+--]]
+function view:bits(byte_offset, bit_offset, len)
+    local pos = byte_offset * 8 + bit_offset;
+    if (pos + len > self.size * 8) then
+        return 0;
+    end
+
+    return (breader.read_bits(self.ptr, pos, len));
+end
+
+--[[
+* Reads a string from the packet data.
+*
+* @param {PacketView} self - The view object.
+* @param {number} offset - The byte offset to read from.
+* @param {number} max_len - The maximum length of the string.
+* @return {string} The read string. (Stops at the first null terminator.)
+--]]
+function view:str(offset, max_len)
+    if (offset >= self.size) then
+        return '';
+    end
+
+    local len = math.min(max_len, self.size - offset);
+    local ptr = self.ptr + offset;
+
+    for x = 0, len - 1 do
+        if (ptr[x] == 0) then
+            return ffi.string(ptr, x);
+        end
+    end
+
+    return ffi.string(ptr, len);
+end
+
+--[[
+* Returns the value of a named root field of the views schema.
+*
+* Fields with a static position are read directly the first time they are accessed and cached. Accessing
+* any other field decodes the full packet once, which is then reused for the rest of the packet.
+*
+* @param {PacketView} self - The view object.
+* @param {string} name - The name of the field.
+* @return {any} The field value, or nil if unavailable.
+--]]
+function view:get(name)
+    local ret = self.cache[name];
+    if (ret ~= nil or self.schema == nil) then
+        return ret;
+    end
+
+    local p = get_positions(self.schema)[name];
+    if (p ~= nil) then
+        if (p.bytes ~= nil) then
+            if (p.pos % 8 ~= 0 or p.pos + p.bytes * 8 > self.size * 8) then
+                return nil;
+            end
+            ret = ffi.string(self.ptr + p.pos / 8, p.bytes);
+        elseif (p.pos + p.bits > self.size * 8) then
+            return nil;
+        else
+            ret = self:bits(0, p.pos, p.bits);
+            if (p.kind == 'signed') then
+                ret = breader.to_signed(ret, p.bits);
+            elseif (p.kind == 'float') then
+                ret = breader.to_float(ret);
+            end
+        end
+    else
+        if (not self.decoded) then
+            self.decoded = true;
+            self.valid   = self.schema:decode(self.ptr, self.size, self.full) ~= nil;
+        end
+        if (not self.valid) then
+            return nil;
+        end
+        ret = self.full[name];
+    end
+
+    self.cache[name] = ret;
+    return ret;
+end
+
+return packetview;
\ No newline at end of file
@@ -0,0 +1,614 @@
+--[[
+* Addons - Copyright (c) 2025 Ashita Development Team
+* Contact: https://www.ashitaxi.com/
+* Contact: https://discord.gg/Ashita
+*
+* This file is part of Ashita.
+*
+* Ashita is free software: you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* Ashita is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+--]]
+
+require 'common';
+
+local chat  = require 'chat';
+local ffi   = require 'ffi';
+local imgui = require 'imgui';
+
+ffi.cdef[[
+    typedef struct profilertraceheader_t {
+        char        Magic[4];
+        uint16_t    Version;
+        uint16_t    Size;
+        uint64_t    StartTime;
+    } profilertraceheader_t;
+
+    typedef struct profilertracerecord_t {
+        uint16_t    Type;
+        uint16_t    Handler;
+        uint32_t    Frame;
+        uint64_t    Start;
+        uint64_t    Duration;
+    } profilertracerecord_t;
+
+    typedef struct profilerspan_t {
+        double      Start;
+        double      Duration;
+        double      Arg;
+        uint32_t    Handler;
+    } profilerspan_t;
+]];
+
+--[[
+* Profiler
+*
+* Times the event callbacks of an addon with a high-resolution clock and aggregates their cost per frame.
+* Requiring this library extends ashita.events.register so every callback registered afterwards is timed
+* under the name 'event:alias'. Other functions can be timed with profiler.wrap.
+*
+* The statistics of each callback cover the last profiler.WINDOW frames and are shown in an ImGui panel,
+* toggled with: /profiler <addon> (show | hide)
+*
+* Samples can also be written to a binary trace file for offline analysis, with: /profiler <addon> trace
+* (The same format as the SDK's Profiler.h.)
+*
+* The last profiler.SPANS calls are also kept in a ring buffer, so the last few seconds can be dumped to a
+* Chrome trace file (chrome://tracing or https://ui.perfetto.dev/) after a hitch, with: /profiler <addon> dump
+* (Times use the same clock as the SDK's TraceRecorder.h, so plugin and addon traces line up.)
+--]]
+
+-- Profiler library table..
+local profiler = T{
+    RECORD_NAME     = 0,
+    RECORD_SAMPLE   = 1,
+    RECORD_FRAME    = 2,
+    SPANS           = 65536,
+    VERSION         = 1,
+    WINDOW          = 600,
+
+    -- The original event function..
+    register    = ashita.events.register,
+
+    handlers    = T{},
+    names       = T{},
+    frames      = T{},
+    frame       = 0,
+    frame_start = 0,
+    filled      = 0,
+
+    visible     = T{ false, },
+    stats       = T{},
+    stats_frame = -1,
+
+    trace       = nil,
+    spans       = nil,
+    span_head   = 0,
+};
+
+profiler.spans = ffi.new('profilerspan_t[?]', profiler.SPANS);
+
+for x = 1, profiler.WINDOW do
+    profiler.frames[x] = 0;
+end
+
+-- Timer used to measure callback durations, in nanoseconds..
+local qpc   = ashita.time.query_performance_counter;
+local scale = 1e9 / ashita.time.query_performance_frequency().q;
+profiler.now = function ()
+    return qpc().q * scale;
+end
+
+local now = profiler.now;
+profiler.frame_start = now();
+
+--[[
+* Trace Writing
+--]]
+
+local trace_buffer_size = 4096;
+
+--[[
+* Writes any buffered trace records to the trace file.
+--]]
+local function flush_trace()
+    local t = profiler.trace;
+    if (t == nil or t.count == 0) then
+        return;
+    end
+
+    t.file:write(ffi.string(t.records, t.count * ffi.sizeof('profilertracerecord_t')));
+    t.count = 0;
+end
+
+--[[
+* Writes a record to the trace file.
+*
+* @param {number} rtype - The record type.
+* @param {number} handler - The handler id.
+* @param {number} start - The start time, in nanoseconds.
+* @param {number} duration - The duration, in nanoseconds.
+--]]
+local function write_trace(rtype, handler, start, duration)
+    local t = profiler.trace;
+    local r = t.records[t.count];
+    r.Type      = rtype;
+    r.Handler   = handler;
+    r.Frame     = profiler.frame;
+    r.Start     = math.max(start - t.start, 0);
+    r.Duration  = math.max(duration, 0);
+
+    t.count = t.count + 1;
+    if (t.count == trace_buffer_size) then
+        flush_trace();
+    end
+end
+
+--[[
+* Writes the name of a handler to the trace file.
+*
+* @param {table} h - The handler table.
+--]]
+local function write_trace_name(h)
+    flush_trace();
+
+    local t = profiler.trace;
+    local r = t.records[0];
+    r.Type      = profiler.RECORD_NAME;
+    r.Handler   = h.id;
+    r.Frame     = profiler.frame;
+    r.Start     = 0;
+    r.Duration  = #h.name;
+
+    t.file:write(ffi.string(r, ffi.sizeof('profilertracerecord_t')));
+    t.file:write(h.name);
+    t.file:write(('\0'):rep((8 - (#h.name % 8)) % 8));
+end
+
+--[[
+* Starts writing samples to a trace file, replacing any existing file.
+*
+* @param {string} path - The path to the trace file.
+* @return {boolean} True on success, false otherwise.
+--]]
+function profiler.start_trace(path)
+    profiler.stop_trace();
+
+    local f = io.open(path, 'wb');
+    if (f == nil) then
+        return false;
+    end
+
+    local header = ffi.new('profilertraceheader_t');
+    ffi.copy(header.Magic, 'APRF', 4);
+    header.Version      = profiler.VERSION;
+    header.Size         = ffi.sizeof('profilertraceheader_t');
+    header.StartTime    = os.time() * 1000;
+
+    f:write(ffi.string(header, ffi.sizeof(header)));
+
+    profiler.trace = T{
+        file    = f,
+        path    = path,
+        start   = now(),
+        records = ffi.new('profilertracerecord_t[?]', trace_buffer_size),
+        count   = 0,
+    };
+
+    profiler.handlers:each(write_trace_name);
+
+    return true;
+end
+
+--[[
+* Flushes and closes the trace file.
+--]]
+function profiler.stop_trace()
+    if (profiler.trace == nil) then
+        return;
+    end
+
+    flush_trace();
+    profiler.trace.file:close();
+    profiler.trace = nil;
+end
+
+--[[
+* Handler Timing
+--]]
+
+--[[
+* Registers a handler, or returns the handler already registered with the given name.
+*
+* @param {string} name - The handler name.
+* @return {table} The handler table.
+--]]
+function profiler.get_handler(name)
+    local h = profiler.names[name];
+    if (h ~= nil) then
+        return h;
+    end
+
+    h = T{
+        id      = #profiler.handlers,
+        name    = name,
+        time    = 0,
+        calls   = 0,
+        times   = T{},
+        counts  = T{},
+    };
+    for x = 1, profiler.WINDOW do
+        h.times[x]  = 0;
+        h.counts[x] = 0;
+    end
+
+    profiler.handlers:append(h);
+    profiler.names[name] = h;
+
+    if (profiler.trace ~= nil) then
+        write_trace_name(h);
+    end
+
+    return h;
+end
+
+--[[
+* Records a call of a handler.
+*
+* @param {table} h - The handler table.
+* @param {number} start - The start time of the call, in nanoseconds. (See: profiler.now)
+* @param {number} finish - The end time of the call, in nanoseconds. (See: profiler.now)
+* @param {number|nil} arg - The argument of the call. (ie. the packet id.) (Optional.)
+--]]
+function profiler.record(h, start, finish, arg)
+    h.time  = h.time + (finish - start);
+    h.calls = h.calls + 1;
+
+    local span = profiler.spans[profiler.span_head % profiler.SPANS];
+    span.Start      = start;
+    span.Duration   = finish - start;
+    span.Arg        = arg or -1;
+    span.Handler    = h.id;
+    profiler.span_head = profiler.span_head + 1;
+
+    if (profiler.trace ~= nil) then
+        write_trace(profiler.RECORD_SAMPLE, h.id, start, finish - start);
+    end
+end
+
+--[[
+* Wraps a function so each of its calls is timed under the given name.
+*
+* @param {string} name - The handler name.
+* @param {function} func - The function to wrap.
+* @param {function|nil} argfn - The function returning the argument of a call, given its arguments. (Optional.)
+* @return {function} The wrapped function.
+--]]
+function profiler.wrap(name, func, argfn)
+    local h = profiler.get_handler(name);
+    local record = profiler.record;
+
+    -- Pass the return values of the function through the timing..
+    local function finish(start, arg, ...)
+        record(h, start, now(), arg);
+        return ...;
+    end
+
+    if (argfn == nil) then
+        return function (...)
+            return finish(now(), nil, func(...));
+        end
+    end
+
+    return function (...)
+        return finish(now(), argfn(...), func(...));
+    end
+end
+
+--[[
+* Returns the calls of the last given number of seconds as Chrome trace JSON.
+*
+* @param {number} seconds - The number of seconds to include.
+* @return {string} The trace JSON.
+--]]
+function profiler.get_chrome_trace(seconds)
+    local since = now() - (seconds * 1e9);
+    local first = math.max(profiler.span_head - profiler.SPANS, 0);
+
+    local events = T{};
+    events:append(('{"name":"thread_name","ph":"M","pid":1,"tid":0,"args":{"name":"addon: %s"}}'):fmt(addon.name));
+
+    for x = first, profiler.span_head - 1 do
+        local span = profiler.spans[x % profiler.SPANS];
+        if (span.Start + span.Duration >= since) then
+            local name = profiler.handlers[span.Handler + 1].name:gsub('["\\]', '\\%0');
+            local args = span.Arg >= 0 and (',"args":{"arg":%d}'):fmt(span.Arg) or '';
+            events:append(('{"name":"%s","cat":"addon","ph":"X","pid":1,"tid":0,"ts":%.3f,"dur":%.3f%s}'):fmt(name, span.Start / 1000, span.Duration / 1000, args));
+        end
+    end
+
+    return ('{"displayTimeUnit":"ms","traceEvents":[\n%s\n]}\n'):fmt(events:concat(',\n'));
+end
+
+--[[
+* Writes the calls of the last given number of seconds to a Chrome trace file.
+*
+* @param {string} path - The path to the trace file.
+* @param {number} seconds - The number of seconds to include.
+* @return {boolean} True on success, false otherwise.
+--]]
+function profiler.write_chrome_trace(path, seconds)
+    local f = io.open(path, 'wb');
+    if (f == nil) then
+        return false;
+    end
+
+    f:write(profiler.get_chrome_trace(seconds));
+    f:close();
+
+    return true;
+end
+
+--[[
+* Statistics
+--]]
+
+local scratch = T{};
+
+--[[
+* Returns the statistics of a list of per-frame times over the frame window.
+*
+* @param {table} times - The per-frame times.
+* @return {table} The statistics table.
+--]]
+local function get_window_stats(times)
+    local count = profiler.filled;
+    local ret = T{ frames = count, calls = 0, mean = 0, p50 = 0, p95 = 0, p99 = 0, max = 0, };
+    if (count == 0) then
+        return ret;
+    end
+
+    local total = 0;
+    for x = 1, count do
+        scratch[x] = times[x];
+        total = total + times[x];
+    end
+    for x = count + 1, #scratch do
+        scratch[x] = nil;
+    end
+    table.sort(scratch);
+
+    ret.mean    = total / count;
+    ret.p50     = scratch[math.floor((count * 50 + 99) / 100)];
+    ret.p95     = scratch[math.floor((count * 95 + 99) / 100)];
+    ret.p99     = scratch[math.floor((count * 99 + 99) / 100)];
+    ret.max     = scratch[count];
+
+    return ret;
+end
+
+--[[
+* Returns the statistics of a handler over the frame window. (Times are per-frame totals, in nanoseconds.)
+*
+* @param {table} h - The handler table.
+* @return {table} The statistics table.
+--]]
+function profiler.get_stats(h)
+    local ret = get_window_stats(h.times);
+
+    local calls = 0;
+    for x = 1, profiler.filled do
+        calls = calls + h.counts[x];
+    end
+    ret.calls = profiler.filled == 0 and 0 or calls / profiler.filled;
+
+    return ret;
+end
+
+--[[
+* Returns the statistics of the frame time over the frame window. (Times are in nanoseconds.)
+*
+* @return {table} The statistics table.
+--]]
+function profiler.get_frame_stats()
+    local ret = get_window_stats(profiler.frames);
+    ret.calls = profiler.filled == 0 and 0 or 1;
+    return ret;
+end
+
+--[[
+* Ends the current frame, rolling the totals of each handler into the frame window.
+--]]
+function profiler.end_frame()
+    local t = now();
+    local pos = (profiler.frame % profiler.WINDOW) + 1;
+
+    profiler.frames[pos] = t - profiler.frame_start;
+    for _, h in ipairs(profiler.handlers) do
+        h.times[pos]    = h.time;
+        h.counts[pos]   = h.calls;
+        h.time          = 0;
+        h.calls         = 0;
+    end
+
+    if (profiler.trace ~= nil) then
+        write_trace(profiler.RECORD_FRAME, 0, profiler.frame_start, t - profiler.frame_start);
+    end
+
+    profiler.frame_start    = t;
+    profiler.frame          = profiler.frame + 1;
+    profiler.filled         = math.min(profiler.filled + 1, profiler.WINDOW);
+end
+
+--[[
+* Renders the profiler panel.
+--]]
+function profiler.render()
+    if (not profiler.visible[1]) then
+        return;
+    end
+
+    -- Refresh the statistics twice a second, so the windows are not sorted every frame..
+    if (profiler.frame - profiler.stats_frame >= 30) then
+        profiler.stats_frame = profiler.frame;
+        profiler.stats = profiler.handlers:map(function (h)
+            return T{ name = h.name, stats = profiler.get_stats(h), };
+        end);
+        profiler.stats:sort(function (a, b) return a.stats.p95 > b.stats.p95; end);
+        profiler.frame_stats = profiler.get_frame_stats();
+    end
+
+    local ms = function (v) return ('%.3f'):fmt(v / 1e6); end
+
+    imgui.SetNextWindowSize({ 640, 320, }, ImGuiCond_FirstUseEver);
+    if (imgui.Begin(('Profiler - %s'):fmt(addon.name), profiler.visible)) then
+        local f = profiler.frame_stats;
+        if (f ~= nil) then
+            imgui.Text(('Frame: mean %s ms, p50 %s ms, p95 %s ms, p99 %s ms, max %s ms (%d frames)'):fmt(ms(f.mean), ms(f.p50), ms(f.p95), ms(f.p99), ms(f.max), f.frames));
+        end
+        if (profiler.trace ~= nil) then
+            imgui.TextColored({ 1.0, 0.4, 0.4, 1.0, }, ('Tracing to: %s'):fmt(profiler.trace.path));
+        end
+
+        if (imgui.BeginTable('##profiler_list', 7, bit.bor(ImGuiTableFlags_RowBg, ImGuiTableFlags_BordersH, ImGuiTableFlags_BordersV, ImGuiTableFlags_ScrollY, ImGuiTableFlags_SizingFixedFit))) then
+            imgui.TableSetupColumn('Handler', ImGuiTableColumnFlags_WidthStretch, 0, 0);
+            imgui.TableSetupColumn('Calls', ImGuiTableColumnFlags_WidthFixed, 50.0, 0);
+            imgui.TableSetupColumn('Mean (ms)', ImGuiTableColumnFlags_WidthFixed, 70.0, 0);
+            imgui.TableSetupColumn('p50 (ms)', ImGuiTableColumnFlags_WidthFixed, 70.0, 0);
+            imgui.TableSetupColumn('p95 (ms)', ImGuiTableColumnFlags_WidthFixed, 70.0, 0);
+            imgui.TableSetupColumn('p99 (ms)', ImGuiTableColumnFlags_WidthFixed, 70.0, 0);
+            imgui.TableSetupColumn('Max (ms)', ImGuiTableColumnFlags_WidthFixed, 70.0, 0);
+            imgui.TableSetupScrollFreeze(0, 1);
+            imgui.TableHeadersRow();
+
+            for _, v in ipairs(profiler.stats) do
+                local s = v.stats;
+                imgui.TableNextRow();
+                imgui.TableNextColumn();
+                imgui.Text(v.name);
+                imgui.TableNextColumn();
+                imgui.Text(('%.2f'):fmt(s.calls));
+                imgui.TableNextColumn();
+                imgui.Text(ms(s.mean));
+                imgui.TableNextColumn();
+                imgui.Text(ms(s.p50));
+                imgui.TableNextColumn();
+                imgui.Text(ms(s.p95));
+                imgui.TableNextColumn();
+                imgui.Text(ms(s.p99));
+                imgui.TableNextColumn();
+                imgui.Text(ms(s.max));
+            end
+
+            imgui.EndTable();
+        end
+    end
+    imgui.End();
+end
+
+--[[
+* Registers an event handler for the given event, timing its calls.
+*
+* @param {string} event_name - The name of the event.
+* @param {string} event_alias - The alias of the handler.
+* @param {function} callback - The handler callback.
+* @param {table|nil} options - The optional handler options.
+* @return {boolean} True on success, false otherwise.
+--]]
+function profiler.register_event(event_name, event_alias, callback, options)
+    if (type(callback) ~= 'function') then
+        return profiler.register(event_name, event_alias, callback, options);
+    end
+
+    -- Record the packet id of packet event calls..
+    local argfn = nil;
+    if (event_name == 'packet_in' or event_name == 'packet_out') then
+        argfn = function (e) return e.id; end;
+    end
+
+    return profiler.register(event_name, event_alias, profiler.wrap(('%s:%s'):fmt(event_name, event_alias), callback, argfn), options);
+end
+
+--[[
+* event: d3d_present
+* desc : Event called when the Direct3D device is presenting a scene.
+--]]
+profiler.register('d3d_present', '__profiler_present_cb', function ()
+    profiler.end_frame();
+    profiler.render();
+end);
+
+--[[
+* event: command
+* desc : Event called when the addon is processing a command.
+--]]
+profiler.register('command', '__profiler_command_cb', function (e)
+    local args = e.command:args();
+    if (#args < 3 or args[1] ~= '/profiler' or args[2]:lower() ~= addon.name:lower()) then
+        return;
+    end
+
+    e.blocked = true;
+
+    -- Handle: /profiler <addon> (show | hide) - Sets the profiler panel visibility.
+    if (args[3]:any('show', 'hide')) then
+        profiler.visible[1] = args[3] == 'show';
+        return;
+    end
+
+    -- Handle: /profiler <addon> trace [path] - Starts writing a trace file.
+    if (args[3]:any('trace')) then
+        local path = args[4] or ('%s/profiler_%s.bin'):fmt(addon.path, os.date('%Y%m%d_%H%M%S'));
+        if (profiler.start_trace(path)) then
+            print(chat.header(addon.name):append(chat.message('Profiler trace started: ')):append(chat.success(path)));
+        else
+            print(chat.header(addon.name):append(chat.error('Failed to open profiler trace file: ')):append(chat.success(path)));
+        end
+        return;
+    end
+
+    -- Handle: /profiler <addon> dump [seconds] [path] - Writes the last seconds of calls to a Chrome trace file.
+    if (args[3]:any('dump')) then
+        local seconds = (args[4] or ''):number_or(10);
+        local path = args[5] or ('%s/trace_%s.json'):fmt(addon.path, os.date('%Y%m%d_%H%M%S'));
+        if (profiler.write_chrome_trace(path, seconds)) then
+            print(chat.header(addon.name):append(chat.message('Chrome trace written: ')):append(chat.success(path)));
+        else
+            print(chat.header(addon.name):append(chat.error('Failed to open Chrome trace file: ')):append(chat.success(path)));
+        end
+        return;
+    end
+
+    -- Handle: /profiler <addon> stop - Stops writing the trace file.
+    if (args[3]:any('stop')) then
+        if (profiler.trace ~= nil) then
+            print(chat.header(addon.name):append(chat.message('Profiler trace stopped: ')):append(chat.success(profiler.trace.path)));
+        end
+        profiler.stop_trace();
+        return;
+    end
+
+    print(chat.header(addon.name):append(chat.error('Usage: ')):append(chat.message('/profiler <addon> (show | hide | trace [path] | stop | dump [seconds] [path])')));
+end);
+
+--[[
+* event: unload
+* desc : Event called when the addon is being unloaded.
+--]]
+profiler.register('unload', '__profiler_unload_cb', function ()
+    profiler.stop_trace();
+end);
+
+-- Extend the Ashita event functions..
+ashita.events.register = profiler.register_event;
+
+return profiler;
\ No newline at end of file
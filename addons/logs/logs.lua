@@ -26,10 +26,13 @@ addon.desc      = 'Logs all text that goes through the chat log to a file.';
 addon.link      = 'https://ashitaxi.com/';
 
 require 'common';
+require 'packetevents';
+local packetview = require 'packetview';
 
 -- Logs Variables
 local logs = T{
     name = nil,
+    view = packetview.new(),
 };
 
 --[[
@@ -110,7 +113,8 @@ end);
 ashita.events.register('packet_in', 'packet_in_cb', function (e)
     -- Packet: Zone Enter
     if (e.id == 0x000A) then
-        local name = struct.unpack('s', e.data_modified, 0x84 + 0x01);
+        logs.view:reset(e.data_modified);
+        local name = logs.view:str(0x84, 16);
         if (logs.name ~= name) then
             logs.name = name;
         end
@@ -124,4 +128,4 @@ ashita.events.register('packet_in', 'packet_in_cb', function (e)
         end
         return;
     end
-end);
\ No newline at end of file
+end, { ids = { 0x000A, 0x000B, }, });
\ No newline at end of file
@@ -27,7 +27,8 @@ addon.link      = 'https://ashitaxi.com/';
 
 require 'common';
 
-local imgui = require 'imgui';
+local entities  = require 'ffxi.entities';
+local imgui     = require 'imgui';
 
 -- PetInfo Variables
 local petinfo = T{
@@ -42,13 +43,7 @@ local petinfo = T{
 * @return {object | nil} The entity on success, nil otherwise.
 --]]
 local function GetEntityByServerId(sid)
-    for x = 0, 2303 do
-        local ent = GetEntity(x);
-        if (ent ~= nil and ent.ServerId == sid) then
-            return ent;
-        end
-    end
-    return nil;
+    return entities.get_entity(sid);
 end
 
 --[[
@@ -23,6 +23,7 @@ require 'common';
 
 local chat  = require 'chat';
 local dats  = require 'ffxi.dats';
+local ffi   = require 'ffi';
 local imgui = require 'imgui';
 
 -- Renamer Editor Variables
@@ -79,30 +80,25 @@ function editor.update_zone_npcs(zid, zsubid)
         return false;
     end
 
-    -- Open the DAT for reading..
-    local f = io.open(file, 'rb');
-    if (f == nil) then
+    -- Obtain a mapped view of the DAT..
+    local view = dats.get_file_view(dats.get_zone_npclist_id(zid, zsubid));
+    if (view == nil) then
         return false;
     end
 
-    -- Obtain the file size..
-    local size = f:seek('end');
-    f:seek('set', 0);
-
-    -- Validate the file by its size and expected entry count alignment..
-    if (size == 0 or ((size - math.floor(size / 0x20) * 0x20) ~= 0)) then
-        f:close();
+    -- Validate the file by its expected entry count alignment..
+    if ((view.size % 0x20) ~= 0) then
         return false;
     end
 
     -- Parse the file for npc entries..
-    for _ = 0, ((size / 0x20) - 0x01) do
-        local data = f:read(0x20);
-        local name, id = struct.unpack('c28L', data);
+    for x = 0, ((view.size / 0x20) - 0x01) do
+        local entry = view.data + (x * 0x20);
+        local name  = ffi.string(entry, 28);
+        local id    = ffi.cast('const uint32_t*', entry + 28)[0];
         table.insert(editor.npcs, { id, bit.band(id, 0x0FFF), name });
     end
 
-    f:close();
     return true;
 end
 
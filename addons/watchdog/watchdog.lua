@@ -28,9 +28,10 @@ addon.link      = 'https://ashitaxi.com/';
 require 'common';
 require 'win32types';
 
-local chat  = require 'chat';
-local dats  = require 'ffxi.dats';
-local ffi   = require 'ffi';
+local chat          = require 'chat';
+local dats          = require 'ffxi.dats';
+local ffi           = require 'ffi';
+local zoneassets    = require 'ffxi.zoneassets';
 
 ffi.cdef[[
     typedef bool (__cdecl* gcTrackingStartSet_f)(uint32_t);
@@ -107,28 +108,16 @@ local function load_zone_entities(zid, sid)
         return false;
     end
 
-    local f = io.open(file, 'rb');
-    if (f == nil) then
-        print(chat.header(addon.name):append(chat.error('Failed to access zone entity DAT file for current zone. [zid: %d, sid: %d]'):fmt(zid, sid)));
+    -- Obtain the zones npc list from the zone asset cache; it is usually prefetched while zoning..
+    local assets = zoneassets.get(zid, sid);
+    if (assets == nil) then
+        print(chat.header(addon.name):append(chat.error('Failed to load zone entity DAT file for current zone. [zid: %d, sid: %d]'):fmt(zid, sid)));
         return false;
     end
 
-    local size = f:seek('end');
-    f:seek('set', 0);
-
-    if (size == 0 or ((size - math.floor(size / 0x20) * 0x20) ~= 0)) then
-        f:close();
-        print(chat.header(addon.name):append(chat.error('Failed to validate zone entity DAT file for current zone. [zid: %d, sid: %d]'):fmt(zid, sid)));
-        return false;
-    end
-
-    for _ = 0, ((size / 0x20) - 0x01) do
-        local data = f:read(0x20);
-        local name, id = struct.unpack('c28L', data);
-        table.insert(watchdog.entities, T{ ['id'] = bit.band(id, 0x0FFF), ['name'] = name:trim('\0') });
-    end
-
-    f:close();
+    watchdog.entities = assets.npcs:map(function (v)
+        return T{ ['id'] = v.index, ['name'] = v.name };
+    end);
 
     print(chat.header(addon.name):append(chat.message('Loaded zone entity list!')));
 
@@ -0,0 +1,160 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_ATOMICFILE_H_INCLUDED
+#define ASHITA_SDK_ATOMICFILE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace Ashita
+{
+    /**
+     * Atomic File Writer
+     *
+     * Writes a file to a uniquely named temporary file next to it, then renames the temporary file over the
+     * target once the write has completed. Readers only ever see the previous or the new contents of the file,
+     * even if the writer crashes part way through or multiple clients write the same file at once.
+     *
+     * @notes
+     *
+     *      The temporary file is removed if the writer is destroyed without committing.
+     */
+    class AtomicFileWriter
+    {
+        std::string m_Path;
+        std::string m_TempPath;
+        std::ofstream m_Stream;
+        bool m_IsCommitted;
+
+    public:
+        explicit AtomicFileWriter(const char* path)
+            : m_Path(path == nullptr ? "" : path)
+            , m_IsCommitted(false)
+        {
+            if (this->m_Path.empty())
+                return;
+
+            this->m_TempPath = AtomicFileWriter::MakeTempPath(this->m_Path);
+            this->m_Stream.open(this->m_TempPath, std::ios::binary | std::ios::trunc);
+        }
+        ~AtomicFileWriter(void)
+        {
+            if (this->m_IsCommitted || this->m_TempPath.empty())
+                return;
+
+            if (this->m_Stream.is_open())
+                this->m_Stream.close();
+
+            std::error_code ec;
+            std::filesystem::remove(this->m_TempPath, ec);
+        }
+
+        AtomicFileWriter(const AtomicFileWriter&)            = delete;
+        AtomicFileWriter& operator=(const AtomicFileWriter&) = delete;
+
+        /**
+         * Returns if the temporary file was opened.
+         *
+         * @return {bool} True if open, false otherwise.
+         */
+        bool IsOpen(void) const
+        {
+            return this->m_Stream.is_open();
+        }
+
+        /**
+         * Returns the stream of the temporary file.
+         *
+         * @return {std::ofstream&} The file stream.
+         */
+        std::ofstream& GetStream(void)
+        {
+            return this->m_Stream;
+        }
+
+        /**
+         * Closes the temporary file and moves it over the target file.
+         *
+         * @return {bool} True on success, false otherwise. (The temporary file is removed on failure.)
+         */
+        bool Commit(void)
+        {
+            if (this->m_IsCommitted || !this->m_Stream.is_open())
+                return false;
+
+            this->m_Stream.flush();
+            const auto good = this->m_Stream.good();
+            this->m_Stream.close();
+
+            if (!good)
+                return false;
+
+            std::error_code ec;
+            std::filesystem::rename(this->m_TempPath, this->m_Path, ec);
+            if (ec)
+                return false;
+
+            this->m_IsCommitted = true;
+            return true;
+        }
+
+    private:
+        /**
+         * Returns a unique temporary path for the given file.
+         *
+         * @param {std::string&} path - The path of the target file.
+         * @return {std::string} The temporary path.
+         */
+        static std::string MakeTempPath(const std::string& path)
+        {
+            static std::atomic<uint64_t> counter{0};
+
+            // Mix random, time and thread based values so concurrent writers (within or across processes) do not collide..
+            auto seed = ((uint64_t)std::random_device{}() << 32) ^ (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+            seed ^= (uint64_t)std::hash<std::thread::id>{}(std::this_thread::get_id()) * 0x9E3779B97F4A7C15ull;
+            seed += counter.fetch_add(1, std::memory_order_relaxed) * 0xBF58476D1CE4E5B9ull;
+            seed ^= seed >> 31;
+
+            static constexpr char digits[] = "0123456789abcdef";
+
+            auto ret = path + ".";
+            for (auto x = 0; x < 16; x++, seed >>= 4)
+                ret.push_back(digits[seed & 0x0F]);
+            return ret + ".tmp";
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_ATOMICFILE_H_INCLUDED
\ No newline at end of file
@@ -26,7 +26,11 @@
 #pragma once
 #endif
 
+#include <algorithm>
 #include <cinttypes>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
 
 /**
  * Credits to the original ProjectXI authors that made the original versions of these functions.
@@ -46,58 +50,57 @@ namespace Ashita
          * @param {uint32_t} bitOffset - The bit offset to pack the value at.
          * @param {uint8_t} len - The length of the value being packed.
          * @return {uint32_t} The bit offset where the value ends.
+         *
+         * @notes
+         *
+         *      Bits are packed starting from the lowest bit of each byte. (This is the packing used by the
+         *      majority of the game packets.) The smallest 1, 2, 4 or 8 byte word holding the value is read and
+         *      written, as with the previous implementation, and values that span more than 8 bytes also update
+         *      the byte after them.
          */
-        static uint32_t PackBitsBE(uint8_t* data, uint64_t value, uint32_t byteOffset, uint32_t bitOffset, const uint8_t len)
+        static uint32_t PackBitsBE(uint8_t* data, const uint64_t value, uint32_t byteOffset, uint32_t bitOffset, uint8_t len)
         {
             // Adjust the offsets as needed for bit alignment..
             byteOffset += bitOffset >> 3;
-            bitOffset %= 8;
-
-            // Prepare the bit mask and value..
-            auto bitmask = (uint64_t)0xFFFFFFFFFFFFFFFFLL;
-            bitmask >>= 64 - len;
-            bitmask <<= bitOffset;
-            value <<= bitOffset;
-            value &= bitmask;
-            bitmask ^= 0xFFFFFFFFFFFFFFFFLL;
-
-            // Pack the data based on the size (type)..
-            if (len + bitOffset <= 8)
+            bitOffset &= 7;
+
+            const auto span = bitOffset + len;
+            const auto ptr  = &data[byteOffset];
+
+            // Update the smallest word holding the value.. (Empty values take the byte path, with an empty mask.)
+            if (span <= 8)
             {
-                const auto ptr  = &data[byteOffset];
-                const auto mask = (uint8_t)bitmask;
-                const auto val  = (uint8_t)value;
-                *ptr &= mask;
-                *ptr |= val;
+                const auto mask = (0xFFu >> (8 - len)) << bitOffset;
+                *ptr            = (uint8_t)((*ptr & ~mask) | ((value << bitOffset) & mask));
             }
-            else if (len + bitOffset <= 16)
+            else if (span <= 16)
             {
-                const auto ptr  = (uint16_t*)&data[byteOffset];
-                const auto mask = (uint16_t)bitmask;
-                const auto val  = (uint16_t)value;
-                *ptr &= mask;
-                *ptr |= val;
+                const auto mask = (0xFFFFu >> (16 - len)) << bitOffset;
+                Ashita::BinaryData::Write<uint16_t>(ptr, (uint16_t)((Ashita::BinaryData::Read<uint16_t>(ptr) & ~mask) | ((value << bitOffset) & mask)));
             }
-            else if (len + bitOffset <= 32)
+            else if (span <= 32)
             {
-                const auto ptr  = (uint32_t*)&data[byteOffset];
-                const auto mask = (uint32_t)bitmask;
-                const auto val  = (uint32_t)value;
-                *ptr &= mask;
-                *ptr |= val;
+                const auto mask = (0xFFFFFFFFull >> (32 - len)) << bitOffset;
+                Ashita::BinaryData::Write<uint32_t>(ptr, (uint32_t)((Ashita::BinaryData::Read<uint32_t>(ptr) & ~mask) | ((value << bitOffset) & mask)));
             }
-            else if (len + bitOffset <= 64)
+            else if (span <= 64)
             {
-                const auto ptr = (uint64_t*)&data[byteOffset];
-                *ptr &= bitmask;
-                *ptr |= value;
+                const auto mask = (0xFFFFFFFFFFFFFFFFull >> (64 - len)) << bitOffset;
+                Ashita::BinaryData::Write<uint64_t>(ptr, (Ashita::BinaryData::Read<uint64_t>(ptr) & ~mask) | ((value << bitOffset) & mask));
             }
             else
             {
-                // This should never be hit. (Data size > 64bits.)
+                // Split values that span more than 8 bytes into the first 8 bytes and the byte after them..
+                len = len > 64 ? 64 : len;
+
+                const auto mask = (uint8_t)((1u << (bitOffset + len - 64)) - 1);
+                Ashita::BinaryData::Write<uint64_t>(ptr, (Ashita::BinaryData::Read<uint64_t>(ptr) & ~(0xFFFFFFFFFFFFFFFFull << bitOffset)) | (value << bitOffset));
+                ptr[8] = (uint8_t)((ptr[8] & ~mask) | ((value >> (64 - bitOffset)) & mask));
+
+                return (byteOffset << 3) + bitOffset + len;
             }
 
-            return (byteOffset << 3) + bitOffset + len;
+            return (byteOffset << 3) + span;
         }
 
         /**
@@ -123,45 +126,36 @@ namespace Ashita
          * @param {uint32_t} bitOffset - The bit offset to pack the value at.
          * @param {uint8_t} len - The length of the value being packed.
          * @return {uint32_t} The bit offset where the value ends.
+         *
+         * @notes
+         *
+         *      Bits are packed starting from the highest bit of each byte. Only the bytes that the value spans
+         *      are read and written.
          */
-        static uint32_t PackBitsLE(uint8_t* data, const uint64_t value, uint32_t byteOffset, uint32_t bitOffset, const uint8_t len)
+        static uint32_t PackBitsLE(uint8_t* data, const uint64_t value, uint32_t byteOffset, uint32_t bitOffset, uint8_t len)
         {
             // Adjust the offsets as needed for bit alignment..
             byteOffset += bitOffset >> 3;
-            bitOffset %= 8;
-
-            // Determine the bytes required..
-            uint8_t bytesNeeded;
-            if (bitOffset + len <= 8)
-                bytesNeeded = 1;
-            else if (bitOffset + len <= 16)
-                bytesNeeded = 2;
-            else if (bitOffset + len <= 32)
-                bytesNeeded = 4;
-            else if (bitOffset + len <= 64)
-                bytesNeeded = 8;
-            else
-            {
-                // This should never be hit. (Data size > 64bits.)
-                return 0;
-            }
+            bitOffset &= 7;
 
-            // Write the packed data..
-            auto modified = new uint8_t[bytesNeeded];
-            for (uint8_t c = 0; c < bytesNeeded; ++c)
-                modified[c] = data[byteOffset + (bytesNeeded - 1) - c];
+            if (len > 64)
+                len = 64;
 
-            const int32_t nbo = (bytesNeeded << 3) - (bitOffset + len);
-            Ashita::BinaryData::PackBitsBE(&modified[0], value, 0, nbo, len);
-
-            for (uint8_t c = 0; c < bytesNeeded; ++c)
-                data[byteOffset + (bytesNeeded - 1) - c] = modified[c];
+            // Split values that span more than 8 bytes into two packs..
+            if (bitOffset + len > 64)
+            {
+                Ashita::BinaryData::PackBitsLE(data, value >> 32, byteOffset, bitOffset, len - 32);
+                return Ashita::BinaryData::PackBitsLE(data, value, byteOffset, bitOffset + len - 32, 32);
+            }
 
-            // Cleanup..
-            if (modified)
+            if (len > 0)
             {
-                delete[] modified;
-                modified = nullptr;
+                const auto size  = (bitOffset + len + 7) >> 3;
+                const auto shift = (size << 3) - (bitOffset + len);
+                const auto mask  = Ashita::BinaryData::BitMask(len) << shift;
+                const auto curr  = Ashita::BinaryData::LoadBE(&data[byteOffset], size);
+
+                Ashita::BinaryData::StoreBE(&data[byteOffset], (curr & ~mask) | ((value << shift) & mask), size);
             }
 
             return (byteOffset << 3) + bitOffset + len;
@@ -190,46 +184,28 @@ namespace Ashita
          * @param {uint8_t} len - The length of bits to unpack.
          * @return {uint64_t} The unpacked value.
          */
-        static uint64_t UnpackBitsBE(uint8_t* data, uint32_t byteOffset, uint32_t bitOffset, const uint8_t len)
+        static uint64_t UnpackBitsBE(const uint8_t* data, uint32_t byteOffset, uint32_t bitOffset, uint8_t len)
         {
             // Adjust the offsets as needed for bit alignment..
             byteOffset += bitOffset >> 3;
-            bitOffset %= 8;
-
-            // Prepare the bit mask..
-            auto bitmask = (uint64_t)0xFFFFFFFFFFFFFFFFLL;
-            bitmask >>= 64 - len;
-            bitmask <<= bitOffset;
-
-            // Unpack the value based on the size (type)..
-            uint64_t ret;
-            if (len + bitOffset <= 8)
-            {
-                const auto ptr = &data[byteOffset];
-                ret            = (*ptr & (uint8_t)bitmask) >> bitOffset;
-            }
-            else if (len + bitOffset <= 16)
-            {
-                const auto ptr = (uint16_t*)&data[byteOffset];
-                ret            = (*ptr & (uint16_t)bitmask) >> bitOffset;
-            }
-            else if (len + bitOffset <= 32)
-            {
-                const auto ptr = (uint32_t*)&data[byteOffset];
-                ret            = (*ptr & (uint32_t)bitmask) >> bitOffset;
-            }
-            else if (len + bitOffset <= 64)
-            {
-                const auto ptr = (uint64_t*)&data[byteOffset];
-                ret            = (*ptr & bitmask) >> bitOffset;
-            }
-            else
-            {
-                // This should never be hit. (Data size > 64bits.)
-                return 0;
-            }
-
-            return ret;
+            bitOffset &= 7;
+
+            const auto span = bitOffset + len;
+            const auto ptr  = &data[byteOffset];
+
+            // Read the smallest word holding the value.. (Empty values take the byte path, with an empty mask.)
+            if (span <= 8)
+                return (*ptr >> bitOffset) & (0xFFu >> (8 - len));
+            if (span <= 16)
+                return (Ashita::BinaryData::Read<uint16_t>(ptr) >> bitOffset) & (0xFFFFu >> (16 - len));
+            if (span <= 32)
+                return (Ashita::BinaryData::Read<uint32_t>(ptr) >> bitOffset) & (0xFFFFFFFFu >> (32 - len));
+            if (span <= 64)
+                return (Ashita::BinaryData::Read<uint64_t>(ptr) << (64 - span)) >> (64 - len);
+
+            // Combine the first 8 bytes with the byte after them for values that span more than 8 bytes..
+            const auto value = (Ashita::BinaryData::Read<uint64_t>(ptr) >> bitOffset) | ((uint64_t)ptr[8] << (64 - bitOffset));
+            return len >= 64 ? value : value & ((1ull << len) - 1);
         }
 
         /**
@@ -240,7 +216,7 @@ namespace Ashita
          * @param {uint8_t} len - The length of bits to unpack.
          * @return {uint64_t} The unpacked value.
          */
-        static uint64_t UnpackBitsBE(uint8_t* data, const uint32_t offset, const uint8_t len)
+        static uint64_t UnpackBitsBE(const uint8_t* data, const uint32_t offset, const uint8_t len)
         {
             return Ashita::BinaryData::UnpackBitsBE(data, 0, offset, len);
         }
@@ -254,52 +230,28 @@ namespace Ashita
          * @param {uint8_t} len - The length of bits to unpack.
          * @return {uint64_t} The unpacked value.
          */
-        static uint64_t UnpackBitsLE(uint8_t* data, uint32_t byteOffset, uint32_t bitOffset, const uint8_t len)
+        static uint64_t UnpackBitsLE(const uint8_t* data, uint32_t byteOffset, uint32_t bitOffset, uint8_t len)
         {
             // Adjust the offsets as needed for bit alignment..
             byteOffset += bitOffset >> 3;
-            bitOffset %= 8;
-
-            // Determine the bytes required..
-            uint8_t bytesNeeded;
-            if (bitOffset + len <= 8)
-                bytesNeeded = 1;
-            else if (bitOffset + len <= 16)
-                bytesNeeded = 2;
-            else if (bitOffset + len <= 32)
-                bytesNeeded = 4;
-            else if (bitOffset + len <= 64)
-                bytesNeeded = 8;
-            else
-            {
-                // This should never be hit. (Data size > 64bits.)
-                return 0;
-            }
-
-            // Unpack the value based on the size (type)..
-            uint64_t ret;
-            auto modified = new uint8_t[bytesNeeded];
-            for (uint8_t c = 0; c < bytesNeeded; ++c)
-                modified[c] = data[byteOffset + (bytesNeeded - 1) - c];
+            bitOffset &= 7;
 
-            if (bytesNeeded == 1)
-            {
-                const uint8_t mask = 0xFF >> bitOffset;
-                ret                = (uint64_t)(modified[0] & mask) >> (8 - (len + bitOffset));
-            }
-            else
-            {
-                const int32_t nbo = (bytesNeeded * 8) - (bitOffset + len);
-                ret               = Ashita::BinaryData::UnpackBitsBE(&modified[0], 0, nbo, len);
-            }
+            if (len == 0)
+                return 0;
+            if (len > 64)
+                len = 64;
 
-            if (modified)
+            // Split values that span more than 8 bytes into two unpacks..
+            if (bitOffset + len > 64)
             {
-                delete[] modified;
-                modified = nullptr;
+                const auto hi = Ashita::BinaryData::UnpackBitsLE(data, byteOffset, bitOffset, len - 32);
+                const auto lo = Ashita::BinaryData::UnpackBitsLE(data, byteOffset, bitOffset + len - 32, 32);
+                return lo | (hi << 32);
             }
 
-            return ret;
+            const auto size  = (bitOffset + len + 7) >> 3;
+            const auto shift = (size << 3) - (bitOffset + len);
+            return (Ashita::BinaryData::LoadBE(&data[byteOffset], size) >> shift) & Ashita::BinaryData::BitMask(len);
         }
 
         /**
@@ -310,7 +262,7 @@ namespace Ashita
          * @param {uint8_t} len - The length of bits to unpack.
          * @return {uint64_t} The unpacked value.
          */
-        static uint64_t UnpackBitsLE(uint8_t* data, const uint32_t offset, const uint8_t len)
+        static uint64_t UnpackBitsLE(const uint8_t* data, const uint32_t offset, const uint8_t len)
         {
             return Ashita::BinaryData::UnpackBitsLE(data, 0, offset, len);
         }
@@ -370,6 +322,502 @@ namespace Ashita
             }
             return false;
         }
+
+        /**
+         * Returns a mask with the given number of low bits set.
+         *
+         * @param {uint32_t} len - The number of bits to set. (0 to 64.)
+         * @return {uint64_t} The bit mask.
+         */
+        static constexpr uint64_t BitMask(const uint32_t len)
+        {
+            return (0xFFFFFFFFFFFFFFFFull >> ((64 - (len < 64 ? len : 64)) & 63)) & (0ull - (len != 0));
+        }
+
+        /**
+         * Loads up to 8 bytes from the given buffer as a little endian value.
+         *
+         * @param {uint8_t*} data - The data to load from.
+         * @param {uint32_t} size - The number of bytes to load. (1 to 8.)
+         * @return {uint64_t} The loaded value.
+         *
+         * @notes
+         *
+         *      Values are loaded with (at most) two overlapping word reads instead of a byte at a time. Only the
+         *      given number of bytes are read.
+         */
+        static uint64_t LoadLE(const uint8_t* data, const uint32_t size)
+        {
+            if (size >= 4)
+            {
+                const auto lo = (uint64_t)Ashita::BinaryData::Read<uint32_t>(data);
+                const auto hi = (uint64_t)Ashita::BinaryData::Read<uint32_t>(data + size - 4);
+                return lo | (hi << ((size - 4) << 3));
+            }
+            if (size >= 2)
+            {
+                const auto lo = (uint64_t)Ashita::BinaryData::Read<uint16_t>(data);
+                const auto hi = (uint64_t)Ashita::BinaryData::Read<uint16_t>(data + size - 2);
+                return lo | (hi << ((size - 2) << 3));
+            }
+            return data[0];
+        }
+
+        /**
+         * Loads up to 8 bytes from the given buffer as a big endian value.
+         *
+         * @param {uint8_t*} data - The data to load from.
+         * @param {uint32_t} size - The number of bytes to load. (1 to 8.)
+         * @return {uint64_t} The loaded value.
+         */
+        static uint64_t LoadBE(const uint8_t* data, const uint32_t size)
+        {
+            return Ashita::BinaryData::ByteSwap(Ashita::BinaryData::LoadLE(data, size)) >> (64 - (size << 3));
+        }
+
+        /**
+         * Stores up to 8 bytes of the given value into the buffer as little endian.
+         *
+         * @param {uint8_t*} data - The data to store into.
+         * @param {uint64_t} value - The value to store.
+         * @param {uint32_t} size - The number of bytes to store. (1 to 8.)
+         *
+         * @notes
+         *
+         *      Values are stored with (at most) two overlapping word writes, which write the same values to the
+         *      overlapping bytes. Only the given number of bytes are written.
+         */
+        static void StoreLE(uint8_t* data, const uint64_t value, const uint32_t size)
+        {
+            if (size >= 4)
+            {
+                Ashita::BinaryData::Write<uint32_t>(data + size - 4, (uint32_t)(value >> ((size - 4) << 3)));
+                Ashita::BinaryData::Write<uint32_t>(data, (uint32_t)value);
+                return;
+            }
+            if (size >= 2)
+            {
+                Ashita::BinaryData::Write<uint16_t>(data + size - 2, (uint16_t)(value >> ((size - 2) << 3)));
+                Ashita::BinaryData::Write<uint16_t>(data, (uint16_t)value);
+                return;
+            }
+            data[0] = (uint8_t)value;
+        }
+
+        /**
+         * Stores up to 8 bytes of the given value into the buffer as big endian.
+         *
+         * @param {uint8_t*} data - The data to store into.
+         * @param {uint64_t} value - The value to store.
+         * @param {uint32_t} size - The number of bytes to store. (1 to 8.)
+         */
+        static void StoreBE(uint8_t* data, const uint64_t value, const uint32_t size)
+        {
+            Ashita::BinaryData::StoreLE(data, Ashita::BinaryData::ByteSwap(value << (64 - (size << 3))), size);
+        }
+
+    private:
+        /**
+         * Reads an unaligned little endian value from the given buffer. (The SDK targets little endian hosts.)
+         *
+         * @param {uint8_t*} data - The data to read from.
+         * @return {T} The read value.
+         */
+        template<typename T>
+        static T Read(const uint8_t* data)
+        {
+            T ret;
+            std::memcpy(&ret, data, sizeof(T));
+            return ret;
+        }
+
+        /**
+         * Writes an unaligned little endian value to the given buffer. (The SDK targets little endian hosts.)
+         *
+         * @param {uint8_t*} data - The data to write to.
+         * @param {T} value - The value to write.
+         */
+        template<typename T>
+        static void Write(uint8_t* data, const T value)
+        {
+            std::memcpy(data, &value, sizeof(T));
+        }
+
+        /**
+         * Reverses the byte order of the given value.
+         *
+         * @param {uint64_t} value - The value to swap.
+         * @return {uint64_t} The swapped value.
+         */
+        static uint64_t ByteSwap(const uint64_t value)
+        {
+#if defined(_MSC_VER)
+            return ::_byteswap_uint64(value);
+#else
+            return __builtin_bswap64(value);
+#endif
+        }
+    };
+
+    /**
+     * Implements a stateful bit reader over a buffer of packed data.
+     *
+     * Values are read starting from the lowest bit of each byte, matching BinaryData::UnpackBitsBE. Each read
+     * loads the 64bit window starting at the byte of the current position, so a read is a single load, shift and
+     * mask. ReadFields extracts every consecutive field that fits within one window from a single load.
+     *
+     * Reads past the end of the buffer return 0 and flag the reader as overrun.
+     */
+    class BitReader
+    {
+        const uint8_t* m_Data;
+        uint32_t m_Size;     // The size of the data, in bytes.
+        uint32_t m_Position; // The current read position, in bits.
+        uint32_t m_Limit;    // The position below which a full 64bit window can be loaded, in bits.
+        bool m_IsOverrun;
+
+    public:
+        BitReader(const uint8_t* data, const uint32_t size, const uint32_t bitOffset = 0)
+            : m_Data(data)
+            , m_Size(data == nullptr ? 0 : size)
+            , m_Position(0)
+            , m_Limit(0)
+            , m_IsOverrun(false)
+        {
+            if (this->m_Size >= 8)
+                this->m_Limit = (uint32_t)std::min<uint64_t>(((uint64_t)this->m_Size - 7) * 8, 0xFFFFFFFF);
+
+            this->Seek(bitOffset);
+        }
+
+        /**
+         * Reads a value from the buffer.
+         *
+         * @param {uint32_t} len - The number of bits to read. (0 to 64.)
+         * @return {uint64_t} The read value.
+         */
+        uint64_t Read(const uint32_t len)
+        {
+            const auto pos = this->m_Position;
+
+            // Read from a full window when possible..
+            if (pos < this->m_Limit && len <= 56)
+            {
+                this->m_Position = pos + len;
+
+                uint64_t window = 0;
+                std::memcpy(&window, this->m_Data + (pos >> 3), sizeof(window));
+                return (window >> (pos & 7)) & ((1ull << len) - 1);
+            }
+
+            return this->ReadSlow(len);
+        }
+
+        /**
+         * Reads a value from the buffer without advancing the reader.
+         *
+         * @param {uint32_t} len - The number of bits to read. (0 to 64.)
+         * @return {uint64_t} The read value.
+         */
+        uint64_t Peek(const uint32_t len) const
+        {
+            if ((uint64_t)this->m_Position + len > (uint64_t)this->m_Size * 8)
+                return 0;
+
+            return this->Extract(this->m_Position, len);
+        }
+
+        /**
+         * Reads multiple values from the buffer.
+         *
+         * @param {uint8_t*} widths - The number of bits of each value to read.
+         * @param {uint32_t} count - The number of values to read.
+         * @param {uint64_t*} values - The output values.
+         * @return {uint32_t} The number of values read before the end of the buffer was reached.
+         *
+         * @notes
+         *
+         *      Consecutive fields are extracted from a single 64bit window until the next field no longer fits,
+         *      then the window is reloaded at the new position. Fields wider than 56 bits, and fields within the
+         *      last 8 bytes of the buffer, are read individually.
+         */
+        uint32_t ReadFields(const uint8_t* widths, const uint32_t count, uint64_t* values)
+        {
+            auto pos = this->m_Position;
+
+            uint32_t x = 0;
+            while (x < count)
+            {
+                if (pos >= this->m_Limit || widths[x] > 56)
+                {
+                    this->m_Position = pos;
+
+                    values[x] = this->ReadSlow(widths[x]);
+                    if (this->m_IsOverrun)
+                        return x;
+
+                    pos = this->m_Position;
+                    x++;
+                    continue;
+                }
+
+                // Extract each field that fits within the window..
+                uint64_t window = 0;
+                std::memcpy(&window, this->m_Data + (pos >> 3), sizeof(window));
+                window >>= pos & 7;
+
+                // (Later fields must end short of the last bit of the window, which keeps each shift below 64 bits.)
+                const auto end = (pos & ~7u) + 64;
+                do
+                {
+                    const auto len = widths[x];
+
+                    values[x++] = window & ((1ull << len) - 1);
+                    window >>= len;
+                    pos += len;
+                } while (x < count && pos + widths[x] < end);
+            }
+
+            this->m_Position = pos;
+            return count;
+        }
+
+        /**
+         * Reads multiple values from the buffer.
+         *
+         * @param {uint8_t[N]} widths - The number of bits of each value to read.
+         * @param {uint64_t[N]} values - The output values.
+         * @return {uint32_t} The number of values read before the end of the buffer was reached.
+         */
+        template<size_t N>
+        uint32_t ReadFields(const uint8_t (&widths)[N], uint64_t (&values)[N])
+        {
+            return this->ReadFields(widths, (uint32_t)N, values);
+        }
+
+        /**
+         * Skips the given number of bits.
+         *
+         * @param {uint32_t} len - The number of bits to skip.
+         */
+        void Skip(const uint32_t len)
+        {
+            this->Seek(this->m_Position + len);
+        }
+
+        /**
+         * Moves the reader to the given bit position.
+         *
+         * @param {uint32_t} bitOffset - The bit position to move to.
+         */
+        void Seek(const uint32_t bitOffset)
+        {
+            this->m_Position  = bitOffset;
+            this->m_IsOverrun = (uint64_t)bitOffset > (uint64_t)this->m_Size * 8;
+        }
+
+        /**
+         * Moves the reader to the given byte and bit position.
+         *
+         * @param {uint32_t} byteOffset - The byte position to move to.
+         * @param {uint32_t} bitOffset - The bit position, within the byte, to move to.
+         */
+        void Seek(const uint32_t byteOffset, const uint32_t bitOffset)
+        {
+            this->Seek((byteOffset << 3) + bitOffset);
+        }
+
+        /**
+         * Returns the current read position, in bits.
+         *
+         * @return {uint32_t} The current read position.
+         */
+        uint32_t GetPosition(void) const
+        {
+            return this->m_Position;
+        }
+
+        /**
+         * Returns the number of bits remaining in the buffer.
+         *
+         * @return {uint32_t} The number of bits remaining.
+         */
+        uint32_t GetRemaining(void) const
+        {
+            return this->m_Position >= this->m_Size * 8 ? 0 : this->m_Size * 8 - this->m_Position;
+        }
+
+        /**
+         * Returns if a read has gone past the end of the buffer.
+         *
+         * @return {bool} True if overrun, false otherwise.
+         */
+        bool GetIsOverrun(void) const
+        {
+            return this->m_IsOverrun;
+        }
+
+    private:
+        /**
+         * Reads a value that is wider than 56 bits, or that lies within the last 8 bytes of the buffer.
+         *
+         * @param {uint32_t} len - The number of bits to read. (0 to 64.)
+         * @return {uint64_t} The read value.
+         */
+        uint64_t ReadSlow(const uint32_t len)
+        {
+            const auto pos = this->m_Position;
+            this->m_Position += len;
+
+            if ((uint64_t)pos + len > (uint64_t)this->m_Size * 8)
+            {
+                this->m_IsOverrun = true;
+                return 0;
+            }
+
+            return this->Extract(pos, len);
+        }
+
+        /**
+         * Extracts a value from the buffer, reading only the bytes that it spans.
+         *
+         * @param {uint32_t} pos - The bit position of the value. (The value must lie within the buffer.)
+         * @param {uint32_t} len - The number of bits to extract. (0 to 64.)
+         * @return {uint64_t} The extracted value.
+         */
+        uint64_t Extract(const uint32_t pos, const uint32_t len) const
+        {
+            if (len == 0)
+                return 0;
+
+            const auto ptr   = this->m_Data + (pos >> 3);
+            const auto shift = pos & 7;
+            const auto bytes = (shift + len + 7) >> 3;
+
+            auto value = Ashita::BinaryData::LoadLE(ptr, bytes < 8 ? bytes : 8) >> shift;
+            if (bytes > 8)
+                value |= (uint64_t)ptr[8] << (64 - shift);
+
+            return value & Ashita::BinaryData::BitMask(len);
+        }
+    };
+
+    /**
+     * Implements a stateful bit writer over a buffer of packed data.
+     *
+     * Values are written starting from the lowest bit of each byte, matching BinaryData::PackBitsBE. Bits that
+     * are not written to are left untouched, allowing the writer to be used to edit existing packet data.
+     *
+     * Writes past the end of the buffer are discarded and flag the writer as overrun.
+     */
+    class BitWriter
+    {
+        uint8_t* m_Data;
+        uint32_t m_Size;     // The size of the data, in bytes.
+        uint32_t m_Position; // The current write position, in bits.
+        bool m_IsOverrun;
+
+    public:
+        BitWriter(uint8_t* data, const uint32_t size, const uint32_t bitOffset = 0)
+            : m_Data(data)
+            , m_Size(data == nullptr ? 0 : size)
+            , m_Position(bitOffset)
+            , m_IsOverrun(false)
+        {}
+
+        /**
+         * Writes a value to the buffer.
+         *
+         * @param {uint64_t} value - The value to write.
+         * @param {uint32_t} len - The number of bits to write. (0 to 64.)
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Write(const uint64_t value, const uint32_t len)
+        {
+            if (this->m_Position + len > this->m_Size * 8)
+            {
+                this->m_IsOverrun = true;
+                this->m_Position += len;
+                return false;
+            }
+
+            this->m_Position = Ashita::BinaryData::PackBitsBE(this->m_Data, value, 0, this->m_Position, (uint8_t)len);
+            return true;
+        }
+
+        /**
+         * Writes multiple values to the buffer.
+         *
+         * @param {uint64_t*} values - The values to write.
+         * @param {uint8_t*} widths - The number of bits of each value to write.
+         * @param {uint32_t} count - The number of values to write.
+         * @return {uint32_t} The number of values written before the end of the buffer was reached.
+         */
+        uint32_t WriteFields(const uint64_t* values, const uint8_t* widths, const uint32_t count)
+        {
+            for (uint32_t x = 0; x < count; x++)
+            {
+                if (!this->Write(values[x], widths[x]))
+                    return x;
+            }
+
+            return count;
+        }
+
+        /**
+         * Writes multiple values to the buffer.
+         *
+         * @param {uint64_t[N]} values - The values to write.
+         * @param {uint8_t[N]} widths - The number of bits of each value to write.
+         * @return {uint32_t} The number of values written before the end of the buffer was reached.
+         */
+        template<size_t N>
+        uint32_t WriteFields(const uint64_t (&values)[N], const uint8_t (&widths)[N])
+        {
+            return this->WriteFields(values, widths, (uint32_t)N);
+        }
+
+        /**
+         * Moves the writer to the given bit position.
+         *
+         * @param {uint32_t} bitOffset - The bit position to move to.
+         */
+        void Seek(const uint32_t bitOffset)
+        {
+            this->m_Position  = bitOffset;
+            this->m_IsOverrun = bitOffset > this->m_Size * 8;
+        }
+
+        /**
+         * Moves the writer to the given byte and bit position.
+         *
+         * @param {uint32_t} byteOffset - The byte position to move to.
+         * @param {uint32_t} bitOffset - The bit position, within the byte, to move to.
+         */
+        void Seek(const uint32_t byteOffset, const uint32_t bitOffset)
+        {
+            this->Seek((byteOffset << 3) + bitOffset);
+        }
+
+        /**
+         * Returns the current write position, in bits.
+         *
+         * @return {uint32_t} The current write position.
+         */
+        uint32_t GetPosition(void) const
+        {
+            return this->m_Position;
+        }
+
+        /**
+         * Returns if a write has gone past the end of the buffer.
+         *
+         * @return {bool} True if overrun, false otherwise.
+         */
+        bool GetIsOverrun(void) const
+        {
+            return this->m_IsOverrun;
+        }
     };
 
 } // namespace Ashita
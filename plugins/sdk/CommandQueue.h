@@ -0,0 +1,295 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_COMMANDQUEUE_H_INCLUDED
+#define ASHITA_SDK_COMMANDQUEUE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <memory>
+#include <string>
+
+namespace Ashita
+{
+    /**
+     * Command Queue Statistics Object
+     */
+    struct commandqueuestats_t
+    {
+        uint32_t Depth;       // The number of commands currently queued.
+        uint32_t MaxDepth;    // The largest number of commands queued at once.
+        uint64_t Queued;      // The number of commands queued.
+        uint64_t Dropped;     // The number of commands dropped because the queue was full.
+        uint64_t Drained;     // The number of commands drained.
+        uint64_t LatencyMean; // The mean time between a command being queued and drained, in nanoseconds.
+        uint64_t LatencyMax;  // The largest time between a command being queued and drained, in nanoseconds.
+    };
+
+    /**
+     * Command Queue
+     *
+     * A bounded, lock-free, multi-producer single-consumer queue of commands. Commands can be queued from any
+     * thread (ie. plugin worker threads using Ashita::Threading::Thread) without ever blocking, and are drained
+     * into IChatManager::QueueCommand from the game thread, at most a configurable number per frame.
+     *
+     * @notes
+     *
+     *      The queue is based on Dmitry Vyukov's bounded queue: each cell holds a sequence number, so producers
+     *      claim cells with a single compare-exchange and the consumer never touches the producers position.
+     *      Each cell keeps its command string between uses, so queueing only allocates when a command is longer
+     *      than any command previously held by its cell.
+     *
+     *      Drain must only be called from a single thread; the game thread. (ie. from Direct3DPresent.) Commands
+     *      queued while the queue is full are dropped and counted.
+     */
+    class CommandQueue
+    {
+        /**
+         * Queue Cell Object
+         */
+        struct cell_t
+        {
+            std::atomic<uint64_t> Sequence; // The cell sequence. (Equal to the queue position when free, position + 1 when filled.)
+            int32_t Mode;                   // The command mode.
+            uint64_t Time;                  // The time the command was queued.
+            std::string Command;            // The command.
+        };
+
+        std::unique_ptr<cell_t[]> m_Cells;
+        uint64_t m_Mask;
+        std::atomic<uint32_t> m_Budget;
+
+        alignas(64) std::atomic<uint64_t> m_EnqueuePos;
+        alignas(64) std::atomic<uint64_t> m_DequeuePos;
+
+        std::atomic<uint64_t> m_Dropped;
+        std::atomic<uint32_t> m_MaxDepth;
+        std::atomic<uint64_t> m_Drained;
+        std::atomic<uint64_t> m_LatencyTotal;
+        std::atomic<uint64_t> m_LatencyMax;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param {uint32_t} capacity - The number of commands the queue can hold. (Rounded up to a power of two.)
+         * @param {uint32_t} budget - The number of commands drained per frame. (0 for no limit.)
+         */
+        explicit CommandQueue(const uint32_t capacity = 1024, const uint32_t budget = 16)
+            : m_Mask(0)
+            , m_Budget(budget)
+            , m_EnqueuePos(0)
+            , m_DequeuePos(0)
+            , m_Dropped(0)
+            , m_MaxDepth(0)
+            , m_Drained(0)
+            , m_LatencyTotal(0)
+            , m_LatencyMax(0)
+        {
+            uint64_t size = 2;
+            while (size < capacity)
+                size <<= 1;
+
+            this->m_Cells.reset(new cell_t[size]);
+            this->m_Mask = size - 1;
+
+            for (uint64_t x = 0; x < size; x++)
+                this->m_Cells[x].Sequence.store(x, std::memory_order_relaxed);
+        }
+
+        CommandQueue(const CommandQueue&)            = delete;
+        CommandQueue& operator=(const CommandQueue&) = delete;
+
+        /**
+         * Sets the number of commands drained per frame.
+         *
+         * @param {uint32_t} budget - The number of commands. (0 for no limit.)
+         */
+        void SetBudget(const uint32_t budget)
+        {
+            this->m_Budget.store(budget, std::memory_order_relaxed);
+        }
+
+        /**
+         * Returns the number of commands drained per frame.
+         *
+         * @return {uint32_t} The number of commands. (0 for no limit.)
+         */
+        uint32_t GetBudget(void) const
+        {
+            return this->m_Budget.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Returns the number of commands the queue can hold.
+         *
+         * @return {uint32_t} The capacity.
+         */
+        uint32_t GetCapacity(void) const
+        {
+            return (uint32_t)(this->m_Mask + 1);
+        }
+
+        /**
+         * Returns the number of commands currently queued.
+         *
+         * @return {uint32_t} The number of commands.
+         */
+        uint32_t GetDepth(void) const
+        {
+            const auto dequeue = this->m_DequeuePos.load(std::memory_order_relaxed);
+            const auto enqueue = this->m_EnqueuePos.load(std::memory_order_relaxed);
+            return enqueue > dequeue ? (uint32_t)(enqueue - dequeue) : 0;
+        }
+
+        /**
+         * Queues a command. (Can be called from any thread.)
+         *
+         * @param {int32_t} mode - The command mode. (See: IChatManager::QueueCommand)
+         * @param {const char*} command - The command to queue.
+         * @return {bool} True on success, false if the queue is full.
+         */
+        bool Push(const int32_t mode, const char* command)
+        {
+            if (command == nullptr)
+                return false;
+
+            cell_t* cell = nullptr;
+
+            auto pos = this->m_EnqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &this->m_Cells[pos & this->m_Mask];
+
+                const auto seq  = cell->Sequence.load(std::memory_order_acquire);
+                const auto diff = (int64_t)(seq - pos);
+
+                if (diff == 0)
+                {
+                    if (this->m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    // The cell still holds a command from the previous lap; the queue is full..
+                    this->m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                else
+                {
+                    pos = this->m_EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->Mode = mode;
+            cell->Time = CommandQueue::Now();
+            cell->Command.assign(command);
+            cell->Sequence.store(pos + 1, std::memory_order_release);
+
+            // Track the largest depth seen; the consumer may already have drained past this command..
+            const auto dequeue = this->m_DequeuePos.load(std::memory_order_relaxed);
+            const auto depth   = dequeue <= pos + 1 ? (uint32_t)(pos + 1 - dequeue) : 0;
+            auto max         = this->m_MaxDepth.load(std::memory_order_relaxed);
+            while (depth > max && !this->m_MaxDepth.compare_exchange_weak(max, depth, std::memory_order_relaxed))
+            {
+            }
+
+            return true;
+        }
+
+        /**
+         * Drains queued commands, up to the per-frame budget. (Must only be called from the game thread.)
+         *
+         * @param {T*} chat - The chat manager. (Any object implementing QueueCommand(mode, command); ie. IChatManager.)
+         * @return {uint32_t} The number of commands drained.
+         */
+        template<typename T>
+        uint32_t Drain(T* chat)
+        {
+            if (chat == nullptr)
+                return 0;
+
+            const auto now = CommandQueue::Now();
+
+            const auto budget = this->m_Budget.load(std::memory_order_relaxed);
+
+            uint32_t count = 0;
+            auto pos       = this->m_DequeuePos.load(std::memory_order_relaxed);
+
+            while (budget == 0 || count < budget)
+            {
+                auto& cell = this->m_Cells[pos & this->m_Mask];
+                if (cell.Sequence.load(std::memory_order_acquire) != pos + 1)
+                    break;
+
+                chat->QueueCommand(cell.Mode, cell.Command.c_str());
+
+                const auto latency = now > cell.Time ? now - cell.Time : 0;
+                this->m_LatencyTotal.fetch_add(latency, std::memory_order_relaxed);
+                if (latency > this->m_LatencyMax.load(std::memory_order_relaxed))
+                    this->m_LatencyMax.store(latency, std::memory_order_relaxed);
+
+                // Release the cell for the producers next lap..
+                cell.Sequence.store(pos + this->m_Mask + 1, std::memory_order_release);
+                this->m_DequeuePos.store(++pos, std::memory_order_relaxed);
+                count++;
+            }
+
+            this->m_Drained.fetch_add(count, std::memory_order_relaxed);
+            return count;
+        }
+
+        /**
+         * Returns the statistics of the queue.
+         *
+         * @param {commandqueuestats_t*} stats - The statistics object to fill.
+         */
+        void GetStats(commandqueuestats_t* stats) const
+        {
+            if (stats == nullptr)
+                return;
+
+            const auto drained = this->m_Drained.load(std::memory_order_relaxed);
+
+            stats->Depth       = this->GetDepth();
+            stats->MaxDepth    = this->m_MaxDepth.load(std::memory_order_relaxed);
+            stats->Queued      = this->m_EnqueuePos.load(std::memory_order_relaxed);
+            stats->Dropped     = this->m_Dropped.load(std::memory_order_relaxed);
+            stats->Drained     = drained;
+            stats->LatencyMean = drained == 0 ? 0 : this->m_LatencyTotal.load(std::memory_order_relaxed) / drained;
+            stats->LatencyMax  = this->m_LatencyMax.load(std::memory_order_relaxed);
+        }
+
+    private:
+        static uint64_t Now(void)
+        {
+            return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_COMMANDQUEUE_H_INCLUDED
\ No newline at end of file
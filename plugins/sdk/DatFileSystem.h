@@ -0,0 +1,384 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_DATFILESYSTEM_H_INCLUDED
+#define ASHITA_SDK_DATFILESYSTEM_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "MappedFile.h"
+
+namespace Ashita
+{
+    /**
+     * DAT File View
+     *
+     * A read-only view of a mapped DAT file.
+     *
+     * @notes
+     *
+     *      A view keeps its file mapped while it exists, even if the file system has since unmapped it from its
+     *      cache, so a view can be used freely until it is destroyed.
+     */
+    class DatFileView
+    {
+        std::shared_ptr<const MappedFile> m_File;
+
+    public:
+        DatFileView(void) = default;
+        explicit DatFileView(std::shared_ptr<const MappedFile> file)
+            : m_File(std::move(file))
+        {}
+
+        /**
+         * Returns if the view references a mapped file.
+         *
+         * @return {bool} True if valid, false otherwise.
+         */
+        bool IsValid(void) const
+        {
+            return this->m_File != nullptr && this->m_File->IsOpen();
+        }
+
+        /**
+         * Returns the file data.
+         *
+         * @return {const uint8_t*} The file data if valid, nullptr otherwise.
+         */
+        const uint8_t* GetData(void) const
+        {
+            return this->m_File == nullptr ? nullptr : this->m_File->GetData();
+        }
+
+        /**
+         * Returns the size of the file data.
+         *
+         * @return {size_t} The size of the file data.
+         */
+        size_t GetSize(void) const
+        {
+            return this->m_File == nullptr ? 0 : this->m_File->GetSize();
+        }
+    };
+
+    /**
+     * DAT File System Statistics
+     */
+    struct datfilesystemstats_t
+    {
+        uint32_t Views;     // The number of cached views.
+        uint64_t Bytes;     // The size of the cached views, in bytes.
+        uint64_t Hits;      // The number of view requests served from the cache.
+        uint64_t Misses;    // The number of view requests that mapped the file.
+        uint64_t Evictions; // The number of views unmapped from the cache.
+    };
+
+    /**
+     * DAT File System
+     *
+     * Resolves DAT file ids to their files within the games ROM folders and serves them as mapped, read-only
+     * views; so DAT consumers do not need to do their own open/read/close cycles.
+     *
+     * @notes
+     *
+     *      The file tables of each ROM folder (VTABLE.DAT and FTABLE.DAT, then ROM2/VTABLE2.DAT and so on) are
+     *      mapped once when the file system is opened and merged into a single lookup table; later ROM folders
+     *      override the entries of earlier ones.
+     *
+     *      Views are cached by file id. The least recently used views are unmapped from the cache once it holds
+     *      more than the maximum number of views or bytes. Files larger than the byte limit are mapped but not
+     *      cached.
+     *
+     *      Resolving paths is lock-free once opened; view requests are guarded by a lock, so the file system can
+     *      be shared between threads. Open and Close must not overlap with any other call.
+     */
+    class DatFileSystem
+    {
+    public:
+        static constexpr uint32_t RomCount = 9; // The number of ROM folders.
+
+    private:
+        typedef std::pair<uint32_t, std::shared_ptr<const MappedFile>> view_t;
+
+        std::string m_Path;
+        std::vector<uint8_t> m_VTable;  // The ROM folder of each file id. (0 if the file id is unused.)
+        std::vector<uint16_t> m_FTable; // The location of each file id within its ROM folder.
+
+        mutable std::mutex m_Mutex;
+        std::list<view_t> m_Views; // The cached views, most recently used first.
+        std::unordered_map<uint32_t, std::list<view_t>::iterator> m_Lookup;
+        uint32_t m_MaxViews;
+        uint64_t m_MaxBytes;
+        datfilesystemstats_t m_Stats;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param {uint32_t} maxViews - The maximum number of cached views.
+         * @param {uint64_t} maxBytes - The maximum size of the cached views, in bytes.
+         */
+        explicit DatFileSystem(const uint32_t maxViews = 128, const uint64_t maxBytes = 256 * 1024 * 1024)
+            : m_MaxViews(maxViews)
+            , m_MaxBytes(maxBytes)
+            , m_Stats{}
+        {}
+
+        DatFileSystem(const DatFileSystem&)            = delete;
+        DatFileSystem& operator=(const DatFileSystem&) = delete;
+
+        /**
+         * Opens the file system, reading the file tables of the given game install path.
+         *
+         * @param {const char*} path - The game install path. (ie. from Registry::GetInstallPath)
+         * @return {bool} True on success, false otherwise. (Fails if the main file tables cannot be read.)
+         */
+        bool Open(const char* path)
+        {
+            this->Close();
+
+            if (path == nullptr || path[0] == '\0')
+                return false;
+
+            this->m_Path = path;
+            if (this->m_Path.back() == '\\' || this->m_Path.back() == '/')
+                this->m_Path.pop_back();
+
+            for (uint32_t x = 1; x <= DatFileSystem::RomCount; x++)
+            {
+                const auto rom = x == 1 ? std::string() : std::to_string(x);
+                const auto dir = x == 1 ? this->m_Path : this->m_Path + DatFileSystem::Separator + "ROM" + rom;
+
+                MappedFile vtable;
+                MappedFile ftable;
+                if (!vtable.Open((dir + DatFileSystem::Separator + "VTABLE" + rom + ".DAT").c_str()) || !ftable.Open((dir + DatFileSystem::Separator + "FTABLE" + rom + ".DAT").c_str()))
+                {
+                    // The main file tables are required; the others are only present if installed..
+                    if (x == 1)
+                    {
+                        this->Close();
+                        return false;
+                    }
+                    continue;
+                }
+
+                const auto count = vtable.GetSize();
+                if (count > this->m_VTable.size())
+                {
+                    this->m_VTable.resize(count, 0);
+                    this->m_FTable.resize(count, 0);
+                }
+
+                // Merge the tables; entries of later ROM folders override earlier ones..
+                const auto fcount = std::min(count, ftable.GetSize() / 2);
+                for (size_t y = 0; y < count; y++)
+                {
+                    if (vtable.GetData()[y] != 0)
+                        this->m_VTable[y] = vtable.GetData()[y];
+                }
+                for (size_t y = 0; y < fcount; y++)
+                {
+                    uint16_t f = 0;
+                    std::memcpy(&f, ftable.GetData() + y * 2, sizeof(f));
+                    if (f != 0)
+                        this->m_FTable[y] = f;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Closes the file system, unmapping every cached view.
+         */
+        void Close(void)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            this->m_Path.clear();
+            this->m_VTable.clear();
+            this->m_FTable.clear();
+            this->m_Views.clear();
+            this->m_Lookup.clear();
+            this->m_Stats = {};
+        }
+
+        /**
+         * Returns if the file system is open.
+         *
+         * @return {bool} True if open, false otherwise.
+         */
+        bool IsOpen(void) const
+        {
+            return !this->m_VTable.empty();
+        }
+
+        /**
+         * Returns the number of file ids in the file tables.
+         *
+         * @return {uint32_t} The number of file ids.
+         */
+        uint32_t GetFileCount(void) const
+        {
+            return (uint32_t)this->m_VTable.size();
+        }
+
+        /**
+         * Returns the path of a DAT file.
+         *
+         * @param {uint32_t} fileId - The DAT file id.
+         * @return {std::string} The path of the file, empty if the file id is unused.
+         */
+        std::string GetFilePath(const uint32_t fileId) const
+        {
+            if (fileId >= this->m_VTable.size() || this->m_VTable[fileId] == 0)
+                return std::string();
+
+            const auto rom = this->m_VTable[fileId];
+            const auto loc = this->m_FTable[fileId];
+
+            auto ret = this->m_Path + DatFileSystem::Separator + "ROM";
+            if (rom > 1)
+                ret += std::to_string(rom);
+
+            return ret + DatFileSystem::Separator + std::to_string(loc >> 7) + DatFileSystem::Separator + std::to_string(loc & 0x7F) + ".DAT";
+        }
+
+        /**
+         * Returns a mapped view of a DAT file.
+         *
+         * @param {uint32_t} fileId - The DAT file id.
+         * @return {DatFileView} The view of the file. (Invalid if the file id is unused or the file could not be mapped.)
+         */
+        DatFileView GetFileView(const uint32_t fileId)
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+                const auto iter = this->m_Lookup.find(fileId);
+                if (iter != this->m_Lookup.end())
+                {
+                    this->m_Views.splice(this->m_Views.begin(), this->m_Views, iter->second);
+                    this->m_Stats.Hits++;
+                    return DatFileView(iter->second->second);
+                }
+            }
+
+            const auto path = this->GetFilePath(fileId);
+            if (path.empty())
+                return DatFileView();
+
+            // Map the file outside of the lock, so other views are not blocked by the file system..
+            auto file = std::make_shared<MappedFile>();
+            if (!file->Open(path.c_str()))
+                return DatFileView();
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            this->m_Stats.Misses++;
+
+            // Another thread may have mapped the same file meanwhile..
+            const auto iter = this->m_Lookup.find(fileId);
+            if (iter != this->m_Lookup.end())
+            {
+                this->m_Views.splice(this->m_Views.begin(), this->m_Views, iter->second);
+                return DatFileView(iter->second->second);
+            }
+
+            if (file->GetSize() <= this->m_MaxBytes && this->m_MaxViews > 0)
+            {
+                this->m_Views.emplace_front(fileId, file);
+                this->m_Lookup[fileId] = this->m_Views.begin();
+                this->m_Stats.Views++;
+                this->m_Stats.Bytes += file->GetSize();
+                this->Evict();
+            }
+
+            return DatFileView(std::move(file));
+        }
+
+        /**
+         * Sets the limits of the view cache, unmapping views as needed.
+         *
+         * @param {uint32_t} maxViews - The maximum number of cached views.
+         * @param {uint64_t} maxBytes - The maximum size of the cached views, in bytes.
+         */
+        void SetLimits(const uint32_t maxViews, const uint64_t maxBytes)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            this->m_MaxViews = maxViews;
+            this->m_MaxBytes = maxBytes;
+            this->Evict();
+        }
+
+        /**
+         * Returns the statistics of the view cache.
+         *
+         * @param {datfilesystemstats_t*} stats - The statistics object to fill.
+         */
+        void GetStats(datfilesystemstats_t* stats) const
+        {
+            if (stats == nullptr)
+                return;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            *stats = this->m_Stats;
+        }
+
+    private:
+#if defined(_WIN32)
+        static constexpr char Separator = '\\';
+#else
+        static constexpr char Separator = '/';
+#endif
+
+        void Evict(void)
+        {
+            while (!this->m_Views.empty() && (this->m_Stats.Views > this->m_MaxViews || this->m_Stats.Bytes > this->m_MaxBytes))
+            {
+                const auto& back = this->m_Views.back();
+
+                this->m_Stats.Views--;
+                this->m_Stats.Bytes -= back.second->GetSize();
+                this->m_Stats.Evictions++;
+
+                this->m_Lookup.erase(back.first);
+                this->m_Views.pop_back();
+            }
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_DATFILESYSTEM_H_INCLUDED
\ No newline at end of file
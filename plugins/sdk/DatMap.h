@@ -0,0 +1,463 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_DATMAP_H_INCLUDED
+#define ASHITA_SDK_DATMAP_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Threading.h"
+
+namespace Ashita
+{
+    /**
+     * DAT Map Entry
+     *
+     * An entry of a DAT map configuration file. (ie. ashita.datmap.ini)
+     */
+    struct datmapentry_t
+    {
+        std::string Section;              // The entry section name. (Unique id of the entry.)
+        std::string Name;                 // The cache map entry name. (Entries with the same name merge into the same cache.)
+        uint32_t Type;                    // The DAT type. (Determines the parser used to read the file.)
+        bool Threaded;                    // Flag if the entry was marked as threaded.
+        uint32_t NaId;                    // The file id of the English DAT.
+        uint32_t JpId;                    // The file id of the Japanese DAT.
+        int32_t NaParam;                  // The parser parameter of the English DAT.
+        int32_t JpParam;                  // The parser parameter of the Japanese DAT.
+        std::vector<std::string> Depends; // The cache names that must be fully merged before this entry is parsed.
+    };
+
+    /**
+     * DAT Parse Statistics
+     *
+     * The timings of a single DAT map entry, from the last pipeline run.
+     */
+    struct datparsestats_t
+    {
+        uint32_t Entry;     // The index of the entry.
+        uint64_t Start;     // The time the entry started parsing, in microseconds since the run started.
+        uint64_t ParseTime; // The time spent parsing the entry, in microseconds.
+        uint64_t MergeTime; // The time spent merging the entry into its cache, in microseconds.
+        bool IsParsed;      // Flag if the entry was parsed successfully.
+    };
+
+    namespace DatMap
+    {
+        /**
+         * Loads the entries of a DAT map configuration.
+         *
+         * @param {T*} config - The configuration manager. (Any object implementing GetSections, GetString and GetInt32; ie. IConfigurationManager.)
+         * @param {const char*} alias - The alias of the loaded DAT map configuration.
+         * @param {std::vector*} entries - The entries to fill. (Entries with a matching section are replaced, so overrides can be loaded last.)
+         * @return {bool} True on success, false otherwise.
+         */
+        template<typename T>
+        bool Load(T* config, const char* alias, std::vector<datmapentry_t>* entries)
+        {
+            if (config == nullptr || alias == nullptr || entries == nullptr)
+                return false;
+
+            std::vector<char> buffer(16384, '\0');
+            if (config->GetSections(alias, buffer.data(), (uint32_t)buffer.size() - 1) == 0)
+                return true;
+
+            const std::string sections(buffer.data());
+
+            // Splits a comma or new-line separated list, trimming whitespace..
+            const auto split = [](const std::string& str, const char* separators) {
+                std::vector<std::string> ret;
+
+                size_t pos = 0;
+                while (pos <= str.size())
+                {
+                    auto end = str.find_first_of(separators, pos);
+                    if (end == std::string::npos)
+                        end = str.size();
+
+                    const auto first = str.find_first_not_of(" \t\r", pos);
+                    const auto last  = str.find_last_not_of(" \t\r", end == 0 ? 0 : end - 1);
+                    if (first != std::string::npos && first < end && last != std::string::npos && last >= first)
+                        ret.push_back(str.substr(first, last - first + 1));
+
+                    pos = end + 1;
+                }
+
+                return ret;
+            };
+
+            for (const auto& section : split(sections, "\n"))
+            {
+                const auto name = config->GetString(alias, section.c_str(), "name");
+                if (name == nullptr || name[0] == '\0')
+                    continue;
+
+                datmapentry_t entry{};
+                entry.Section  = section;
+                entry.Name     = name;
+                entry.Type     = (uint32_t)config->GetInt32(alias, section.c_str(), "type", 0);
+                entry.Threaded = config->GetInt32(alias, section.c_str(), "threaded", 0) != 0;
+                entry.NaId     = (uint32_t)config->GetInt32(alias, section.c_str(), "na_id", 0);
+                entry.JpId     = (uint32_t)config->GetInt32(alias, section.c_str(), "jp_id", 0);
+                entry.NaParam  = config->GetInt32(alias, section.c_str(), "na_param", 0);
+                entry.JpParam  = config->GetInt32(alias, section.c_str(), "jp_param", 0);
+
+                if (const auto depends = config->GetString(alias, section.c_str(), "depends"); depends != nullptr)
+                    entry.Depends = split(depends, ",");
+
+                auto iter = std::find_if(entries->begin(), entries->end(), [&section](const datmapentry_t& e) {
+                    return e.Section == section;
+                });
+
+                if (iter != entries->end())
+                    *iter = std::move(entry);
+                else
+                    entries->push_back(std::move(entry));
+            }
+
+            return true;
+        }
+    } // namespace DatMap
+
+    /**
+     * DAT Map Pipeline
+     *
+     * Parses the entries of a DAT map on a task pool, scheduled by an explicit dependency graph instead of the
+     * legacy two-phase (non-threaded, then threaded) order.
+     *
+     * @notes
+     *
+     *      Each entry is parsed into its own result object, independently of every other entry, and then merged
+     *      into its named cache. The graph holds two nodes per entry:
+     *
+     *          - Parse: depends on the final merge of every cache listed in the entries Depends.
+     *          - Merge: depends on the entries own parse, and on the merge of the previous entry of the same name.
+     *
+     *      Merges into the same cache therefore always happen in the order the entries are listed, so the result
+     *      is identical to parsing the entries serially. Merges into different caches may run at the same time,
+     *      so the merge function must be safe to call concurrently for different names.
+     *
+     *      Entries not marked as threaded are parsed at a higher priority, as the core looks up their caches by name.
+     *
+     *      An entry that fails to parse is not merged; the entries that depend on it still run.
+     */
+    template<typename T>
+    class DatMapPipeline
+    {
+    public:
+        typedef std::function<bool(const datmapentry_t& entry, T* result)> parser_f;
+        typedef std::function<void(const datmapentry_t& entry, T& result)> merger_f;
+
+    private:
+        /**
+         * Graph Node Object
+         */
+        struct node_t
+        {
+            uint32_t Dependencies;            // The number of nodes this node depends on.
+            std::vector<uint32_t> Dependents; // The nodes depending on this node.
+        };
+
+        /**
+         * Run State Object
+         */
+        struct run_t
+        {
+            Threading::TaskPool* Pool;
+            const parser_f* Parser;
+            const merger_f* Merger;
+            std::chrono::steady_clock::time_point Start;
+            std::unique_ptr<std::atomic<uint32_t>[]> Remaining; // The number of unfinished dependencies of each node.
+            std::vector<T> Results;
+            std::mutex Mutex;
+            std::condition_variable Condition;
+            uint32_t Finished;
+        };
+
+        std::vector<datmapentry_t> m_Entries;
+        std::vector<node_t> m_Nodes; // The graph nodes. (Parse node of entry x at x * 2, its merge node at x * 2 + 1.)
+        std::vector<uint32_t> m_Order;
+        std::vector<datparsestats_t> m_Stats;
+        uint64_t m_Elapsed;
+
+    public:
+        DatMapPipeline(void)
+            : m_Elapsed(0)
+        {}
+
+        /**
+         * Builds the dependency graph of the given entries.
+         *
+         * @param {std::vector} entries - The DAT map entries, in the order they are listed.
+         * @return {bool} True on success, false if an entry depends on an unknown cache or the dependencies form a cycle.
+         */
+        bool Build(const std::vector<datmapentry_t>& entries)
+        {
+            this->m_Entries = entries;
+            this->m_Nodes.assign(entries.size() * 2, node_t{0, {}});
+            this->m_Order.clear();
+            this->m_Stats.clear();
+
+            const auto link = [this](const uint32_t from, const uint32_t to) {
+                this->m_Nodes[from].Dependents.push_back(to);
+                this->m_Nodes[to].Dependencies++;
+            };
+
+            // Returns the last entry of the given cache name..
+            const auto last = [&entries](const std::string& name) {
+                auto ret = (uint32_t)entries.size();
+                for (uint32_t x = 0; x < (uint32_t)entries.size(); x++)
+                {
+                    if (entries[x].Name == name)
+                        ret = x;
+                }
+                return ret;
+            };
+
+            for (uint32_t x = 0; x < (uint32_t)entries.size(); x++)
+            {
+                link(x * 2, x * 2 + 1);
+
+                for (auto y = (int32_t)x - 1; y >= 0; y--)
+                {
+                    if (entries[y].Name == entries[x].Name)
+                    {
+                        link(y * 2 + 1, x * 2 + 1);
+                        break;
+                    }
+                }
+
+                for (const auto& name : entries[x].Depends)
+                {
+                    const auto dep = last(name);
+                    if (dep == entries.size())
+                        return false;
+
+                    link(dep * 2 + 1, x * 2);
+                }
+            }
+
+            // Order the nodes topologically, which also detects cycles..
+            std::vector<uint32_t> remaining(this->m_Nodes.size());
+            for (uint32_t x = 0; x < (uint32_t)this->m_Nodes.size(); x++)
+            {
+                remaining[x] = this->m_Nodes[x].Dependencies;
+                if (remaining[x] == 0)
+                    this->m_Order.push_back(x);
+            }
+
+            for (size_t x = 0; x < this->m_Order.size(); x++)
+            {
+                for (const auto d : this->m_Nodes[this->m_Order[x]].Dependents)
+                {
+                    if (--remaining[d] == 0)
+                        this->m_Order.push_back(d);
+                }
+            }
+
+            return this->m_Order.size() == this->m_Nodes.size();
+        }
+
+        /**
+         * Returns the entries of the built graph.
+         *
+         * @return {const std::vector&} The entries.
+         */
+        const std::vector<datmapentry_t>& GetEntries(void) const
+        {
+            return this->m_Entries;
+        }
+
+        /**
+         * Parses and merges every entry, blocking until all have completed.
+         *
+         * @param {Threading::TaskPool*} pool - The task pool to run on. (nullptr to run serially on the calling thread.)
+         * @param {parser_f&} parser - The parser function.
+         * @param {merger_f&} merger - The merge function.
+         * @return {bool} True if every entry was parsed, false otherwise.
+         */
+        bool Run(Threading::TaskPool* pool, const parser_f& parser, const merger_f& merger)
+        {
+            if (this->m_Order.size() != this->m_Nodes.size() || !parser || !merger)
+                return false;
+
+            run_t run;
+            run.Pool      = pool;
+            run.Parser    = &parser;
+            run.Merger    = &merger;
+            run.Start     = std::chrono::steady_clock::now();
+            run.Remaining = std::make_unique<std::atomic<uint32_t>[]>(this->m_Nodes.size());
+            run.Results.resize(this->m_Entries.size());
+            run.Finished = 0;
+
+            this->m_Stats.assign(this->m_Entries.size(), datparsestats_t{});
+            for (uint32_t x = 0; x < (uint32_t)this->m_Entries.size(); x++)
+                this->m_Stats[x].Entry = x;
+
+            if (pool == nullptr)
+            {
+                for (const auto node : this->m_Order)
+                    this->Execute(&run, node);
+            }
+            else
+            {
+                for (uint32_t x = 0; x < (uint32_t)this->m_Nodes.size(); x++)
+                    run.Remaining[x].store(this->m_Nodes[x].Dependencies, std::memory_order_relaxed);
+                for (uint32_t x = 0; x < (uint32_t)this->m_Nodes.size(); x++)
+                {
+                    if (this->m_Nodes[x].Dependencies == 0)
+                        this->Schedule(&run, x);
+                }
+
+                // Help run the queued tasks while waiting..
+                const auto finished = [&run, this]() {
+                    return run.Finished == this->m_Nodes.size();
+                };
+
+                for (;;)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(run.Mutex);
+                        if (finished())
+                            break;
+                    }
+
+                    if (!pool->RunOne())
+                    {
+                        std::unique_lock<std::mutex> lock(run.Mutex);
+                        run.Condition.wait_for(lock, std::chrono::milliseconds(1), finished);
+                    }
+                }
+            }
+
+            this->m_Elapsed = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - run.Start).count();
+
+            return std::all_of(this->m_Stats.begin(), this->m_Stats.end(), [](const datparsestats_t& s) {
+                return s.IsParsed;
+            });
+        }
+
+        /**
+         * Returns the statistics of each entry from the last run. (Ordered as the entries.)
+         *
+         * @return {const std::vector&} The statistics.
+         */
+        const std::vector<datparsestats_t>& GetStats(void) const
+        {
+            return this->m_Stats;
+        }
+
+        /**
+         * Returns the total time of the last run.
+         *
+         * @return {uint64_t} The elapsed time, in microseconds.
+         */
+        uint64_t GetElapsed(void) const
+        {
+            return this->m_Elapsed;
+        }
+
+    private:
+        void Schedule(run_t* run, const uint32_t node)
+        {
+            const auto priority = (node & 1) == 0 && !this->m_Entries[node / 2].Threaded ? Threading::ThreadPriority::AboveNormal : Threading::ThreadPriority::Normal;
+
+            auto task = [this, run, node]() {
+                this->Execute(run, node);
+
+                for (const auto d : this->m_Nodes[node].Dependents)
+                {
+                    if (run->Remaining[d].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        this->Schedule(run, d);
+                }
+
+                // Nothing may touch the run state once the last node is marked finished..
+                std::lock_guard<std::mutex> lock(run->Mutex);
+                if (++run->Finished == this->m_Nodes.size())
+                    run->Condition.notify_all();
+            };
+
+            run->Pool->Push(std::move(task), priority);
+        }
+
+        void Execute(run_t* run, const uint32_t node)
+        {
+            const auto index  = node / 2;
+            const auto& entry = this->m_Entries[index];
+            auto& stats       = this->m_Stats[index];
+            auto& result      = run->Results[index];
+
+            const auto start = std::chrono::steady_clock::now();
+
+            if ((node & 1) == 0)
+            {
+                stats.Start = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(start - run->Start).count();
+
+                try
+                {
+                    stats.IsParsed = (*run->Parser)(entry, &result);
+                }
+                catch (...)
+                {
+                    stats.IsParsed = false;
+                }
+
+                stats.ParseTime = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            }
+            else
+            {
+                if (stats.IsParsed)
+                {
+                    try
+                    {
+                        (*run->Merger)(entry, result);
+                    }
+                    catch (...)
+                    {
+                        stats.IsParsed = false;
+                    }
+                }
+
+                // Release the parsed result once merged..
+                result = T{};
+
+                stats.MergeTime = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            }
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_DATMAP_H_INCLUDED
\ No newline at end of file
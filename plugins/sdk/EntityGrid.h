@@ -0,0 +1,495 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ASHITA_SDK_ENTITYGRID_H_INCLUDED
+#define ASHITA_SDK_ENTITYGRID_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <cmath>
+
+namespace Ashita
+{
+    /**
+     * Entity Filter Object
+     *
+     * Filters the entities returned by the EntityGrid queries. Zeroed fields are ignored.
+     */
+    struct entityfilter_t
+    {
+        uint32_t SpawnFlags;   // Entities must have any of these spawn flags set.
+        uint32_t Types;        // Entities must be one of these types. (Bitmask of 1 << entity type.)
+        uint32_t RenderFlags0; // Entities must have all of these render flags set.
+        uint32_t Exclude;      // The entity index to exclude. (ie. the player.) (0xFFFFFFFF if unused.)
+
+        entityfilter_t(void)
+            : SpawnFlags(0)
+            , Types(0)
+            , RenderFlags0(0)
+            , Exclude(0xFFFFFFFF)
+        {}
+    };
+
+    /**
+     * Entity Grid
+     *
+     * A spatial index over the entity table, for nearest, radius and cone queries.
+     *
+     * @notes
+     *
+     *      Entities are bucketed into a uniform grid of cells over their X and Z positions. The grid is hashed
+     *      (cell coordinates wrap around the table), so it covers a zone of any size without knowing its bounds;
+     *      entities from far away cells that share a bucket are rejected by their distance.
+     *
+     *      Moving an entity only touches the grid when it crosses into another cell, so the grid can be updated
+     *      with every entity each frame at little cost, and then be queried any number of times. Queries only
+     *      visit the cells overlapping their search area instead of every entity slot.
+     *
+     *      The grid is not thread-safe; it should be updated and queried from the same thread. (ie. the render
+     *      thread.)
+     */
+    class EntityGrid
+    {
+    public:
+        static constexpr uint32_t MaxEntities  = 2304;       // The number of entity slots.
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF; // The index used for unused links.
+
+    private:
+        static constexpr float CellSize    = 16.0f; // The size of a cell, in yalms.
+        static constexpr int32_t GridSize  = 64;    // The number of cells per grid axis. (Must be a power of two.)
+        static constexpr int32_t MaxRings  = GridSize / 2;
+
+        /**
+         * Entity Entry Object
+         */
+        struct entry_t
+        {
+            float X;               // The entity X position.
+            float Z;               // The entity Z position.
+            uint32_t SpawnFlags;   // The entity spawn flags.
+            uint32_t RenderFlags0; // The entity render flags.
+            uint32_t Bucket;       // The bucket the entity is linked into. (InvalidIndex if not in the grid.)
+            uint32_t Prev;         // The previous entity of the bucket.
+            uint32_t Next;         // The next entity of the bucket.
+            uint8_t Type;          // The entity type.
+        };
+
+        std::array<entry_t, MaxEntities> m_Entries;
+        std::array<uint32_t, GridSize * GridSize> m_Buckets; // The first entity of each bucket.
+        uint32_t m_Count;
+
+    public:
+        EntityGrid(void)
+        {
+            this->Clear();
+        }
+
+        /**
+         * Removes every entity from the grid.
+         */
+        void Clear(void)
+        {
+            for (auto& e : this->m_Entries)
+                e = {0.0f, 0.0f, 0, 0, InvalidIndex, InvalidIndex, InvalidIndex, 0};
+
+            this->m_Buckets.fill(InvalidIndex);
+            this->m_Count = 0;
+        }
+
+        /**
+         * Returns the number of entities in the grid.
+         *
+         * @return {uint32_t} The number of entities.
+         */
+        uint32_t GetCount(void) const
+        {
+            return this->m_Count;
+        }
+
+        /**
+         * Returns if the given entity index is in the grid.
+         *
+         * @param {uint32_t} index - The entity index.
+         * @return {bool} True if in the grid, false otherwise.
+         */
+        bool Contains(const uint32_t index) const
+        {
+            return index < MaxEntities && this->m_Entries[index].Bucket != InvalidIndex;
+        }
+
+        /**
+         * Adds or moves an entity within the grid.
+         *
+         * @param {uint32_t} index - The entity index.
+         * @param {float} x - The entity X position.
+         * @param {float} z - The entity Z position.
+         * @param {uint32_t} spawnFlags - The entity spawn flags.
+         * @param {uint8_t} type - The entity type.
+         * @param {uint32_t} renderFlags0 - The entity render flags.
+         */
+        void Update(const uint32_t index, const float x, const float z, const uint32_t spawnFlags, const uint8_t type, const uint32_t renderFlags0)
+        {
+            if (index >= MaxEntities || !std::isfinite(x) || !std::isfinite(z))
+                return;
+
+            auto& e        = this->m_Entries[index];
+            e.X            = x;
+            e.Z            = z;
+            e.SpawnFlags   = spawnFlags;
+            e.RenderFlags0 = renderFlags0;
+            e.Type         = type;
+
+            // Relink the entity only if it has moved into another bucket..
+            const auto bucket = EntityGrid::GetBucket(EntityGrid::GetCell(x), EntityGrid::GetCell(z));
+            if (e.Bucket == bucket)
+                return;
+
+            this->Unlink(index);
+
+            e.Bucket = bucket;
+            e.Prev   = InvalidIndex;
+            e.Next   = this->m_Buckets[bucket];
+            if (e.Next != InvalidIndex)
+                this->m_Entries[e.Next].Prev = index;
+
+            this->m_Buckets[bucket] = index;
+            this->m_Count++;
+        }
+
+        /**
+         * Removes an entity from the grid.
+         *
+         * @param {uint32_t} index - The entity index.
+         */
+        void Remove(const uint32_t index)
+        {
+            if (index < MaxEntities)
+                this->Unlink(index);
+        }
+
+        /**
+         * Updates the grid from the given entity manager.
+         *
+         * @param {T*} entity - The entity manager. (Any object implementing the IEntity getters; ie. IEntity.)
+         * @notes
+         *
+         *      Entities without an actor (ie. not spawned or not rendered) are removed from the grid.
+         */
+        template<typename T>
+        void Rebuild(const T* entity)
+        {
+            if (entity == nullptr)
+            {
+                this->Clear();
+                return;
+            }
+
+            for (uint32_t x = 0; x < MaxEntities; x++)
+            {
+                if (entity->GetActorPointer(x) == 0)
+                    this->Unlink(x);
+                else
+                    this->Update(x, entity->GetLocalPositionX(x), entity->GetLocalPositionZ(x), entity->GetSpawnFlags(x), entity->GetType(x), entity->GetRenderFlags0(x));
+            }
+        }
+
+        /**
+         * Returns the entities within the given radius of a position.
+         *
+         * @param {float} x - The X position.
+         * @param {float} z - The Z position.
+         * @param {float} radius - The radius to search within.
+         * @param {entityfilter_t&} filter - The filter entities must match.
+         * @param {uint32_t*} indexes - The buffer to receive the matching entity indexes.
+         * @param {uint32_t} maxCount - The size of the buffer.
+         * @param {F&} pred - Additional predicate entities must match. (Called with the entity index.)
+         * @return {uint32_t} The number of matching entities written to the buffer.
+         */
+        template<typename F>
+        uint32_t FindInRadius(const float x, const float z, const float radius, const entityfilter_t& filter, uint32_t* indexes, const uint32_t maxCount, const F& pred) const
+        {
+            if (indexes == nullptr || maxCount == 0 || !(radius >= 0.0f))
+                return 0;
+
+            uint32_t count = 0;
+            this->Visit(x, z, radius, [&](const uint32_t index, const float distSq) -> bool {
+                if (distSq > radius * radius || !EntityGrid::Matches(this->m_Entries[index], index, filter) || !pred(index))
+                    return true;
+
+                indexes[count++] = index;
+                return count < maxCount;
+            });
+
+            return count;
+        }
+
+        uint32_t FindInRadius(const float x, const float z, const float radius, const entityfilter_t& filter, uint32_t* indexes, const uint32_t maxCount) const
+        {
+            return this->FindInRadius(x, z, radius, filter, indexes, maxCount, [](uint32_t) { return true; });
+        }
+
+        /**
+         * Returns the entities within the given cone.
+         *
+         * @param {float} x - The X position of the cone origin.
+         * @param {float} z - The Z position of the cone origin.
+         * @param {float} yaw - The heading of the cone, in radians. (ie. an entities LocalPositionYaw.)
+         * @param {float} angle - The half angle of the cone, in radians.
+         * @param {float} radius - The length of the cone.
+         * @param {entityfilter_t&} filter - The filter entities must match.
+         * @param {uint32_t*} indexes - The buffer to receive the matching entity indexes.
+         * @param {uint32_t} maxCount - The size of the buffer.
+         * @param {F&} pred - Additional predicate entities must match. (Called with the entity index.)
+         * @return {uint32_t} The number of matching entities written to the buffer.
+         */
+        template<typename F>
+        uint32_t FindInCone(const float x, const float z, const float yaw, const float angle, const float radius, const entityfilter_t& filter, uint32_t* indexes, const uint32_t maxCount, const F& pred) const
+        {
+            // The client heading points along +X at 0 and turns towards -Z..
+            const auto dx     = std::cos(yaw);
+            const auto dz     = -std::sin(yaw);
+            const auto cosine = std::cos(std::min(std::max(angle, 0.0f), 3.14159265f));
+
+            return this->FindInRadius(x, z, radius, filter, indexes, maxCount, [&](const uint32_t index) -> bool {
+                const auto& e  = this->m_Entries[index];
+                const auto ex  = e.X - x;
+                const auto ez  = e.Z - z;
+                const auto len = std::sqrt(ex * ex + ez * ez);
+
+                // Entities at the origin of the cone are always within it..
+                if (len > 0.0f && (ex * dx + ez * dz) < cosine * len)
+                    return false;
+
+                return pred(index);
+            });
+        }
+
+        uint32_t FindInCone(const float x, const float z, const float yaw, const float angle, const float radius, const entityfilter_t& filter, uint32_t* indexes, const uint32_t maxCount) const
+        {
+            return this->FindInCone(x, z, yaw, angle, radius, filter, indexes, maxCount, [](uint32_t) { return true; });
+        }
+
+        /**
+         * Returns the entities nearest to a position, ordered by their distance.
+         *
+         * @param {float} x - The X position.
+         * @param {float} z - The Z position.
+         * @param {float} maxDistance - The maximum distance to search within.
+         * @param {entityfilter_t&} filter - The filter entities must match.
+         * @param {uint32_t*} indexes - The buffer to receive the nearest entity indexes.
+         * @param {uint32_t} maxCount - The number of entities to find. (The size of the buffer.)
+         * @param {F&} pred - Additional predicate entities must match. (Called with the entity index.)
+         * @return {uint32_t} The number of entities written to the buffer.
+         */
+        template<typename F>
+        uint32_t FindNearest(const float x, const float z, const float maxDistance, const entityfilter_t& filter, uint32_t* indexes, const uint32_t maxCount, const F& pred) const
+        {
+            if (indexes == nullptr || maxCount == 0 || !(maxDistance >= 0.0f))
+                return 0;
+
+            // Keep the best matches sorted in the buffer, alongside their squared distances..
+            std::array<float, MaxEntities> dists;
+            const auto limit = maxCount < MaxEntities ? maxCount : MaxEntities;
+            uint32_t count   = 0;
+
+            const auto visit = [&](const uint32_t index, const float distSq) -> bool {
+                if (distSq > maxDistance * maxDistance)
+                    return true;
+                if (count == limit && distSq >= dists[count - 1])
+                    return true;
+                if (!EntityGrid::Matches(this->m_Entries[index], index, filter) || !pred(index))
+                    return true;
+
+                auto pos = count < limit ? count++ : count - 1;
+                while (pos > 0 && dists[pos - 1] > distSq)
+                {
+                    dists[pos]   = dists[pos - 1];
+                    indexes[pos] = indexes[pos - 1];
+                    pos--;
+                }
+
+                dists[pos]   = distSq;
+                indexes[pos] = index;
+                return true;
+            };
+            const auto stop = [&](const float searched) -> bool {
+                // Stop expanding once every remaining entity is further than the worst match..
+                return count == limit && dists[count - 1] <= searched * searched;
+            };
+
+            // Search outwards ring by ring; searches that reach past the grid start over and visit every bucket..
+            const auto range = std::min(maxDistance, (float)(MaxRings - 1) * CellSize);
+            if (this->Visit(x, z, range, visit, stop) || range == maxDistance)
+                return count;
+
+            count = 0;
+            this->Visit(x, z, maxDistance, visit, stop);
+
+            return count;
+        }
+
+        uint32_t FindNearest(const float x, const float z, const float maxDistance, const entityfilter_t& filter, uint32_t* indexes, const uint32_t maxCount) const
+        {
+            return this->FindNearest(x, z, maxDistance, filter, indexes, maxCount, [](uint32_t) { return true; });
+        }
+
+        /**
+         * Returns the entity nearest to a position.
+         *
+         * @param {float} x - The X position.
+         * @param {float} z - The Z position.
+         * @param {float} maxDistance - The maximum distance to search within.
+         * @param {entityfilter_t&} filter - The filter entities must match.
+         * @return {uint32_t} The entity index if found, EntityGrid::InvalidIndex otherwise.
+         */
+        uint32_t FindNearest(const float x, const float z, const float maxDistance, const entityfilter_t& filter) const
+        {
+            uint32_t index = InvalidIndex;
+            return this->FindNearest(x, z, maxDistance, filter, &index, 1) == 1 ? index : InvalidIndex;
+        }
+
+    private:
+        static int32_t GetCell(const float v)
+        {
+            // Clamp far away positions; they still land in a valid bucket and are rejected by distance..
+            return (int32_t)std::floor(std::min(std::max(v / CellSize, -1048576.0f), 1048576.0f));
+        }
+
+        static uint32_t GetBucket(const int32_t cx, const int32_t cz)
+        {
+            return (uint32_t)(((cz & (GridSize - 1)) * GridSize) + (cx & (GridSize - 1)));
+        }
+
+        static bool Matches(const entry_t& e, const uint32_t index, const entityfilter_t& filter)
+        {
+            if (index == filter.Exclude)
+                return false;
+            if (filter.SpawnFlags != 0 && (e.SpawnFlags & filter.SpawnFlags) == 0)
+                return false;
+            if (filter.Types != 0 && (e.Type >= 32 || ((filter.Types >> e.Type) & 1) == 0))
+                return false;
+            if ((e.RenderFlags0 & filter.RenderFlags0) != filter.RenderFlags0)
+                return false;
+
+            return true;
+        }
+
+        void Unlink(const uint32_t index)
+        {
+            auto& e = this->m_Entries[index];
+            if (e.Bucket == InvalidIndex)
+                return;
+
+            if (e.Prev != InvalidIndex)
+                this->m_Entries[e.Prev].Next = e.Next;
+            else
+                this->m_Buckets[e.Bucket] = e.Next;
+
+            if (e.Next != InvalidIndex)
+                this->m_Entries[e.Next].Prev = e.Prev;
+
+            e.Bucket = InvalidIndex;
+            e.Prev   = InvalidIndex;
+            e.Next   = InvalidIndex;
+            this->m_Count--;
+        }
+
+        template<typename V>
+        bool Visit(const float x, const float z, const float radius, const V& visit) const
+        {
+            return this->Visit(x, z, radius, visit, [](float) { return false; });
+        }
+
+        /**
+         * Visits the entities of the cells around a position, in rings of cells moving outwards.
+         *
+         * @param {float} x - The X position.
+         * @param {float} z - The Z position.
+         * @param {float} radius - The radius to visit within.
+         * @param {V&} visit - Called with each entity index and its squared distance; returns false to stop.
+         * @param {S&} stop - Called after each ring with the distance fully searched; returns true to stop.
+         * @return {bool} True if the visit was stopped early, false otherwise.
+         */
+        template<typename V, typename S>
+        bool Visit(const float x, const float z, const float radius, const V& visit, const S& stop) const
+        {
+            if (!std::isfinite(x) || !std::isfinite(z))
+                return false;
+
+            const auto visitBucket = [&](const uint32_t bucket) -> bool {
+                for (auto index = this->m_Buckets[bucket]; index != InvalidIndex; index = this->m_Entries[index].Next)
+                {
+                    const auto& e = this->m_Entries[index];
+                    const auto dx = e.X - x;
+                    const auto dz = e.Z - z;
+                    if (!visit(index, dx * dx + dz * dz))
+                        return false;
+                }
+                return true;
+            };
+
+            const auto cx    = EntityGrid::GetCell(x);
+            const auto cz    = EntityGrid::GetCell(z);
+            const auto cells = (int32_t)std::ceil(std::min(radius, 1048576.0f) / CellSize);
+            const auto rings = cells < MaxRings ? cells : MaxRings;
+
+            // Searches wider than the grid visit every bucket once instead..
+            if (rings >= MaxRings)
+            {
+                for (uint32_t bucket = 0; bucket < (uint32_t)(GridSize * GridSize); bucket++)
+                {
+                    if (!visitBucket(bucket))
+                        return true;
+                }
+                return false;
+            }
+
+            for (int32_t ring = 0; ring <= rings; ring++)
+            {
+                for (auto z0 = cz - ring; z0 <= cz + ring; z0++)
+                {
+                    // Inner rows only have the two edge cells of the ring..
+                    const auto step = (z0 == cz - ring || z0 == cz + ring) ? 1 : std::max(ring * 2, 1);
+                    for (auto x0 = cx - ring; x0 <= cx + ring; x0 += step)
+                    {
+                        if (!visitBucket(EntityGrid::GetBucket(x0, z0)))
+                            return true;
+                    }
+                }
+
+                // Every entity nearer than the distance to the edge of this ring has been visited..
+                if (stop((float)ring * CellSize))
+                    return true;
+            }
+
+            return false;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_ENTITYGRID_H_INCLUDED
\ No newline at end of file
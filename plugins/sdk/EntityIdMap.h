@@ -0,0 +1,315 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_ENTITYIDMAP_H_INCLUDED
+#define ASHITA_SDK_ENTITYIDMAP_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <cinttypes>
+#include <cstring>
+
+namespace Ashita
+{
+    /**
+     * Entity Id Map
+     *
+     * Maps entity server ids to their entity (target) index in constant time.
+     *
+     * @notes
+     *
+     *      The map is an open-addressing hash table using linear probing, sized to keep the load factor below
+     *      60% with every entity slot in use. Removals use backward shift deletion, so no tombstones build up
+     *      over a long session.
+     *
+     *      The map is kept up to date incrementally from the entity update packets (0x000D, 0x000E) and the
+     *      zone packets (0x000A, 0x000B) by passing incoming packets to HandleIncomingPacket. It can also be
+     *      rebuilt from the entity manager at any time with Rebuild.
+     *
+     *      The map is not thread-safe; it should be updated and read from the same thread. (ie. the thread
+     *      incoming packets are handled on.)
+     */
+    class EntityIdMap
+    {
+    public:
+        static constexpr uint32_t MaxEntities = 2304;       // The number of entity slots.
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF; // The index returned for unknown server ids.
+
+    private:
+        static constexpr uint32_t Capacity = 4096; // The number of hash table slots. (Must be a power of two.)
+
+        struct slot_t
+        {
+            uint32_t ServerId; // The entity server id. (0 if the slot is empty.)
+            uint16_t Index;    // The entity index.
+        };
+
+        std::array<slot_t, Capacity> m_Slots;
+        std::array<uint32_t, MaxEntities> m_Ids; // The server id of each entity index. (0 if unused.)
+        uint32_t m_Count;
+
+    public:
+        EntityIdMap(void)
+        {
+            this->Clear();
+        }
+
+        /**
+         * Removes every entry from the map.
+         */
+        void Clear(void)
+        {
+            std::memset(this->m_Slots.data(), 0x00, sizeof(slot_t) * Capacity);
+            std::memset(this->m_Ids.data(), 0x00, sizeof(uint32_t) * MaxEntities);
+            this->m_Count = 0;
+        }
+
+        /**
+         * Returns the number of entries in the map.
+         *
+         * @return {uint32_t} The number of entries.
+         */
+        uint32_t GetCount(void) const
+        {
+            return this->m_Count;
+        }
+
+        /**
+         * Returns the entity index of the given server id.
+         *
+         * @param {uint32_t} serverId - The entity server id.
+         * @return {uint32_t} The entity index if found, EntityIdMap::InvalidIndex otherwise.
+         */
+        uint32_t Find(const uint32_t serverId) const
+        {
+            if (serverId == 0)
+                return EntityIdMap::InvalidIndex;
+
+            for (auto pos = EntityIdMap::Hash(serverId);; pos = (pos + 1) & (Capacity - 1))
+            {
+                const auto& s = this->m_Slots[pos];
+                if (s.ServerId == serverId)
+                    return s.Index;
+                if (s.ServerId == 0)
+                    return EntityIdMap::InvalidIndex;
+            }
+        }
+
+        /**
+         * Returns the server id of the given entity index.
+         *
+         * @param {uint32_t} index - The entity index.
+         * @return {uint32_t} The server id if known, 0 otherwise.
+         */
+        uint32_t GetServerId(const uint32_t index) const
+        {
+            return index < MaxEntities ? this->m_Ids[index] : 0;
+        }
+
+        /**
+         * Sets the server id of the given entity index, replacing any previous mapping of either.
+         *
+         * @param {uint32_t} index - The entity index.
+         * @param {uint32_t} serverId - The entity server id.
+         */
+        void Set(const uint32_t index, const uint32_t serverId)
+        {
+            if (index >= MaxEntities)
+                return;
+
+            if (this->m_Ids[index] == serverId)
+                return;
+
+            this->RemoveIndex(index);
+            if (serverId == 0)
+                return;
+
+            // Remove the server id from any index it was previously mapped to..
+            this->Remove(serverId);
+
+            auto pos = EntityIdMap::Hash(serverId);
+            while (this->m_Slots[pos].ServerId != 0)
+                pos = (pos + 1) & (Capacity - 1);
+
+            this->m_Slots[pos] = {serverId, (uint16_t)index};
+            this->m_Ids[index] = serverId;
+            this->m_Count++;
+        }
+
+        /**
+         * Removes the given server id from the map.
+         *
+         * @param {uint32_t} serverId - The entity server id.
+         */
+        void Remove(const uint32_t serverId)
+        {
+            if (serverId == 0)
+                return;
+
+            auto pos = EntityIdMap::Hash(serverId);
+            while (this->m_Slots[pos].ServerId != serverId)
+            {
+                if (this->m_Slots[pos].ServerId == 0)
+                    return;
+                pos = (pos + 1) & (Capacity - 1);
+            }
+
+            this->m_Ids[this->m_Slots[pos].Index] = 0;
+            this->m_Count--;
+
+            // Shift following entries of the probe sequence back into the freed slot..
+            auto next = pos;
+            for (;;)
+            {
+                this->m_Slots[pos].ServerId = 0;
+
+                for (;;)
+                {
+                    next = (next + 1) & (Capacity - 1);
+                    if (this->m_Slots[next].ServerId == 0)
+                        return;
+
+                    // Entries whose home slot lies cyclically within (pos, next] must stay where they are..
+                    const auto home = EntityIdMap::Hash(this->m_Slots[next].ServerId);
+                    if (pos <= next ? (pos < home && home <= next) : (pos < home || home <= next))
+                        continue;
+
+                    break;
+                }
+
+                this->m_Slots[pos] = this->m_Slots[next];
+                pos                = next;
+            }
+        }
+
+        /**
+         * Removes the given entity index from the map.
+         *
+         * @param {uint32_t} index - The entity index.
+         */
+        void RemoveIndex(const uint32_t index)
+        {
+            if (index < MaxEntities && this->m_Ids[index] != 0)
+                this->Remove(this->m_Ids[index]);
+        }
+
+        /**
+         * Rebuilds the map from the given entity manager.
+         *
+         * @param {T*} entity - The entity manager. (Any object implementing GetServerId(index); ie. IEntity.)
+         */
+        template<typename T>
+        void Rebuild(const T* entity)
+        {
+            this->Clear();
+
+            if (entity == nullptr)
+                return;
+
+            for (uint32_t x = 0; x < MaxEntities; x++)
+                this->Set(x, entity->GetServerId(x));
+        }
+
+        /**
+         * Updates the map from an incoming packet.
+         *
+         * @param {uint16_t} id - The packet id.
+         * @param {uint32_t} size - The size of the packet data.
+         * @param {const uint8_t*} data - The packet data.
+         */
+        void HandleIncomingPacket(const uint16_t id, const uint32_t size, const uint8_t* data)
+        {
+            if (data == nullptr)
+                return;
+
+            switch (id)
+            {
+                // Packet: Zone Enter
+                case 0x000A:
+                    this->Clear();
+                    if (size >= 0x0A)
+                        this->Set(EntityIdMap::Read16(data + 0x08), EntityIdMap::Read32(data + 0x04));
+                    break;
+
+                // Packet: Zone Leave
+                case 0x000B:
+                    this->Clear();
+                    break;
+
+                // Packet: Player Update / Entity Update
+                case 0x000D:
+                case 0x000E:
+                {
+                    if (size < 0x0B)
+                        break;
+
+                    const auto serverId = EntityIdMap::Read32(data + 0x04);
+                    const auto index    = EntityIdMap::Read16(data + 0x08);
+
+                    // The update flags mark the entity as despawned..
+                    if ((data[0x0A] & 0x20) != 0)
+                    {
+                        if (this->Find(serverId) == index)
+                            this->RemoveIndex(index);
+                    }
+                    else
+                    {
+                        this->Set(index, serverId);
+                    }
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+    private:
+        static uint32_t Hash(uint32_t serverId)
+        {
+            // Server ids share their upper bits per zone and entity type, so mix the bits before masking..
+            serverId ^= serverId >> 16;
+            serverId *= 0x7FEB352D;
+            serverId ^= serverId >> 15;
+            return serverId & (Capacity - 1);
+        }
+
+        static uint16_t Read16(const uint8_t* data)
+        {
+            uint16_t ret = 0;
+            std::memcpy(&ret, data, sizeof(ret));
+            return ret;
+        }
+
+        static uint32_t Read32(const uint8_t* data)
+        {
+            uint32_t ret = 0;
+            std::memcpy(&ret, data, sizeof(ret));
+            return ret;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_ENTITYIDMAP_H_INCLUDED
\ No newline at end of file
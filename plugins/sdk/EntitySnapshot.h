@@ -0,0 +1,333 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ASHITA_SDK_ENTITYSNAPSHOT_H_INCLUDED
+#define ASHITA_SDK_ENTITYSNAPSHOT_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cinttypes>
+#include <vector>
+
+namespace Ashita
+{
+    /**
+     * Entity Snapshot
+     *
+     * Copies selected fields of every valid entity into contiguous structure-of-arrays buffers in a single call,
+     * so overlays and other per-frame consumers can iterate the entities with plain array loads.
+     *
+     * @notes
+     *
+     *      An entity is valid if it has an actor. (ie. it is spawned and rendered.) Entry n of every array belongs
+     *      to the entity at GetIndexes()[n]; arrays of fields that were not captured are left untouched.
+     *
+     *      Each capture that changes the snapshot increments its generation. Consumers can store the generation
+     *      they last processed and skip their work while it has not changed.
+     *
+     *      The arrays are allocated once when the snapshot is created; capturing does not allocate.
+     */
+    class EntitySnapshot
+    {
+    public:
+        static constexpr uint32_t MaxEntities = 2304; // The number of entity slots.
+
+        static constexpr uint32_t FieldServerId  = 1 << 0; // Captures the entity server ids.
+        static constexpr uint32_t FieldPosition  = 1 << 1; // Captures the entity positions and headings.
+        static constexpr uint32_t FieldHPPercent = 1 << 2; // Captures the entity health percents.
+        static constexpr uint32_t FieldStatus    = 1 << 3; // Captures the entity statuses.
+        static constexpr uint32_t FieldFlags     = 1 << 4; // Captures the entity types, spawn flags and render flags.
+        static constexpr uint32_t FieldDistance  = 1 << 5; // Captures the entity distances. (Squared, from the player.)
+        static constexpr uint32_t FieldActor     = 1 << 6; // Captures the entity actor pointers.
+        static constexpr uint32_t FieldAll       = 0x7F;   // Captures every field.
+
+    private:
+        uint32_t m_Count;
+        uint32_t m_Generation;
+
+        std::vector<uint16_t> m_Indexes;
+        std::vector<uint32_t> m_ServerIds;
+        std::vector<float> m_X;
+        std::vector<float> m_Y;
+        std::vector<float> m_Z;
+        std::vector<float> m_Yaw;
+        std::vector<uint8_t> m_HPPercents;
+        std::vector<uint32_t> m_Statuses;
+        std::vector<uint8_t> m_Types;
+        std::vector<uint32_t> m_SpawnFlags;
+        std::vector<uint32_t> m_RenderFlags0;
+        std::vector<float> m_Distances;
+        std::vector<uintptr_t> m_Actors;
+
+        /**
+         * Stores a value into an array, flagging the snapshot as changed if it differs.
+         */
+        template<typename T>
+        static void Store(std::vector<T>& arr, const uint32_t n, const T value, bool& changed)
+        {
+            if (arr[n] != value)
+            {
+                arr[n]  = value;
+                changed = true;
+            }
+        }
+
+    public:
+        EntitySnapshot(void)
+            : m_Count(0)
+            , m_Generation(0)
+            , m_Indexes(MaxEntities, 0)
+            , m_ServerIds(MaxEntities, 0)
+            , m_X(MaxEntities, 0.0f)
+            , m_Y(MaxEntities, 0.0f)
+            , m_Z(MaxEntities, 0.0f)
+            , m_Yaw(MaxEntities, 0.0f)
+            , m_HPPercents(MaxEntities, 0)
+            , m_Statuses(MaxEntities, 0)
+            , m_Types(MaxEntities, 0)
+            , m_SpawnFlags(MaxEntities, 0)
+            , m_RenderFlags0(MaxEntities, 0)
+            , m_Distances(MaxEntities, 0.0f)
+            , m_Actors(MaxEntities, 0)
+        {}
+
+        /**
+         * Captures the selected fields of every valid entity from the given entity manager.
+         *
+         * @param {T*} entity - The entity manager. (Any object implementing the IEntity getters; ie. IEntity.)
+         * @param {uint32_t} fields - The fields to capture. (EntitySnapshot::Field* flags.)
+         * @return {bool} True if the snapshot changed, false otherwise.
+         */
+        template<typename T>
+        bool Capture(const T* entity, const uint32_t fields = FieldAll)
+        {
+            auto changed = false;
+            auto count   = (uint32_t)0;
+
+            if (entity != nullptr)
+            {
+                const auto size = entity->GetEntityMapSize();
+                const auto max  = size < MaxEntities ? size : MaxEntities;
+
+                for (uint32_t x = 0; x < max; x++)
+                {
+                    const auto actor = entity->GetActorPointer(x);
+                    if (actor == 0)
+                        continue;
+
+                    const auto n = count++;
+                    EntitySnapshot::Store(this->m_Indexes, n, (uint16_t)x, changed);
+
+                    if (fields & FieldServerId)
+                        EntitySnapshot::Store(this->m_ServerIds, n, entity->GetServerId(x), changed);
+                    if (fields & FieldPosition)
+                    {
+                        EntitySnapshot::Store(this->m_X, n, entity->GetLocalPositionX(x), changed);
+                        EntitySnapshot::Store(this->m_Y, n, entity->GetLocalPositionY(x), changed);
+                        EntitySnapshot::Store(this->m_Z, n, entity->GetLocalPositionZ(x), changed);
+                        EntitySnapshot::Store(this->m_Yaw, n, entity->GetLocalPositionYaw(x), changed);
+                    }
+                    if (fields & FieldHPPercent)
+                        EntitySnapshot::Store(this->m_HPPercents, n, entity->GetHPPercent(x), changed);
+                    if (fields & FieldStatus)
+                        EntitySnapshot::Store(this->m_Statuses, n, entity->GetStatus(x), changed);
+                    if (fields & FieldFlags)
+                    {
+                        EntitySnapshot::Store(this->m_Types, n, entity->GetType(x), changed);
+                        EntitySnapshot::Store(this->m_SpawnFlags, n, entity->GetSpawnFlags(x), changed);
+                        EntitySnapshot::Store(this->m_RenderFlags0, n, entity->GetRenderFlags0(x), changed);
+                    }
+                    if (fields & FieldDistance)
+                        EntitySnapshot::Store(this->m_Distances, n, entity->GetDistance(x), changed);
+                    if (fields & FieldActor)
+                        EntitySnapshot::Store(this->m_Actors, n, actor, changed);
+                }
+            }
+
+            if (this->m_Count != count)
+            {
+                this->m_Count = count;
+                changed       = true;
+            }
+
+            if (changed)
+                this->m_Generation++;
+
+            return changed;
+        }
+
+        /**
+         * Returns the number of entities in the snapshot.
+         *
+         * @return {uint32_t} The number of entities.
+         */
+        uint32_t GetCount(void) const
+        {
+            return this->m_Count;
+        }
+
+        /**
+         * Returns the generation of the snapshot. (Incremented each time a capture changes the snapshot.)
+         *
+         * @return {uint32_t} The snapshot generation.
+         */
+        uint32_t GetGeneration(void) const
+        {
+            return this->m_Generation;
+        }
+
+        /**
+         * Returns the entity indexes of the snapshot entries.
+         *
+         * @return {const uint16_t*} The entity indexes.
+         */
+        const uint16_t* GetIndexes(void) const
+        {
+            return this->m_Indexes.data();
+        }
+
+        /**
+         * Returns the entity server ids. (FieldServerId)
+         *
+         * @return {const uint32_t*} The entity server ids.
+         */
+        const uint32_t* GetServerIds(void) const
+        {
+            return this->m_ServerIds.data();
+        }
+
+        /**
+         * Returns the entity X positions. (FieldPosition)
+         *
+         * @return {const float*} The entity X positions.
+         */
+        const float* GetPositionsX(void) const
+        {
+            return this->m_X.data();
+        }
+
+        /**
+         * Returns the entity Y positions. (FieldPosition)
+         *
+         * @return {const float*} The entity Y positions.
+         */
+        const float* GetPositionsY(void) const
+        {
+            return this->m_Y.data();
+        }
+
+        /**
+         * Returns the entity Z positions. (FieldPosition)
+         *
+         * @return {const float*} The entity Z positions.
+         */
+        const float* GetPositionsZ(void) const
+        {
+            return this->m_Z.data();
+        }
+
+        /**
+         * Returns the entity headings. (FieldPosition)
+         *
+         * @return {const float*} The entity headings.
+         */
+        const float* GetHeadings(void) const
+        {
+            return this->m_Yaw.data();
+        }
+
+        /**
+         * Returns the entity health percents. (FieldHPPercent)
+         *
+         * @return {const uint8_t*} The entity health percents.
+         */
+        const uint8_t* GetHPPercents(void) const
+        {
+            return this->m_HPPercents.data();
+        }
+
+        /**
+         * Returns the entity statuses. (FieldStatus)
+         *
+         * @return {const uint32_t*} The entity statuses.
+         */
+        const uint32_t* GetStatuses(void) const
+        {
+            return this->m_Statuses.data();
+        }
+
+        /**
+         * Returns the entity types. (FieldFlags)
+         *
+         * @return {const uint8_t*} The entity types.
+         */
+        const uint8_t* GetTypes(void) const
+        {
+            return this->m_Types.data();
+        }
+
+        /**
+         * Returns the entity spawn flags. (FieldFlags)
+         *
+         * @return {const uint32_t*} The entity spawn flags.
+         */
+        const uint32_t* GetSpawnFlags(void) const
+        {
+            return this->m_SpawnFlags.data();
+        }
+
+        /**
+         * Returns the entity render flags. (FieldFlags)
+         *
+         * @return {const uint32_t*} The entity render flags.
+         */
+        const uint32_t* GetRenderFlags0(void) const
+        {
+            return this->m_RenderFlags0.data();
+        }
+
+        /**
+         * Returns the entity distances. (FieldDistance)
+         *
+         * @return {const float*} The entity distances.
+         */
+        const float* GetDistances(void) const
+        {
+            return this->m_Distances.data();
+        }
+
+        /**
+         * Returns the entity actor pointers. (FieldActor)
+         *
+         * @return {const uintptr_t*} The entity actor pointers.
+         */
+        const uintptr_t* GetActors(void) const
+        {
+            return this->m_Actors.data();
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_ENTITYSNAPSHOT_H_INCLUDED
\ No newline at end of file
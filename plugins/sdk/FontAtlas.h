@@ -0,0 +1,807 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ASHITA_SDK_FONTATLAS_H_INCLUDED
+#define ASHITA_SDK_FONTATLAS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Ashita
+{
+    /**
+     * Font Key Object
+     *
+     * Identifies a font face whose glyphs share an atlas.
+     */
+    struct fontkey_t
+    {
+        std::string Family; // The font family name.
+        uint32_t Height;    // The font height.
+        uint32_t Flags;     // The font creation flags. (FontCreateFlags; ie. Bold, Italic.)
+        uint32_t Outline;   // The font outline size, in pixels. (0 if not outlined.)
+
+        bool operator==(const fontkey_t& rhs) const
+        {
+            return this->Height == rhs.Height && this->Flags == rhs.Flags && this->Outline == rhs.Outline && this->Family == rhs.Family;
+        }
+    };
+
+    /**
+     * Glyph Bitmap Object
+     *
+     * Holds a rasterized glyph, as filled by a glyph rasterizer.
+     */
+    struct glyphbitmap_t
+    {
+        uint32_t Width;              // The bitmap width, in pixels.
+        uint32_t Height;             // The bitmap height, in pixels.
+        int32_t OffsetX;             // The horizontal offset from the pen position to the bitmap.
+        int32_t OffsetY;             // The vertical offset from the top of the line to the bitmap.
+        float Advance;               // The horizontal distance to move the pen after the glyph.
+        std::vector<uint8_t> Pixels; // The glyph coverage, one byte per pixel, row-major. (Width * Height.)
+    };
+
+    /**
+     * Glyph Rasterizer Callback
+     *
+     * Rasterizes a single glyph of a font. (ie. with GDI or FreeType.)
+     *
+     * @return {bool} True on success, false otherwise.
+     */
+    typedef std::function<bool(const fontkey_t& font, uint32_t codepoint, glyphbitmap_t* bitmap)> glyphrasterizer_f;
+
+    /**
+     * Glyph Object
+     *
+     * Holds the location of a glyph within the atlas and its metrics.
+     */
+    struct glyph_t
+    {
+        uint32_t Page;   // The atlas page holding the glyph.
+        uint32_t Width;  // The glyph width, in pixels.
+        uint32_t Height; // The glyph height, in pixels.
+        int32_t OffsetX; // The horizontal offset from the pen position to the glyph.
+        int32_t OffsetY; // The vertical offset from the top of the line to the glyph.
+        float Advance;   // The horizontal distance to move the pen after the glyph.
+        float U0;        // The left texture coordinate.
+        float V0;        // The top texture coordinate.
+        float U1;        // The right texture coordinate.
+        float V1;        // The bottom texture coordinate.
+    };
+
+    /**
+     * Font Atlas Statistics
+     */
+    struct fontatlasstats_t
+    {
+        uint64_t Rasterized; // The number of glyphs rasterized.
+        uint64_t Failed;     // The number of glyphs the rasterizer failed, or returned a malformed bitmap for.
+        uint64_t Oversized;  // The number of glyphs too large to fit on a page.
+        uint64_t Clears;     // The number of times the atlas was cleared.
+    };
+
+    /**
+     * Atlas Packer
+     *
+     * Packs rectangles into a fixed size area using the skyline bottom-left heuristic.
+     *
+     * @notes
+     *
+     *      The skyline tracks the top edge of the packed rectangles as a list of horizontal segments. Each
+     *      rectangle is placed where its top edge ends up lowest, which keeps the wasted space below the
+     *      skyline small for the similarly sized rectangles glyphs produce.
+     */
+    class AtlasPacker
+    {
+        /**
+         * Skyline Segment Object
+         */
+        struct segment_t
+        {
+            uint32_t X;     // The segment left edge.
+            uint32_t Y;     // The segment height. (The top edge of the packed area below it.)
+            uint32_t Width; // The segment width.
+        };
+
+        uint32_t m_Width;
+        uint32_t m_Height;
+        uint64_t m_UsedArea;
+        std::vector<segment_t> m_Skyline;
+
+        /**
+         * Returns the height a rectangle would be placed at, starting at the given segment.
+         *
+         * @return {bool} True if the rectangle fits, false otherwise.
+         */
+        bool Fit(const size_t index, const uint32_t width, const uint32_t height, uint32_t* y) const
+        {
+            const auto x = this->m_Skyline[index].X;
+            if (x + width > this->m_Width)
+                return false;
+
+            auto top  = (uint32_t)0;
+            auto left = width;
+            for (auto i = index; left > 0; i++)
+            {
+                top = std::max(top, this->m_Skyline[i].Y);
+                if (top + height > this->m_Height)
+                    return false;
+
+                left -= std::min(left, this->m_Skyline[i].Width);
+            }
+
+            *y = top;
+            return true;
+        }
+
+    public:
+        AtlasPacker(const uint32_t width, const uint32_t height)
+            : m_Width(width)
+            , m_Height(height)
+            , m_UsedArea(0)
+        {
+            this->Reset();
+        }
+
+        /**
+         * Removes every packed rectangle.
+         */
+        void Reset(void)
+        {
+            this->m_Skyline.clear();
+            this->m_Skyline.push_back({0, 0, this->m_Width});
+            this->m_UsedArea = 0;
+        }
+
+        /**
+         * Packs a rectangle.
+         *
+         * @param {uint32_t} width - The rectangle width.
+         * @param {uint32_t} height - The rectangle height.
+         * @param {uint32_t*} x - Receives the rectangle left edge.
+         * @param {uint32_t*} y - Receives the rectangle top edge.
+         * @return {bool} True if the rectangle was packed, false if it does not fit.
+         */
+        bool Pack(const uint32_t width, const uint32_t height, uint32_t* x, uint32_t* y)
+        {
+            if (width == 0 || height == 0 || x == nullptr || y == nullptr)
+                return false;
+
+            auto bestIndex  = this->m_Skyline.size();
+            auto bestTop    = UINT32_MAX;
+            auto bestWidth  = UINT32_MAX;
+            auto bestY      = (uint32_t)0;
+
+            for (size_t i = 0; i < this->m_Skyline.size(); i++)
+            {
+                uint32_t top = 0;
+                if (!this->Fit(i, width, height, &top))
+                    continue;
+
+                // Prefer the lowest top edge, then the narrowest segment to keep wide gaps for wide rectangles..
+                if (top + height < bestTop || (top + height == bestTop && this->m_Skyline[i].Width < bestWidth))
+                {
+                    bestIndex = i;
+                    bestTop   = top + height;
+                    bestWidth = this->m_Skyline[i].Width;
+                    bestY     = top;
+                }
+            }
+
+            if (bestIndex == this->m_Skyline.size())
+                return false;
+
+            *x = this->m_Skyline[bestIndex].X;
+            *y = bestY;
+
+            // Raise the skyline over the packed rectangle, trimming the segments it covers..
+            const segment_t segment = {*x, bestY + height, width};
+            this->m_Skyline.insert(this->m_Skyline.begin() + bestIndex, segment);
+
+            const auto right = segment.X + segment.Width;
+            for (auto i = bestIndex + 1; i < this->m_Skyline.size();)
+            {
+                auto& s = this->m_Skyline[i];
+                if (s.X >= right)
+                    break;
+
+                const auto end = s.X + s.Width;
+                if (end <= right)
+                {
+                    this->m_Skyline.erase(this->m_Skyline.begin() + i);
+                    continue;
+                }
+
+                s.Width = end - right;
+                s.X     = right;
+                break;
+            }
+
+            // Merge neighbouring segments of the same height..
+            for (size_t i = 0; i + 1 < this->m_Skyline.size();)
+            {
+                if (this->m_Skyline[i].Y == this->m_Skyline[i + 1].Y)
+                {
+                    this->m_Skyline[i].Width += this->m_Skyline[i + 1].Width;
+                    this->m_Skyline.erase(this->m_Skyline.begin() + i + 1);
+                    continue;
+                }
+                i++;
+            }
+
+            this->m_UsedArea += (uint64_t)width * height;
+            return true;
+        }
+
+        /**
+         * Returns the fraction of the area covered by packed rectangles.
+         *
+         * @return {float} The occupancy, from 0 to 1.
+         */
+        float GetOccupancy(void) const
+        {
+            return (float)((double)this->m_UsedArea / ((double)this->m_Width * this->m_Height));
+        }
+    };
+
+    /**
+     * Font Atlas
+     *
+     * A glyph atlas shared by any number of fonts. Glyphs are rasterized on first use and packed into a set
+     * of fixed size, single channel (coverage) pages; each page is uploaded to a single texture by the owner.
+     *
+     * @notes
+     *
+     *      Every font of every font object can share the same atlas, so text of any number of font objects can
+     *      be drawn with one texture (and one draw call, see GlyphBatch) per page instead of one per object.
+     *
+     *      Pages track the area changed since they were last uploaded, so only new glyphs need to be copied to
+     *      the textures. When every page is full the atlas is cleared and its generation incremented; glyphs
+     *      from an older generation must not be used.
+     *
+     *      The atlas itself does not depend on Direct3D; the rasterizer and texture uploads are left to the
+     *      owner. (ie. a plugin drawing its fonts with the FontDrawFlags::ManualRender flag.)
+     */
+    class FontAtlas
+    {
+    public:
+        static constexpr uint32_t InvalidFont = 0xFFFFFFFF; // The id returned for invalid fonts.
+
+        /**
+         * Atlas Page Object
+         */
+        struct page_t
+        {
+            AtlasPacker Packer;          // The page packer.
+            std::vector<uint8_t> Pixels; // The page coverage, one byte per pixel, row-major.
+            uint32_t DirtyLeft;          // The left edge of the area changed since the page was last uploaded.
+            uint32_t DirtyTop;           // The top edge of the area changed since the page was last uploaded.
+            uint32_t DirtyRight;         // The right edge of the area changed since the page was last uploaded.
+            uint32_t DirtyBottom;        // The bottom edge of the area changed since the page was last uploaded.
+
+            page_t(const uint32_t size)
+                : Packer(size, size)
+                , Pixels((size_t)size * size, 0)
+                , DirtyLeft(size)
+                , DirtyTop(size)
+                , DirtyRight(0)
+                , DirtyBottom(0)
+            {}
+
+            /**
+             * Returns if the page has changed since it was last uploaded.
+             *
+             * @return {bool} True if changed, false otherwise.
+             */
+            bool GetIsDirty(void) const
+            {
+                return this->DirtyRight > this->DirtyLeft;
+            }
+        };
+
+    private:
+        uint32_t m_PageSize;
+        uint32_t m_MaxPages;
+        uint32_t m_Padding;
+        uint32_t m_Generation;
+        glyphrasterizer_f m_Rasterizer;
+
+        std::vector<fontkey_t> m_Fonts;
+        std::vector<page_t> m_Pages;
+        std::unordered_map<uint64_t, glyph_t> m_Glyphs; // Keyed by font id (upper 32 bits) and codepoint.
+        glyphbitmap_t m_Bitmap;                          // Reused for each rasterized glyph.
+        fontatlasstats_t m_Stats;
+
+        /**
+         * Returns if a rasterized glyph is complete and fits on an empty page.
+         */
+        bool GetIsPlaceable(const glyphbitmap_t& bitmap) const
+        {
+            if (bitmap.Pixels.size() < (size_t)bitmap.Width * bitmap.Height)
+                return false;
+
+            return bitmap.Width + this->m_Padding <= this->m_PageSize && bitmap.Height + this->m_Padding <= this->m_PageSize;
+        }
+
+        /**
+         * Places a rasterized glyph into the atlas pages.
+         *
+         * @return {bool} True on success, false if the glyph is malformed, larger than a page, or every page is full.
+         */
+        bool Place(const glyphbitmap_t& bitmap, glyph_t* glyph)
+        {
+            glyph->Width   = bitmap.Width;
+            glyph->Height  = bitmap.Height;
+            glyph->OffsetX = bitmap.OffsetX;
+            glyph->OffsetY = bitmap.OffsetY;
+            glyph->Advance = bitmap.Advance;
+            glyph->Page    = 0;
+            glyph->U0      = glyph->V0 = glyph->U1 = glyph->V1 = 0.0f;
+
+            // Blank glyphs (ie. spaces) only carry metrics..
+            if (bitmap.Width == 0 || bitmap.Height == 0)
+                return true;
+
+            if (bitmap.Pixels.size() < (size_t)bitmap.Width * bitmap.Height)
+            {
+                this->m_Stats.Failed++;
+                return false;
+            }
+            if (!this->GetIsPlaceable(bitmap))
+            {
+                this->m_Stats.Oversized++;
+                return false;
+            }
+
+            const auto w = bitmap.Width + this->m_Padding;
+            const auto h = bitmap.Height + this->m_Padding;
+
+            uint32_t x = 0, y = 0;
+            auto page  = (uint32_t)0;
+            for (; page < this->m_Pages.size(); page++)
+            {
+                if (this->m_Pages[page].Packer.Pack(w, h, &x, &y))
+                    break;
+            }
+
+            if (page == this->m_Pages.size())
+            {
+                if (this->m_Pages.size() >= this->m_MaxPages)
+                    return false;
+
+                this->m_Pages.emplace_back(this->m_PageSize);
+                if (!this->m_Pages.back().Packer.Pack(w, h, &x, &y))
+                    return false;
+            }
+
+            auto& p = this->m_Pages[page];
+            for (uint32_t row = 0; row < bitmap.Height; row++)
+                std::memcpy(&p.Pixels[((size_t)(y + row) * this->m_PageSize) + x], &bitmap.Pixels[(size_t)row * bitmap.Width], bitmap.Width);
+
+            p.DirtyLeft   = std::min(p.DirtyLeft, x);
+            p.DirtyTop    = std::min(p.DirtyTop, y);
+            p.DirtyRight  = std::max(p.DirtyRight, x + bitmap.Width);
+            p.DirtyBottom = std::max(p.DirtyBottom, y + bitmap.Height);
+
+            const auto scale = 1.0f / (float)this->m_PageSize;
+            glyph->Page      = page;
+            glyph->U0        = (float)x * scale;
+            glyph->V0        = (float)y * scale;
+            glyph->U1        = (float)(x + bitmap.Width) * scale;
+            glyph->V1        = (float)(y + bitmap.Height) * scale;
+
+            return true;
+        }
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param {glyphrasterizer_f&} rasterizer - The glyph rasterizer.
+         * @param {uint32_t} pageSize - The width and height of each page, in pixels.
+         * @param {uint32_t} maxPages - The maximum number of pages.
+         * @param {uint32_t} padding - The empty space kept between glyphs, in pixels. (Avoids bleeding when filtered.)
+         */
+        FontAtlas(const glyphrasterizer_f& rasterizer, const uint32_t pageSize = 512, const uint32_t maxPages = 4, const uint32_t padding = 1)
+            : m_PageSize(pageSize == 0 ? 512 : pageSize)
+            , m_MaxPages(maxPages == 0 ? 1 : maxPages)
+            , m_Padding(padding)
+            , m_Generation(0)
+            , m_Rasterizer(rasterizer)
+            , m_Stats{}
+        {}
+
+        /**
+         * Returns the id of the given font, adding it to the atlas if needed.
+         *
+         * @param {fontkey_t&} font - The font.
+         * @return {uint32_t} The font id.
+         */
+        uint32_t GetFont(const fontkey_t& font)
+        {
+            const auto iter = std::find(this->m_Fonts.begin(), this->m_Fonts.end(), font);
+            if (iter != this->m_Fonts.end())
+                return (uint32_t)(iter - this->m_Fonts.begin());
+
+            this->m_Fonts.push_back(font);
+            return (uint32_t)(this->m_Fonts.size() - 1);
+        }
+
+        /**
+         * Returns the font of the given font id.
+         *
+         * @param {uint32_t} fontId - The font id.
+         * @return {const fontkey_t*} The font if valid, nullptr otherwise.
+         */
+        const fontkey_t* GetFontKey(const uint32_t fontId) const
+        {
+            return fontId < this->m_Fonts.size() ? &this->m_Fonts[fontId] : nullptr;
+        }
+
+        /**
+         * Returns a glyph of the given font, rasterizing and packing it on first use.
+         *
+         * @param {uint32_t} fontId - The font id.
+         * @param {uint32_t} codepoint - The glyph codepoint.
+         * @return {const glyph_t*} The glyph on success, nullptr otherwise.
+         *
+         * @notes
+         *
+         *      Glyphs that cannot be placed (ie. larger than a page) are not cached; they return nullptr and are
+         *      counted in the atlas statistics each time they are requested.
+         */
+        const glyph_t* GetGlyph(const uint32_t fontId, const uint32_t codepoint)
+        {
+            if (fontId >= this->m_Fonts.size())
+                return nullptr;
+
+            const auto key  = ((uint64_t)fontId << 32) | codepoint;
+            const auto iter = this->m_Glyphs.find(key);
+            if (iter != this->m_Glyphs.end())
+                return &iter->second;
+
+            if (!this->m_Rasterizer)
+                return nullptr;
+
+            this->m_Bitmap.Width   = 0;
+            this->m_Bitmap.Height  = 0;
+            this->m_Bitmap.OffsetX = 0;
+            this->m_Bitmap.OffsetY = 0;
+            this->m_Bitmap.Advance = 0.0f;
+            this->m_Bitmap.Pixels.clear();
+
+            if (!this->m_Rasterizer(this->m_Fonts[fontId], codepoint, &this->m_Bitmap))
+            {
+                this->m_Stats.Failed++;
+                return nullptr;
+            }
+
+            this->m_Stats.Rasterized++;
+
+            glyph_t glyph{};
+            if (!this->Place(this->m_Bitmap, &glyph))
+            {
+                // Malformed and oversized glyphs will never fit; leave the atlas as is..
+                if (!this->GetIsPlaceable(this->m_Bitmap))
+                    return nullptr;
+
+                // Every page is full; start over and place the glyph into the fresh atlas..
+                this->Clear();
+                if (!this->Place(this->m_Bitmap, &glyph))
+                    return nullptr;
+            }
+
+            return &(this->m_Glyphs[key] = glyph);
+        }
+
+        /**
+         * Removes every glyph from the atlas and increments its generation. (Fonts keep their ids.)
+         */
+        void Clear(void)
+        {
+            this->m_Glyphs.clear();
+            this->m_Pages.clear();
+            this->m_Generation++;
+            this->m_Stats.Clears++;
+        }
+
+        /**
+         * Returns the generation of the atlas. (Incremented each time the atlas is cleared.)
+         *
+         * @return {uint32_t} The atlas generation.
+         */
+        uint32_t GetGeneration(void) const
+        {
+            return this->m_Generation;
+        }
+
+        /**
+         * Returns the width and height of each page, in pixels.
+         *
+         * @return {uint32_t} The page size.
+         */
+        uint32_t GetPageSize(void) const
+        {
+            return this->m_PageSize;
+        }
+
+        /**
+         * Returns the number of pages in use.
+         *
+         * @return {uint32_t} The number of pages.
+         */
+        uint32_t GetPageCount(void) const
+        {
+            return (uint32_t)this->m_Pages.size();
+        }
+
+        /**
+         * Returns the given page.
+         *
+         * @param {uint32_t} page - The page index.
+         * @return {const page_t*} The page if valid, nullptr otherwise.
+         */
+        const page_t* GetPage(const uint32_t page) const
+        {
+            return page < this->m_Pages.size() ? &this->m_Pages[page] : nullptr;
+        }
+
+        /**
+         * Returns the statistics of the atlas.
+         *
+         * @param {fontatlasstats_t*} stats - The statistics object to fill.
+         */
+        void GetStats(fontatlasstats_t* stats) const
+        {
+            if (stats != nullptr)
+                *stats = this->m_Stats;
+        }
+
+        /**
+         * Marks the given page as uploaded, clearing its changed area.
+         *
+         * @param {uint32_t} page - The page index.
+         */
+        void ClearPageDirty(const uint32_t page)
+        {
+            if (page >= this->m_Pages.size())
+                return;
+
+            auto& p       = this->m_Pages[page];
+            p.DirtyLeft   = this->m_PageSize;
+            p.DirtyTop    = this->m_PageSize;
+            p.DirtyRight  = 0;
+            p.DirtyBottom = 0;
+        }
+    };
+
+    /**
+     * Font Vertex Object
+     *
+     * A pre-transformed, colored and textured vertex. (D3DFVF_XYZRHW | D3DFVF_DIFFUSE | D3DFVF_TEX1)
+     */
+    struct fontvertex_t
+    {
+        float X;        // The screen X position.
+        float Y;        // The screen Y position.
+        float Z;        // The depth.
+        float Rhw;      // The reciprocal homogeneous w.
+        uint32_t Color; // The vertex color. (ARGB)
+        float U;        // The texture U coordinate.
+        float V;        // The texture V coordinate.
+    };
+
+    /**
+     * Glyph Batch
+     *
+     * Builds the vertices of the text of any number of font objects, grouped into as few draw calls as
+     * possible.
+     *
+     * @notes
+     *
+     *      Glyph quads are written as triangle lists (6 vertices per glyph) in submission order. Consecutive
+     *      glyphs on the same atlas page are merged into a single draw, so text sharing one page (the common
+     *      case) is drawn with a single call regardless of how many font objects it came from, while keeping
+     *      the order text was added in. (Later text is drawn over earlier text.)
+     *
+     *      The batch holds glyphs of the atlas generation it was built with; if the atlas is cleared while
+     *      adding text, the batch is rebuilt by the caller. (See GetIsStale.)
+     */
+    class GlyphBatch
+    {
+    public:
+        /**
+         * Draw Call Object
+         */
+        struct draw_t
+        {
+            uint32_t Page;        // The atlas page (texture) to draw with.
+            uint32_t StartVertex; // The first vertex of the draw.
+            uint32_t Primitives;  // The number of triangles to draw.
+        };
+
+    private:
+        FontAtlas* m_Atlas;
+        uint32_t m_Generation;
+        std::vector<fontvertex_t> m_Vertices;
+        std::vector<draw_t> m_Draws;
+
+        /**
+         * Decodes the next codepoint of a UTF-8 string.
+         *
+         * @notes
+         *
+         *      Broken sequences decode as single bytes. Lead bytes that can never start a sequence (0xF8 and
+         *      above) and sequences past U+10FFFF decode as U+FFFD.
+         */
+        static uint32_t NextCodepoint(const uint8_t*& str, const uint8_t* end)
+        {
+            const auto c = *str++;
+            if (c < 0x80)
+                return c;
+            if (c >= 0xF8)
+                return 0xFFFD;
+
+            const auto len = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+            if (len == 0 || end - str < len)
+                return c;
+
+            uint32_t cp = c & (0x3F >> len);
+            for (auto x = 0; x < len; x++)
+            {
+                if ((str[x] & 0xC0) != 0x80)
+                    return c;
+                cp = (cp << 6) | (str[x] & 0x3F);
+            }
+
+            str += len;
+            return cp > 0x10FFFF ? 0xFFFD : cp;
+        }
+
+        void AddQuad(const glyph_t* g, const float x, const float y, const uint32_t color)
+        {
+            const auto x0 = x + (float)g->OffsetX - 0.5f;
+            const auto y0 = y + (float)g->OffsetY - 0.5f;
+            const auto x1 = x0 + (float)g->Width;
+            const auto y1 = y0 + (float)g->Height;
+
+            if (this->m_Draws.empty() || this->m_Draws.back().Page != g->Page)
+                this->m_Draws.push_back({g->Page, (uint32_t)this->m_Vertices.size(), 0});
+
+            this->m_Vertices.push_back({x0, y0, 0.0f, 1.0f, color, g->U0, g->V0});
+            this->m_Vertices.push_back({x1, y0, 0.0f, 1.0f, color, g->U1, g->V0});
+            this->m_Vertices.push_back({x0, y1, 0.0f, 1.0f, color, g->U0, g->V1});
+            this->m_Vertices.push_back({x1, y0, 0.0f, 1.0f, color, g->U1, g->V0});
+            this->m_Vertices.push_back({x1, y1, 0.0f, 1.0f, color, g->U1, g->V1});
+            this->m_Vertices.push_back({x0, y1, 0.0f, 1.0f, color, g->U0, g->V1});
+            this->m_Draws.back().Primitives += 2;
+        }
+
+    public:
+        GlyphBatch(FontAtlas* atlas)
+            : m_Atlas(atlas)
+            , m_Generation(atlas == nullptr ? 0 : atlas->GetGeneration())
+        {}
+
+        /**
+         * Removes every glyph from the batch. (Keeps the allocated buffers.)
+         */
+        void Clear(void)
+        {
+            this->m_Vertices.clear();
+            this->m_Draws.clear();
+            this->m_Generation = this->m_Atlas == nullptr ? 0 : this->m_Atlas->GetGeneration();
+        }
+
+        /**
+         * Adds text to the batch.
+         *
+         * @param {uint32_t} fontId - The atlas font id to draw with.
+         * @param {float} x - The screen X position of the text.
+         * @param {float} y - The screen Y position of the text.
+         * @param {const char*} text - The text to draw. (UTF-8; new lines start a new line.)
+         * @param {uint32_t} color - The text color. (ARGB)
+         * @return {float} The width of the widest line of the text.
+         */
+        float AddText(const uint32_t fontId, const float x, const float y, const char* text, const uint32_t color)
+        {
+            if (this->m_Atlas == nullptr || text == nullptr)
+                return 0.0f;
+
+            const auto font = this->m_Atlas->GetFontKey(fontId);
+            if (font == nullptr)
+                return 0.0f;
+
+            auto str = (const uint8_t*)text;
+            auto end = str + std::strlen(text);
+            auto px  = x;
+            auto py  = y;
+            auto max = 0.0f;
+
+            while (str < end)
+            {
+                const auto cp = GlyphBatch::NextCodepoint(str, end);
+                if (cp == '\n')
+                {
+                    max = std::max(max, px - x);
+                    px  = x;
+                    py += (float)font->Height;
+                    continue;
+                }
+
+                const auto g = this->m_Atlas->GetGlyph(fontId, cp);
+                if (g == nullptr)
+                    continue;
+
+                if (g->Width > 0 && g->Height > 0 && g->U1 > g->U0)
+                    this->AddQuad(g, px, py, color);
+
+                px += g->Advance;
+            }
+
+            return std::max(max, px - x);
+        }
+
+        /**
+         * Returns if the atlas was cleared since the batch was started, invalidating its glyphs.
+         *
+         * @return {bool} True if stale, false otherwise.
+         */
+        bool GetIsStale(void) const
+        {
+            return this->m_Atlas != nullptr && this->m_Atlas->GetGeneration() != this->m_Generation;
+        }
+
+        /**
+         * Returns the batch vertices.
+         *
+         * @return {const std::vector<fontvertex_t>&} The vertices.
+         */
+        const std::vector<fontvertex_t>& GetVertices(void) const
+        {
+            return this->m_Vertices;
+        }
+
+        /**
+         * Returns the batch draw calls.
+         *
+         * @return {const std::vector<draw_t>&} The draw calls.
+         */
+        const std::vector<draw_t>& GetDraws(void) const
+        {
+            return this->m_Draws;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_FONTATLAS_H_INCLUDED
\ No newline at end of file
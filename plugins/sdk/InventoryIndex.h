@@ -0,0 +1,249 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ASHITA_SDK_INVENTORYINDEX_H_INCLUDED
+#define ASHITA_SDK_INVENTORYINDEX_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <unordered_map>
+#include <vector>
+
+namespace Ashita
+{
+    /**
+     * Inventory Slot Object
+     */
+    struct inventoryslot_t
+    {
+        uint8_t Container; // The container id.
+        uint8_t Index;     // The slot index within the container.
+    };
+
+    /**
+     * Inventory Change Object
+     */
+    struct inventorychange_t
+    {
+        uint8_t Container; // The container id.
+        uint8_t Index;     // The slot index within the container.
+        uint16_t OldId;    // The item id previously in the slot. (0 if empty.)
+        uint16_t NewId;    // The item id now in the slot. (0 if empty.)
+        uint32_t OldCount; // The item count previously in the slot.
+        uint32_t NewCount; // The item count now in the slot.
+    };
+
+    /**
+     * Inventory Index
+     *
+     * Aggregates the players containers by item id; holding the total count of each item and the slots it is
+     * stored in. Intended to replace scanning every container slot to count or locate an item.
+     *
+     * @notes
+     *
+     *      The index is only refreshed when the inventory ContainerUpdateCounter has changed since the last
+     *      update, so calling Update every frame costs a single call while nothing changes. When it does change,
+     *      each slot is compared to its last known state and only the changed slots touch the index. The changed
+     *      slots of the last update are available from GetChanges.
+     *
+     *      The temporary recycle bin container is not indexed.
+     *
+     *      The index is not thread-safe; it should be updated and read from the same thread.
+     */
+    class InventoryIndex
+    {
+    public:
+        static constexpr uint32_t MaxContainers = 17; // The number of indexed containers. (Inventory to Wardrobe8.)
+        static constexpr uint32_t MaxSlots      = 81; // The number of slots per container.
+
+    private:
+        /**
+         * Slot State Object
+         */
+        struct slotstate_t
+        {
+            uint16_t Id;    // The item id in the slot.
+            uint32_t Count; // The item count in the slot.
+        };
+
+        std::array<slotstate_t, MaxContainers * MaxSlots> m_Slots;
+        std::vector<uint32_t> m_Totals;
+        std::unordered_map<uint16_t, std::vector<inventoryslot_t>> m_Locations;
+        std::vector<inventorychange_t> m_Changes;
+        uint32_t m_UpdateCounter;
+        bool m_IsUpdated;
+
+        static bool IsEmpty(const uint16_t id)
+        {
+            return id == 0 || id == 0xFFFF;
+        }
+
+    public:
+        InventoryIndex(void)
+            : m_Totals(0x10000, 0)
+            , m_UpdateCounter(0)
+            , m_IsUpdated(false)
+        {
+            this->Clear();
+        }
+
+        /**
+         * Removes every item from the index.
+         */
+        void Clear(void)
+        {
+            for (auto& s : this->m_Slots)
+                s = {0, 0};
+
+            std::fill(this->m_Totals.begin(), this->m_Totals.end(), 0);
+            this->m_Locations.clear();
+            this->m_Changes.clear();
+            this->m_IsUpdated = false;
+        }
+
+        /**
+         * Updates the index from the given inventory manager, if its contents have changed.
+         *
+         * @param {T*} inventory - The inventory manager. (Any object implementing the IInventory getters; ie. IInventory.)
+         * @param {bool} force - Flag to refresh the index even if the update counter has not changed.
+         * @return {bool} True if any slot changed, false otherwise.
+         */
+        template<typename T>
+        bool Update(const T* inventory, const bool force = false)
+        {
+            if (inventory == nullptr)
+                return false;
+
+            const auto counter = inventory->GetContainerUpdateCounter();
+            if (!force && this->m_IsUpdated && counter == this->m_UpdateCounter)
+                return false;
+
+            this->m_Changes.clear();
+            this->m_UpdateCounter = counter;
+            this->m_IsUpdated     = true;
+
+            for (uint32_t c = 0; c < MaxContainers; c++)
+            {
+                for (uint32_t x = 0; x < MaxSlots; x++)
+                {
+                    const auto item  = inventory->GetContainerItem(c, x);
+                    const auto id    = item == nullptr || InventoryIndex::IsEmpty(item->Id) ? (uint16_t)0 : item->Id;
+                    const auto count = id == 0 ? 0 : item->Count;
+
+                    auto& slot = this->m_Slots[(c * MaxSlots) + x];
+                    if (slot.Id == id && slot.Count == count)
+                        continue;
+
+                    this->m_Changes.push_back({(uint8_t)c, (uint8_t)x, slot.Id, id, slot.Count, count});
+                    this->Unlink(slot.Id, slot.Count, (uint8_t)c, (uint8_t)x);
+                    this->Link(id, count, (uint8_t)c, (uint8_t)x);
+
+                    slot.Id    = id;
+                    slot.Count = count;
+                }
+            }
+
+            return !this->m_Changes.empty();
+        }
+
+        /**
+         * Returns the total count of the given item across the indexed containers.
+         *
+         * @param {uint16_t} id - The item id.
+         * @return {uint32_t} The total item count.
+         */
+        uint32_t GetItemTotal(const uint16_t id) const
+        {
+            return InventoryIndex::IsEmpty(id) ? 0 : this->m_Totals[id];
+        }
+
+        /**
+         * Returns the slots holding the given item.
+         *
+         * @param {uint16_t} id - The item id.
+         * @return {const std::vector<inventoryslot_t>*} The item slots if held, nullptr otherwise.
+         */
+        const std::vector<inventoryslot_t>* GetItemSlots(const uint16_t id) const
+        {
+            const auto iter = this->m_Locations.find(id);
+            return iter == this->m_Locations.end() ? nullptr : &iter->second;
+        }
+
+        /**
+         * Returns the slots that changed during the last update.
+         *
+         * @return {const std::vector<inventorychange_t>&} The changed slots.
+         */
+        const std::vector<inventorychange_t>& GetChanges(void) const
+        {
+            return this->m_Changes;
+        }
+
+        /**
+         * Returns the inventory update counter the index was last updated with.
+         *
+         * @return {uint32_t} The update counter.
+         */
+        uint32_t GetUpdateCounter(void) const
+        {
+            return this->m_UpdateCounter;
+        }
+
+    private:
+        void Link(const uint16_t id, const uint32_t count, const uint8_t container, const uint8_t index)
+        {
+            if (id == 0)
+                return;
+
+            this->m_Totals[id] += count;
+            this->m_Locations[id].push_back({container, index});
+        }
+
+        void Unlink(const uint16_t id, const uint32_t count, const uint8_t container, const uint8_t index)
+        {
+            if (id == 0)
+                return;
+
+            this->m_Totals[id] -= count;
+
+            auto iter = this->m_Locations.find(id);
+            if (iter == this->m_Locations.end())
+                return;
+
+            auto& slots = iter->second;
+            slots.erase(std::remove_if(slots.begin(), slots.end(), [container, index](const inventoryslot_t& s) {
+                return s.Container == container && s.Index == index;
+            }), slots.end());
+
+            if (slots.empty())
+                this->m_Locations.erase(iter);
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_INVENTORYINDEX_H_INCLUDED
\ No newline at end of file
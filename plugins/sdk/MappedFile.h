@@ -0,0 +1,208 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_MAPPEDFILE_H_INCLUDED
+#define ASHITA_SDK_MAPPEDFILE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cinttypes>
+#include <cstddef>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Ashita
+{
+    /**
+     * Mapped File
+     *
+     * Maps a file into memory for reading.
+     *
+     * @notes
+     *
+     *      Empty files cannot be mapped; opening an empty file fails.
+     */
+    class MappedFile
+    {
+        const uint8_t* m_Data;
+        size_t m_Size;
+
+#if defined(_WIN32)
+        HANDLE m_File;
+        HANDLE m_Mapping;
+#else
+        int m_File;
+#endif
+
+    public:
+        MappedFile(void)
+            : m_Data(nullptr)
+            , m_Size(0)
+#if defined(_WIN32)
+            , m_File(INVALID_HANDLE_VALUE)
+            , m_Mapping(nullptr)
+#else
+            , m_File(-1)
+#endif
+        {}
+        ~MappedFile(void)
+        {
+            this->Close();
+        }
+
+        MappedFile(const MappedFile&)            = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * Opens and maps a file.
+         *
+         * @param {const char*} path - The path to the file.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Open(const char* path)
+        {
+            this->Close();
+
+            if (path == nullptr)
+                return false;
+
+#if defined(_WIN32)
+            this->m_File = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (this->m_File == INVALID_HANDLE_VALUE)
+                return false;
+
+            LARGE_INTEGER size{};
+            if (!::GetFileSizeEx(this->m_File, &size) || size.QuadPart == 0)
+            {
+                this->Close();
+                return false;
+            }
+
+            this->m_Mapping = ::CreateFileMappingA(this->m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (this->m_Mapping == nullptr)
+            {
+                this->Close();
+                return false;
+            }
+
+            this->m_Data = (const uint8_t*)::MapViewOfFile(this->m_Mapping, FILE_MAP_READ, 0, 0, 0);
+            this->m_Size = (size_t)size.QuadPart;
+#else
+            this->m_File = ::open(path, O_RDONLY);
+            if (this->m_File == -1)
+                return false;
+
+            struct stat st{};
+            if (::fstat(this->m_File, &st) != 0 || st.st_size == 0)
+            {
+                this->Close();
+                return false;
+            }
+
+            const auto data = ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, this->m_File, 0);
+            this->m_Data    = data == MAP_FAILED ? nullptr : (const uint8_t*)data;
+            this->m_Size    = (size_t)st.st_size;
+#endif
+
+            if (this->m_Data == nullptr)
+            {
+                this->Close();
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * Unmaps and closes the file.
+         */
+        void Close(void)
+        {
+#if defined(_WIN32)
+            if (this->m_Mapping != nullptr)
+            {
+                if (this->m_Data != nullptr)
+                    ::UnmapViewOfFile(this->m_Data);
+                ::CloseHandle(this->m_Mapping);
+            }
+            if (this->m_File != INVALID_HANDLE_VALUE)
+                ::CloseHandle(this->m_File);
+
+            this->m_File    = INVALID_HANDLE_VALUE;
+            this->m_Mapping = nullptr;
+#else
+            if (this->m_File != -1)
+            {
+                if (this->m_Data != nullptr)
+                    ::munmap((void*)this->m_Data, this->m_Size);
+                ::close(this->m_File);
+            }
+
+            this->m_File = -1;
+#endif
+
+            this->m_Data = nullptr;
+            this->m_Size = 0;
+        }
+
+        /**
+         * Returns if a file is mapped.
+         *
+         * @return {bool} True if open, false otherwise.
+         */
+        bool IsOpen(void) const
+        {
+            return this->m_Data != nullptr;
+        }
+
+        /**
+         * Returns the mapped file data.
+         *
+         * @return {const uint8_t*} The file data if open, nullptr otherwise.
+         */
+        const uint8_t* GetData(void) const
+        {
+            return this->m_Data;
+        }
+
+        /**
+         * Returns the size of the mapped file.
+         *
+         * @return {size_t} The size of the file, in bytes.
+         */
+        size_t GetSize(void) const
+        {
+            return this->m_Size;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_MAPPEDFILE_H_INCLUDED
\ No newline at end of file
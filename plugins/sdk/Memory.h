@@ -28,40 +28,19 @@
 
 #include <Windows.h>
 #include <algorithm>
-#include <sstream>
 #include <string>
 #include <vector>
 
+#include "MappedFile.h"
+#include "Pattern.h"
+#include "PatternCache.h"
+#include "PatternResolver.h"
+
 #pragma comment(lib, "Psapi.lib")
 #include <Psapi.h>
 
 namespace Ashita
 {
-    template<typename T>
-    struct scannableiterator_t
-    {
-        uintptr_t m_BaseAddress;
-        uintptr_t m_Size;
-
-        scannableiterator_t(const scannableiterator_t&) = delete;
-        scannableiterator_t(void)                       = delete;
-
-        scannableiterator_t(const uintptr_t base, const uintptr_t size)
-            : m_BaseAddress(base)
-            , m_Size(size)
-        {}
-
-        T* begin(void)
-        {
-            return (T*)this->m_BaseAddress;
-        }
-
-        T* end(void)
-        {
-            return (T*)(this->m_BaseAddress + this->m_Size);
-        }
-    };
-
     class Memory
     {
     public:
@@ -117,6 +96,72 @@ namespace Ashita
             return nullptr;
         }
 
+        /**
+         * Returns the identity of the given module, used to validate cached pattern results.
+         *
+         * @param {const char*} moduleName - The name of the module to obtain the identity of.
+         * @param {moduleidentity_t*} identity - The module identity output.
+         * @return {bool} True on success, false otherwise.
+         *
+         * @notes
+         *
+         *      The identity is made of the modules file size, last write time and a hash of the modules PE file
+         *      header, section table and the raw data of every section. The section data is hashed from the
+         *      module file, not from memory, as the loaded sections may be altered by relocations or other hooks.
+         *      Cached results are also verified against the pattern bytes on use.
+         */
+        static inline bool __stdcall GetModuleIdentity(const char* moduleName, moduleidentity_t* identity)
+        {
+            const auto handle = ::GetModuleHandleA(moduleName);
+            if (handle == nullptr || identity == nullptr)
+                return false;
+
+            // Obtain the modules file information..
+            char path[MAX_PATH]{};
+            if (::GetModuleFileNameA(handle, path, MAX_PATH) == 0)
+                return false;
+
+            WIN32_FILE_ATTRIBUTE_DATA fad{};
+            if (!::GetFileAttributesExA(path, GetFileExInfoStandard, &fad))
+                return false;
+
+            identity->FileSize  = ((uint64_t)fad.nFileSizeHigh << 32) | fad.nFileSizeLow;
+            identity->Timestamp = ((uint64_t)fad.ftLastWriteTime.dwHighDateTime << 32) | fad.ftLastWriteTime.dwLowDateTime;
+
+            // Hash the modules file header and section table..
+            const auto dos = (const IMAGE_DOS_HEADER*)handle;
+            if (dos->e_magic != IMAGE_DOS_SIGNATURE)
+                return false;
+
+            const auto nt = (const IMAGE_NT_HEADERS*)((uintptr_t)handle + dos->e_lfanew);
+            if (nt->Signature != IMAGE_NT_SIGNATURE)
+                return false;
+
+            identity->Hash = Ashita::PatternCache::Hash(&nt->FileHeader, sizeof(IMAGE_FILE_HEADER));
+            identity->Hash = Ashita::PatternCache::Hash(IMAGE_FIRST_SECTION(nt), nt->FileHeader.NumberOfSections * sizeof(IMAGE_SECTION_HEADER), identity->Hash);
+
+            // Hash the raw data of each section from the module file..
+            Ashita::MappedFile file;
+            if (!file.Open(path))
+                return false;
+
+            const auto section = IMAGE_FIRST_SECTION(nt);
+            for (auto x = 0; x < nt->FileHeader.NumberOfSections; x++)
+            {
+                const auto offset = (size_t)section[x].PointerToRawData;
+                const auto size   = (size_t)section[x].SizeOfRawData;
+
+                if (size == 0)
+                    continue;
+                if (offset > file.GetSize() || size > file.GetSize() - offset)
+                    return false;
+
+                identity->Hash = Ashita::PatternCache::Hash(file.GetData() + offset, size, identity->Hash);
+            }
+
+            return true;
+        }
+
     public:
         /**
          * Finds the given pattern within the given address space.
@@ -134,54 +179,68 @@ namespace Ashita
             if (baseAddress == 0 || size == 0)
                 return 0;
 
-            // Validate the incoming pattern is properly aligned..
-            const auto len = strlen(pattern);
-            if (len == 0 || len % 2 > 0)
+            // Compile the pattern..
+            compiledpattern_t cpattern;
+            if (!Ashita::PatternScanner::Compile(pattern, offset, count, &cpattern))
                 return 0;
 
-            // Convert the pattern to a vectored pair..
-            std::vector<std::pair<uint8_t, bool>> vpattern;
-            for (size_t x = 0, y = len / 2; x < y; x++)
-            {
-                // Convert the current byte into the vectored pattern data..
-                if (std::stringstream stream(std::string(pattern + (x * 2), 2)); stream.str() == "??")
-                    vpattern.push_back(std::make_pair((uint8_t)0, false));
-                else
-                {
-                    const auto b = strtol(stream.str().c_str(), nullptr, 16);
-                    vpattern.push_back(std::make_pair((uint8_t)b, true));
-                }
-            }
+            return Ashita::PatternScanner::Scan(baseAddress, size, cpattern);
+        }
 
-            // Create a scannable iterator..
-            scannableiterator_t<uint8_t> data(baseAddress, size);
-            auto scanStart = data.begin();
-            auto result    = (uintptr_t)0;
+        /**
+         * Finds the given compiled patterns within the given address space, in a single pass.
+         *
+         * @param {uintptr_t} baseAddress - The address to start searching for the patterns within.
+         * @param {uintptr_t} size - The size of data to search within. (Starting from baseAddress.)
+         * @param {std::vector&} patterns - The compiled patterns to search for.
+         * @return {std::vector} The addresses where each pattern was found. (0 for patterns that were not found.)
+         *
+         * @notes
+         *
+         *      Plugins that need to locate multiple patterns within the same module should prefer this over
+         *      multiple FindPattern calls, as the module is only walked once for the entire set of patterns.
+         */
+        static std::vector<uintptr_t> FindPatterns(const uintptr_t baseAddress, const uintptr_t size, const std::vector<compiledpattern_t>& patterns)
+        {
+            std::vector<uintptr_t> results(patterns.size(), 0);
+            if (patterns.size() > 0)
+                Ashita::PatternScanner::ScanBatch(baseAddress, size, patterns.data(), patterns.size(), results.data());
 
-            while (true)
-            {
-                // Search for the pattern..
-                auto ret = std::search(scanStart, data.end(), vpattern.begin(), vpattern.end(),
-                    [&](const uint8_t curr, const std::pair<uint8_t, bool> currPattern) {
-                        return !currPattern.second || curr == currPattern.first;
-                    });
-
-                // Check for a match..
-                if (ret != data.end())
-                {
-                    // Use the current result if no increased count expected..
-                    if (result == count || count == 0)
-                        return std::distance(data.begin(), ret) + baseAddress + offset;
+            return results;
+        }
 
-                    // Scan for the next result..
-                    ++result;
-                    scanStart = ++ret;
-                }
-                else
-                    break;
-            }
+        /**
+         * Resolves the given pattern entries within the currently loaded modules, scanning modules concurrently.
+         *
+         * @param {std::vector&} entries - The entries to resolve.
+         * @param {Threading::TaskPool*} pool - The task pool to scan with. (nullptr to scan on the calling thread.)
+         * @param {PatternCache*} cache - The optional pattern cache to consult and update.
+         * @return {std::vector} The results of each entry, in the same order as the given entries.
+         *
+         * @notes
+         *
+         *      When a cache is given, the identity of each module is updated before it is scanned, discarding any
+         *      cached results that were made against a different build of the module.
+         *
+         *      Each result holds the time spent resolving it; PatternResolver::LogResults writes the per-entry
+         *      timings to the log. (ie. At Ashita::LogLevel::Debug.)
+         */
+        static std::vector<patternresult_t> FindPatterns(const std::vector<patternentry_t>& entries, Threading::TaskPool* pool, PatternCache* cache = nullptr)
+        {
+            const auto lookup = [cache](const char* moduleName, uintptr_t* baseAddress, uintptr_t* size) -> bool {
+                *baseAddress = Ashita::Memory::GetModuleBase(moduleName);
+                *size        = Ashita::Memory::GetModuleSize(moduleName);
 
-            return 0;
+                if (*baseAddress == 0 || *size == 0)
+                    return false;
+
+                if (moduleidentity_t identity{}; cache != nullptr && Ashita::Memory::GetModuleIdentity(moduleName, &identity))
+                    cache->SetModuleIdentity(moduleName, identity);
+
+                return true;
+            };
+
+            return Ashita::PatternResolver::Resolve(entries, lookup, pool, cache);
         }
 
     public:
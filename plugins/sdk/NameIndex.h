@@ -0,0 +1,571 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_NAMEINDEX_H_INCLUDED
+#define ASHITA_SDK_NAMEINDEX_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "ResourceSnapshot.h"
+
+namespace Ashita
+{
+    /**
+     * Name Index
+     *
+     * Indexes the names of a resource table (ie. the item names of a language, or a d_msg string table) for
+     * fast reverse lookups and searches, instead of scanning every id of the table.
+     *
+     * @notes
+     *
+     *      Names are case-folded (ASCII only; the trail bytes of Shift-JIS characters are left as-is) so every
+     *      lookup is case-insensitive. The index holds:
+     *
+     *          - An open-addressing hash table of the folded names, for exact lookups.
+     *          - The names ordered by their folded name, for prefix searches.
+     *          - A suffix array of the folded names, for substring searches.
+     *
+     *      Fuzzy searches score every name by the edit distance of the best matching part of the name, so they
+     *      are linear in the number of names; they are intended for interactive searches, not hot paths.
+     *
+     *      Names are added with Add, or one of the Build helpers, and the index is built with Build. An index
+     *      can be saved to a resource snapshot and loaded from it later, which skips reading the resources.
+     */
+    class NameIndex
+    {
+    public:
+        static constexpr uint32_t InvalidId = 0xFFFFFFFF; // The id returned for unknown names.
+
+    private:
+        /**
+         * Name Entry Object
+         */
+        struct entry_t
+        {
+            uint32_t Id;     // The resource id.
+            uint32_t Offset; // The offset of the name within the name buffers.
+            uint32_t Length; // The length of the name.
+        };
+
+        std::vector<std::pair<uint32_t, std::string>> m_Pending; // The names added since the last build.
+
+        std::string m_Names;             // The names, each null terminated.
+        std::string m_Folded;            // The folded names, each null terminated. (Same offsets as m_Names.)
+        std::vector<entry_t> m_Entries;  // The entries, ordered by id.
+        std::vector<uint32_t> m_Hash;    // The hash table of entry indexes. (Stored + 1; 0 marks an empty slot.)
+        std::vector<uint32_t> m_Sorted;  // The entry indexes, ordered by folded name.
+        std::vector<uint32_t> m_Suffix;  // The suffix array of m_Folded.
+
+    public:
+        /**
+         * Removes every name from the index.
+         */
+        void Clear(void)
+        {
+            this->m_Pending.clear();
+            this->m_Names.clear();
+            this->m_Folded.clear();
+            this->m_Entries.clear();
+            this->m_Hash.clear();
+            this->m_Sorted.clear();
+            this->m_Suffix.clear();
+        }
+
+        /**
+         * Adds a name to the index. (The index must be rebuilt with Build afterward.)
+         *
+         * @param {uint32_t} id - The resource id.
+         * @param {const char*} name - The resource name. (Empty names are ignored.)
+         */
+        void Add(const uint32_t id, const char* name)
+        {
+            if (name != nullptr && name[0] != '\0')
+                this->m_Pending.emplace_back(id, name);
+        }
+
+        /**
+         * Builds the index from the added names, keeping any names previously built.
+         */
+        void Build(void)
+        {
+            std::vector<std::pair<uint32_t, std::string>> names;
+            names.reserve(this->m_Entries.size() + this->m_Pending.size());
+
+            for (const auto& e : this->m_Entries)
+                names.emplace_back(e.Id, std::string(this->m_Names.data() + e.Offset, e.Length));
+            for (auto& p : this->m_Pending)
+                names.push_back(std::move(p));
+
+            this->Clear();
+
+            std::stable_sort(names.begin(), names.end(), [](const auto& a, const auto& b) {
+                return a.first < b.first;
+            });
+
+            // Lay out the names..
+            for (const auto& n : names)
+            {
+                this->m_Entries.push_back({n.first, (uint32_t)this->m_Names.size(), (uint32_t)n.second.size()});
+                this->m_Names.append(n.second).push_back('\0');
+            }
+
+            this->m_Folded = this->m_Names;
+            NameIndex::Fold(this->m_Folded.data(), this->m_Folded.size());
+
+            // Build the hash table, sized to keep the load factor at or below 50%..
+            auto capacity = (size_t)16;
+            while (capacity < this->m_Entries.size() * 2)
+                capacity <<= 1;
+
+            this->m_Hash.assign(capacity, 0);
+            for (uint32_t x = 0; x < (uint32_t)this->m_Entries.size(); x++)
+            {
+                auto pos = NameIndex::Hash(this->GetFolded(x)) & (capacity - 1);
+                while (this->m_Hash[pos] != 0)
+                    pos = (pos + 1) & (capacity - 1);
+
+                this->m_Hash[pos] = x + 1;
+            }
+
+            // Build the sorted names..
+            this->m_Sorted.resize(this->m_Entries.size());
+            for (uint32_t x = 0; x < (uint32_t)this->m_Sorted.size(); x++)
+                this->m_Sorted[x] = x;
+
+            std::stable_sort(this->m_Sorted.begin(), this->m_Sorted.end(), [this](const uint32_t a, const uint32_t b) {
+                return std::strcmp(this->GetFolded(a), this->GetFolded(b)) < 0;
+            });
+
+            // Build the suffix array; every suffix ends at its names null terminator..
+            for (uint32_t x = 0; x < (uint32_t)this->m_Folded.size(); x++)
+            {
+                if (this->m_Folded[x] != '\0')
+                    this->m_Suffix.push_back(x);
+            }
+
+            const auto folded = this->m_Folded.c_str();
+            std::sort(this->m_Suffix.begin(), this->m_Suffix.end(), [folded](const uint32_t a, const uint32_t b) {
+                return std::strcmp(folded + a, folded + b) < 0;
+            });
+        }
+
+        /**
+         * Builds the index from the item names of the given language.
+         *
+         * @param {T*} resources - The resource manager. (Any object implementing GetItemById; ie. IResourceManager.)
+         * @param {uint32_t} langId - The language id. (0 = Default, 1 = Japanese, 2 = English)
+         */
+        template<typename T>
+        void BuildItems(const T* resources, const uint32_t langId)
+        {
+            this->BuildResources(resources, langId, 65536, [resources](const uint32_t id) {
+                return resources->GetItemById(id);
+            });
+        }
+
+        /**
+         * Builds the index from the ability names of the given language.
+         *
+         * @param {T*} resources - The resource manager. (Any object implementing GetAbilityById; ie. IResourceManager.)
+         * @param {uint32_t} langId - The language id. (0 = Default, 1 = Japanese, 2 = English)
+         * @param {uint32_t} count - The number of ability ids to read.
+         */
+        template<typename T>
+        void BuildAbilities(const T* resources, const uint32_t langId, const uint32_t count = 4096)
+        {
+            this->BuildResources(resources, langId, count, [resources](const uint32_t id) {
+                return resources->GetAbilityById(id);
+            });
+        }
+
+        /**
+         * Builds the index from the spell names of the given language.
+         *
+         * @param {T*} resources - The resource manager. (Any object implementing GetSpellById; ie. IResourceManager.)
+         * @param {uint32_t} langId - The language id. (0 = Default, 1 = Japanese, 2 = English)
+         * @param {uint32_t} count - The number of spell ids to read.
+         */
+        template<typename T>
+        void BuildSpells(const T* resources, const uint32_t langId, const uint32_t count = 1024)
+        {
+            this->BuildResources(resources, langId, count, [resources](const uint32_t id) {
+                return resources->GetSpellById(id);
+            });
+        }
+
+        /**
+         * Builds the index from a string table of the given language.
+         *
+         * @param {T*} resources - The resource manager. (Any object implementing GetString; ie. IResourceManager.)
+         * @param {const char*} table - The string table name. (ie. keyitems.names)
+         * @param {uint32_t} langId - The language id. (0 = Default, 1 = Japanese, 2 = English)
+         * @param {uint32_t} count - The number of string indexes to read.
+         */
+        template<typename T>
+        void BuildStrings(const T* resources, const char* table, const uint32_t langId, const uint32_t count = 65536)
+        {
+            this->Clear();
+
+            if (resources == nullptr || table == nullptr)
+                return;
+
+            for (uint32_t x = 0; x < count; x++)
+                this->Add(x, resources->GetString(table, x, langId));
+
+            this->Build();
+        }
+
+        /**
+         * Saves the index names to a resource snapshot table.
+         *
+         * @param {ResourceSnapshotWriter*} writer - The snapshot writer.
+         * @param {const char*} table - The snapshot table name.
+         */
+        void Save(ResourceSnapshotWriter* writer, const char* table) const
+        {
+            if (writer == nullptr)
+                return;
+
+            const auto t = writer->AddTable(table, ResourceSnapshot::TypeString);
+            for (uint32_t x = 0; x < (uint32_t)this->m_Entries.size(); x++)
+                writer->AddString(t, this->m_Entries[x].Id, this->GetName(x));
+        }
+
+        /**
+         * Builds the index from a resource snapshot table.
+         *
+         * @param {const ResourceSnapshotReader*} reader - The snapshot reader.
+         * @param {const char*} table - The snapshot table name.
+         * @return {bool} True on success, false if the table was not found.
+         */
+        bool Load(const ResourceSnapshotReader* reader, const char* table)
+        {
+            this->Clear();
+
+            const auto t = reader == nullptr ? nullptr : reader->GetTable(table);
+            if (t == nullptr)
+                return false;
+
+            const auto entries = reader->GetEntries(t);
+            for (uint32_t x = 0; x < t->Count; x++)
+                this->Add(entries[x].Id, reader->FindString(t, entries[x].Id));
+
+            this->Build();
+            return true;
+        }
+
+        /**
+         * Returns the number of names in the index.
+         *
+         * @return {uint32_t} The number of names.
+         */
+        uint32_t GetCount(void) const
+        {
+            return (uint32_t)this->m_Entries.size();
+        }
+
+        /**
+         * Returns the name of the given id.
+         *
+         * @param {uint32_t} id - The resource id.
+         * @return {const char*} The name if found, nullptr otherwise.
+         */
+        const char* GetNameById(const uint32_t id) const
+        {
+            const auto iter = std::lower_bound(this->m_Entries.begin(), this->m_Entries.end(), id, [](const entry_t& e, const uint32_t v) {
+                return e.Id < v;
+            });
+
+            return iter == this->m_Entries.end() || iter->Id != id ? nullptr : this->m_Names.c_str() + iter->Offset;
+        }
+
+        /**
+         * Returns the id of the given name. (Case-insensitive.)
+         *
+         * @param {const char*} name - The name to find.
+         * @return {uint32_t} The lowest id of the name if found, NameIndex::InvalidId otherwise.
+         */
+        uint32_t Find(const char* name) const
+        {
+            std::vector<uint32_t> ids;
+            return this->FindAll(name, &ids, 1) > 0 ? ids[0] : NameIndex::InvalidId;
+        }
+
+        /**
+         * Returns the ids of the given name. (Case-insensitive.)
+         *
+         * @param {const char*} name - The name to find.
+         * @param {std::vector*} ids - The vector to fill with the found ids, ordered by id.
+         * @param {uint32_t} max - The maximum number of ids to return.
+         * @return {uint32_t} The number of ids found.
+         */
+        uint32_t FindAll(const char* name, std::vector<uint32_t>* ids, const uint32_t max = 0xFFFFFFFF) const
+        {
+            if (ids == nullptr)
+                return 0;
+
+            ids->clear();
+
+            if (name == nullptr || name[0] == '\0' || this->m_Hash.empty())
+                return 0;
+
+            std::string folded(name);
+            NameIndex::Fold(folded.data(), folded.size());
+
+            std::vector<uint32_t> found;
+
+            const auto capacity = this->m_Hash.size();
+            for (auto pos = NameIndex::Hash(folded.c_str()) & (capacity - 1); this->m_Hash[pos] != 0; pos = (pos + 1) & (capacity - 1))
+            {
+                const auto index = this->m_Hash[pos] - 1;
+                if (std::strcmp(this->GetFolded(index), folded.c_str()) == 0)
+                    found.push_back(index);
+            }
+
+            return this->Collect(&found, ids, max);
+        }
+
+        /**
+         * Returns the ids of the names starting with the given prefix. (Case-insensitive.)
+         *
+         * @param {const char*} prefix - The prefix to find.
+         * @param {std::vector*} ids - The vector to fill with the found ids, ordered by id.
+         * @param {uint32_t} max - The maximum number of ids to return.
+         * @return {uint32_t} The number of ids found.
+         */
+        uint32_t FindPrefix(const char* prefix, std::vector<uint32_t>* ids, const uint32_t max = 0xFFFFFFFF) const
+        {
+            if (ids == nullptr)
+                return 0;
+
+            ids->clear();
+
+            if (prefix == nullptr || prefix[0] == '\0')
+                return 0;
+
+            std::string folded(prefix);
+            NameIndex::Fold(folded.data(), folded.size());
+
+            const auto iter = std::lower_bound(this->m_Sorted.begin(), this->m_Sorted.end(), folded, [this](const uint32_t index, const std::string& v) {
+                return std::strcmp(this->GetFolded(index), v.c_str()) < 0;
+            });
+
+            std::vector<uint32_t> found;
+            for (auto it = iter; it != this->m_Sorted.end() && std::strncmp(this->GetFolded(*it), folded.c_str(), folded.size()) == 0; ++it)
+                found.push_back(*it);
+
+            return this->Collect(&found, ids, max);
+        }
+
+        /**
+         * Returns the ids of the names containing the given string. (Case-insensitive.)
+         *
+         * @param {const char*} str - The string to find.
+         * @param {std::vector*} ids - The vector to fill with the found ids, ordered by id.
+         * @param {uint32_t} max - The maximum number of ids to return.
+         * @return {uint32_t} The number of ids found.
+         */
+        uint32_t FindSubstring(const char* str, std::vector<uint32_t>* ids, const uint32_t max = 0xFFFFFFFF) const
+        {
+            if (ids == nullptr)
+                return 0;
+
+            ids->clear();
+
+            if (str == nullptr || str[0] == '\0')
+                return 0;
+
+            std::string folded(str);
+            NameIndex::Fold(folded.data(), folded.size());
+
+            const auto data = this->m_Folded.c_str();
+            const auto iter = std::lower_bound(this->m_Suffix.begin(), this->m_Suffix.end(), folded, [data](const uint32_t pos, const std::string& v) {
+                return std::strncmp(data + pos, v.c_str(), v.size()) < 0;
+            });
+
+            // Map each matching suffix to the entry holding it..
+            std::vector<uint32_t> found;
+            for (auto it = iter; it != this->m_Suffix.end() && std::strncmp(data + *it, folded.c_str(), folded.size()) == 0; ++it)
+            {
+                const auto entry = std::upper_bound(this->m_Entries.begin(), this->m_Entries.end(), *it, [](const uint32_t pos, const entry_t& e) {
+                    return pos < e.Offset;
+                });
+                found.push_back((uint32_t)(entry - this->m_Entries.begin()) - 1);
+            }
+
+            return this->Collect(&found, ids, max);
+        }
+
+        /**
+         * Returns the ids of the names approximately containing the given string. (Case-insensitive.)
+         *
+         * @param {const char*} str - The string to find.
+         * @param {std::vector*} ids - The vector to fill with the found ids, ordered by their distance, then by id.
+         * @param {uint32_t} maxDistance - The maximum number of edits between the string and the best matching part of a name.
+         * @param {uint32_t} max - The maximum number of ids to return.
+         * @return {uint32_t} The number of ids found.
+         */
+        uint32_t FindFuzzy(const char* str, std::vector<uint32_t>* ids, const uint32_t maxDistance = 2, const uint32_t max = 0xFFFFFFFF) const
+        {
+            if (ids == nullptr)
+                return 0;
+
+            ids->clear();
+
+            if (str == nullptr || str[0] == '\0')
+                return 0;
+
+            std::string folded(str);
+            NameIndex::Fold(folded.data(), folded.size());
+
+            const auto len = (uint32_t)folded.size();
+
+            std::vector<std::pair<uint32_t, uint32_t>> found;
+            std::vector<uint32_t> column(len + 1);
+
+            for (uint32_t x = 0; x < (uint32_t)this->m_Entries.size(); x++)
+            {
+                // Names shorter than the string by more than the distance cannot match..
+                const auto& e = this->m_Entries[x];
+                if (e.Length + maxDistance < len)
+                    continue;
+
+                // Edit distance of the string against the best matching part of the name. (Free leading and trailing characters.)
+                for (uint32_t y = 0; y <= len; y++)
+                    column[y] = y;
+
+                auto best = column[len];
+                for (uint32_t y = 0; y < e.Length; y++)
+                {
+                    const auto c = this->m_Folded[e.Offset + y];
+
+                    auto diag = column[0];
+                    for (uint32_t z = 1; z <= len; z++)
+                    {
+                        const auto prev = column[z];
+                        column[z]       = std::min({column[z] + 1, column[z - 1] + 1, diag + (folded[z - 1] == c ? 0u : 1u)});
+                        diag            = prev;
+                    }
+
+                    best = std::min(best, column[len]);
+                }
+
+                if (best <= maxDistance)
+                    found.emplace_back(best, x);
+            }
+
+            std::sort(found.begin(), found.end());
+
+            for (const auto& f : found)
+            {
+                if (ids->size() >= max)
+                    break;
+                ids->push_back(this->m_Entries[f.second].Id);
+            }
+
+            return (uint32_t)ids->size();
+        }
+
+    private:
+        template<typename T, typename F>
+        void BuildResources(const T* resources, const uint32_t langId, const uint32_t count, F get)
+        {
+            this->Clear();
+
+            if (resources == nullptr || langId > 2)
+                return;
+
+            for (uint32_t x = 0; x < count; x++)
+            {
+                const auto res = get(x);
+                if (res != nullptr)
+                    this->Add(x, res->Name[langId]);
+            }
+
+            this->Build();
+        }
+
+        const char* GetName(const uint32_t index) const
+        {
+            return this->m_Names.c_str() + this->m_Entries[index].Offset;
+        }
+
+        const char* GetFolded(const uint32_t index) const
+        {
+            return this->m_Folded.c_str() + this->m_Entries[index].Offset;
+        }
+
+        uint32_t Collect(std::vector<uint32_t>* found, std::vector<uint32_t>* ids, const uint32_t max) const
+        {
+            // Entries are ordered by id, so ordering the entry indexes orders the ids..
+            std::sort(found->begin(), found->end());
+            found->erase(std::unique(found->begin(), found->end()), found->end());
+
+            for (const auto index : *found)
+            {
+                if (ids->size() >= max)
+                    break;
+                ids->push_back(this->m_Entries[index].Id);
+            }
+
+            return (uint32_t)ids->size();
+        }
+
+        static void Fold(char* str, const size_t size)
+        {
+            for (size_t x = 0; x < size; x++)
+            {
+                const auto c = (uint8_t)str[x];
+
+                // Skip the trail byte of Shift-JIS characters, which can fall within the ASCII letters..
+                if ((c >= 0x81 && c <= 0x9F) || (c >= 0xE0 && c <= 0xFC))
+                {
+                    if (x + 1 < size && str[x + 1] != '\0')
+                        x++;
+                    continue;
+                }
+
+                if (c >= 'A' && c <= 'Z')
+                    str[x] = (char)(c + ('a' - 'A'));
+            }
+        }
+
+        static size_t Hash(const char* str)
+        {
+            auto hash = (uint32_t)0x811C9DC5;
+            for (; *str != '\0'; str++)
+                hash = (hash ^ (uint8_t)*str) * 0x01000193;
+
+            return hash;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_NAMEINDEX_H_INCLUDED
\ No newline at end of file
@@ -0,0 +1,688 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_PACKETCAPTURE_H_INCLUDED
+#define ASHITA_SDK_PACKETCAPTURE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+#include "PacketSubscription.h"
+
+namespace Ashita
+{
+    /**
+     * Packet Capture File Header
+     *
+     * The header at the start of every packet capture file.
+     */
+    struct packetcaptureheader_t
+    {
+        char Magic[4];      // The file magic. ('APKT')
+        uint16_t Version;   // The file format version.
+        uint16_t Size;      // The size of this header, in bytes. (Records start at this offset.)
+        uint64_t StartTime; // The time the capture was started. (Unix time, in milliseconds.)
+    };
+
+    /**
+     * Packet Capture Record Header
+     *
+     * The header of each packet record within a packet capture file. The packet data follows the header
+     * directly, padded to an 8 byte boundary so every record header stays aligned when the file is mapped.
+     */
+    struct packetcapturerecord_t
+    {
+        uint32_t Length;    // The length of the record, in bytes. (Including this header and padding.)
+        uint16_t Id;        // The packet id.
+        uint16_t Size;      // The size of the packet data, in bytes.
+        uint8_t Direction;  // The packet direction. (See: Ashita::PacketDirection)
+        uint8_t Flags;      // The packet flags. (See: PacketCapture::FlagInjected, PacketCapture::FlagBlocked)
+        uint16_t Reserved;  // Reserved.
+        uint32_t Sequence;  // The record sequence number.
+        uint64_t Timestamp; // The time the packet was captured, in nanoseconds, relative to the start of the capture.
+    };
+
+    static_assert(sizeof(packetcaptureheader_t) == 16, "packetcaptureheader_t must be 16 bytes.");
+    static_assert(sizeof(packetcapturerecord_t) == 24, "packetcapturerecord_t must be 24 bytes.");
+
+    namespace PacketCapture
+    {
+        constexpr uint16_t Version       = 1;    // The current file format version.
+        constexpr uint8_t FlagInjected   = 0x01; // Flag set if the packet was injected.
+        constexpr uint8_t FlagBlocked    = 0x02; // Flag set if the packet was blocked.
+        constexpr uint32_t RecordAlign   = 8;    // The alignment of each record.
+    } // namespace PacketCapture
+
+    /**
+     * Packet Capture Writer
+     *
+     * Writes packets to a packet capture file. Intended to be fed from the incoming and outgoing packet
+     * handlers. (ie. IPlugin::HandleIncomingPacket and IPlugin::HandleOutgoingPacket)
+     *
+     * @notes
+     *
+     *      Writes are guarded by a lock, as incoming and outgoing packets can be handled on different threads.
+     *      Records are buffered and written to the file in blocks.
+     */
+    class PacketCaptureWriter
+    {
+        std::mutex m_Mutex;
+        std::ofstream m_File;
+        uint32_t m_Sequence;
+        std::chrono::steady_clock::time_point m_Start;
+        std::vector<uint8_t> m_Buffer;
+
+    public:
+        PacketCaptureWriter(void)
+            : m_Sequence(0)
+        {}
+        ~PacketCaptureWriter(void)
+        {
+            this->Close();
+        }
+
+        PacketCaptureWriter(const PacketCaptureWriter&)            = delete;
+        PacketCaptureWriter& operator=(const PacketCaptureWriter&) = delete;
+
+        /**
+         * Opens a new capture file, replacing any existing file.
+         *
+         * @param {const char*} path - The path to the capture file.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Open(const char* path)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            this->CloseUnlocked();
+
+            if (path == nullptr)
+                return false;
+
+            this->m_File.open(path, std::ios::binary | std::ios::trunc);
+            if (!this->m_File.is_open())
+                return false;
+
+            packetcaptureheader_t header{};
+            std::memcpy(header.Magic, "APKT", 4);
+            header.Version   = PacketCapture::Version;
+            header.Size      = sizeof(packetcaptureheader_t);
+            header.StartTime = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+            if (!this->m_File.write((const char*)&header, sizeof(header)))
+            {
+                this->CloseUnlocked();
+                return false;
+            }
+
+            this->m_Sequence = 0;
+            this->m_Start    = std::chrono::steady_clock::now();
+            this->m_Buffer.reserve(64 * 1024);
+
+            return true;
+        }
+
+        /**
+         * Flushes and closes the capture file.
+         */
+        void Close(void)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            this->CloseUnlocked();
+        }
+
+        /**
+         * Returns if the capture file is open.
+         *
+         * @return {bool} True if open, false otherwise.
+         */
+        bool IsOpen(void)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            return this->m_File.is_open();
+        }
+
+        /**
+         * Writes a packet to the capture file.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {uint16_t} id - The packet id.
+         * @param {uint32_t} size - The size of the packet data.
+         * @param {const uint8_t*} data - The packet data.
+         * @param {bool} injected - Flag if the packet was injected.
+         * @param {bool} blocked - Flag if the packet was blocked.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Write(const PacketDirection direction, const uint16_t id, const uint32_t size, const uint8_t* data, const bool injected, const bool blocked)
+        {
+            if (size > 0xFFFF || (size > 0 && data == nullptr))
+                return false;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            if (!this->m_File.is_open())
+                return false;
+
+            const auto length = (uint32_t)((sizeof(packetcapturerecord_t) + size + (PacketCapture::RecordAlign - 1)) & ~(PacketCapture::RecordAlign - 1));
+
+            packetcapturerecord_t record{};
+            record.Length    = length;
+            record.Id        = id;
+            record.Size      = (uint16_t)size;
+            record.Direction = (uint8_t)direction;
+            record.Flags     = (injected ? PacketCapture::FlagInjected : 0) | (blocked ? PacketCapture::FlagBlocked : 0);
+            record.Sequence  = this->m_Sequence++;
+            record.Timestamp = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->m_Start).count();
+
+            const auto offset = this->m_Buffer.size();
+            this->m_Buffer.resize(offset + length, 0);
+            std::memcpy(this->m_Buffer.data() + offset, &record, sizeof(record));
+            if (size > 0)
+                std::memcpy(this->m_Buffer.data() + offset + sizeof(record), data, size);
+
+            if (this->m_Buffer.size() >= 64 * 1024)
+                return this->FlushUnlocked();
+
+            return true;
+        }
+
+        /**
+         * Writes any buffered records to the capture file.
+         *
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Flush(void)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            return this->FlushUnlocked();
+        }
+
+    private:
+        bool FlushUnlocked(void)
+        {
+            if (!this->m_File.is_open())
+                return false;
+
+            if (this->m_Buffer.size() > 0)
+                this->m_File.write((const char*)this->m_Buffer.data(), (std::streamsize)this->m_Buffer.size());
+
+            this->m_Buffer.clear();
+            this->m_File.flush();
+
+            return this->m_File.good();
+        }
+
+        void CloseUnlocked(void)
+        {
+            if (!this->m_File.is_open())
+                return;
+
+            this->FlushUnlocked();
+            this->m_File.close();
+            this->m_File.clear();
+        }
+    };
+
+    /**
+     * Packet Capture Reader
+     *
+     * Reads the records of a packet capture file. The file is memory mapped, so records are read in place.
+     */
+    class PacketCaptureReader
+    {
+        MappedFile m_File;
+        const uint8_t* m_Data;
+        size_t m_Size;
+        size_t m_Offset;
+
+    public:
+        PacketCaptureReader(void)
+            : m_Data(nullptr)
+            , m_Size(0)
+            , m_Offset(0)
+        {}
+        ~PacketCaptureReader(void)
+        {
+            this->Close();
+        }
+
+        PacketCaptureReader(const PacketCaptureReader&)            = delete;
+        PacketCaptureReader& operator=(const PacketCaptureReader&) = delete;
+
+        /**
+         * Opens and maps a capture file.
+         *
+         * @param {const char*} path - The path to the capture file.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Open(const char* path)
+        {
+            this->Close();
+
+            if (!this->m_File.Open(path))
+                return false;
+
+            this->m_Data = this->m_File.GetData();
+            this->m_Size = this->m_File.GetSize();
+
+            if (!this->Validate())
+            {
+                this->Close();
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * Uses an in-memory capture instead of a file. (The data must remain valid while in use.)
+         *
+         * @param {const uint8_t*} data - The capture data.
+         * @param {size_t} size - The size of the capture data.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Open(const uint8_t* data, const size_t size)
+        {
+            this->Close();
+
+            this->m_Data = data;
+            this->m_Size = data == nullptr ? 0 : size;
+
+            if (!this->Validate())
+            {
+                this->m_Data = nullptr;
+                this->m_Size = 0;
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * Unmaps and closes the capture file.
+         */
+        void Close(void)
+        {
+            this->m_File.Close();
+
+            this->m_Data   = nullptr;
+            this->m_Size   = 0;
+            this->m_Offset = 0;
+        }
+
+        /**
+         * Returns the capture file header.
+         *
+         * @return {const packetcaptureheader_t*} The header if open, nullptr otherwise.
+         */
+        const packetcaptureheader_t* GetHeader(void) const
+        {
+            return this->m_Data == nullptr ? nullptr : (const packetcaptureheader_t*)this->m_Data;
+        }
+
+        /**
+         * Moves the reader back to the first record.
+         */
+        void Rewind(void)
+        {
+            this->m_Offset = this->m_Data == nullptr ? 0 : this->GetHeader()->Size;
+        }
+
+        /**
+         * Reads the next record of the capture.
+         *
+         * @param {const packetcapturerecord_t**} record - The record header.
+         * @param {const uint8_t**} data - The record packet data.
+         * @return {bool} True if a record was read, false if the end of the capture (or a damaged record) was reached.
+         */
+        bool Next(const packetcapturerecord_t** record, const uint8_t** data)
+        {
+            if (this->m_Data == nullptr || this->m_Offset + sizeof(packetcapturerecord_t) > this->m_Size)
+                return false;
+
+            const auto r = (const packetcapturerecord_t*)(this->m_Data + this->m_Offset);
+            if (r->Length < sizeof(packetcapturerecord_t) + r->Size || r->Length > this->m_Size - this->m_Offset)
+                return false;
+
+            if (record != nullptr)
+                *record = r;
+            if (data != nullptr)
+                *data = this->m_Data + this->m_Offset + sizeof(packetcapturerecord_t);
+
+            this->m_Offset += r->Length;
+            return true;
+        }
+
+    private:
+        bool Validate(void)
+        {
+            if (this->m_Size < sizeof(packetcaptureheader_t))
+                return false;
+
+            const auto header = (const packetcaptureheader_t*)this->m_Data;
+            if (std::memcmp(header->Magic, "APKT", 4) != 0 || header->Version != PacketCapture::Version || header->Size < sizeof(packetcaptureheader_t) || header->Size > this->m_Size)
+                return false;
+
+            this->m_Offset = header->Size;
+            return true;
+        }
+    };
+
+    /**
+     * Latency Histogram
+     *
+     * Records durations, in nanoseconds, into log-linear buckets. (Each power of two is split into 8 buckets,
+     * giving percentiles within 12.5% of the true value without storing every sample.)
+     */
+    class LatencyHistogram
+    {
+        static constexpr uint32_t SubBuckets = 8;
+
+        std::vector<uint64_t> m_Buckets;
+        uint64_t m_Count;
+        uint64_t m_Total;
+        uint64_t m_Min;
+        uint64_t m_Max;
+
+    public:
+        LatencyHistogram(void)
+            : m_Buckets(64 * SubBuckets, 0)
+            , m_Count(0)
+            , m_Total(0)
+            , m_Min(UINT64_MAX)
+            , m_Max(0)
+        {}
+
+        /**
+         * Records a duration.
+         *
+         * @param {uint64_t} ns - The duration, in nanoseconds.
+         */
+        void Record(const uint64_t ns)
+        {
+            this->m_Buckets[LatencyHistogram::GetBucket(ns)]++;
+            this->m_Count++;
+            this->m_Total += ns;
+            this->m_Min = std::min(this->m_Min, ns);
+            this->m_Max = std::max(this->m_Max, ns);
+        }
+
+        /**
+         * Returns the number of recorded durations.
+         *
+         * @return {uint64_t} The number of durations.
+         */
+        uint64_t GetCount(void) const
+        {
+            return this->m_Count;
+        }
+
+        /**
+         * Returns the total of the recorded durations.
+         *
+         * @return {uint64_t} The total, in nanoseconds.
+         */
+        uint64_t GetTotal(void) const
+        {
+            return this->m_Total;
+        }
+
+        /**
+         * Returns the smallest recorded duration.
+         *
+         * @return {uint64_t} The duration, in nanoseconds.
+         */
+        uint64_t GetMin(void) const
+        {
+            return this->m_Count == 0 ? 0 : this->m_Min;
+        }
+
+        /**
+         * Returns the largest recorded duration.
+         *
+         * @return {uint64_t} The duration, in nanoseconds.
+         */
+        uint64_t GetMax(void) const
+        {
+            return this->m_Max;
+        }
+
+        /**
+         * Returns the mean of the recorded durations.
+         *
+         * @return {double} The mean, in nanoseconds.
+         */
+        double GetMean(void) const
+        {
+            return this->m_Count == 0 ? 0.0 : (double)this->m_Total / (double)this->m_Count;
+        }
+
+        /**
+         * Returns the given percentile of the recorded durations.
+         *
+         * @param {double} percentile - The percentile to return. (0 to 100.)
+         * @return {uint64_t} The upper bound of the bucket holding the percentile, in nanoseconds.
+         */
+        uint64_t GetPercentile(const double percentile) const
+        {
+            if (this->m_Count == 0)
+                return 0;
+
+            const auto target = (uint64_t)((std::min(std::max(percentile, 0.0), 100.0) / 100.0) * (double)(this->m_Count - 1)) + 1;
+
+            uint64_t seen = 0;
+            for (uint32_t x = 0; x < this->m_Buckets.size(); x++)
+            {
+                seen += this->m_Buckets[x];
+                if (seen >= target)
+                    return std::min(LatencyHistogram::GetBucketLimit(x), this->m_Max);
+            }
+
+            return this->m_Max;
+        }
+
+    private:
+        static uint32_t GetBucket(const uint64_t ns)
+        {
+            if (ns < SubBuckets)
+                return (uint32_t)ns;
+
+            uint32_t exp = 63;
+            while (((ns >> exp) & 1) == 0)
+                exp--;
+
+            // The exponent selects the power of two; the next 3 bits select the sub bucket..
+            const auto sub = (uint32_t)(ns >> (exp - 3)) & (SubBuckets - 1);
+            return ((exp - 2) * SubBuckets) + sub;
+        }
+
+        static uint64_t GetBucketLimit(const uint32_t bucket)
+        {
+            if (bucket < SubBuckets)
+                return bucket;
+
+            const auto exp = (bucket / SubBuckets) + 2;
+            const auto sub = (uint64_t)(bucket % SubBuckets);
+
+            return ((SubBuckets + sub + 1) << (exp - 3)) - 1;
+        }
+    };
+
+    /**
+     * Packet Replay
+     *
+     * Feeds the packets of a capture through a set of packet handlers as fast as possible, timing each handler.
+     *
+     * @notes
+     *
+     *      The replay has no dependency on the Ashita core, so it can be built and run outside of the game. (ie. on
+     *      Linux.) Plugins are added with AddPlugin, which only requires the plugin object to implement the
+     *      HandleIncomingPacket and HandleOutgoingPacket methods, allowing plugins initialized against a stubbed
+     *      core to be benchmarked. Anything else (ie. an addon runtime) can be added as a plain handler.
+     *
+     *      Each packet is copied into a modified buffer before being dispatched, matching how the packet manager
+     *      passes packets to handlers. Handlers are called in the order they were added, and a handler blocking
+     *      a packet is passed on to the following handlers, the same as a live session.
+     */
+    class PacketReplay
+    {
+        struct handler_t
+        {
+            std::string Name;
+            packethandler_f Incoming;
+            packethandler_f Outgoing;
+            LatencyHistogram Histogram;
+        };
+
+        std::vector<handler_t> m_Handlers;
+
+    public:
+        /**
+         * Adds a named handler to the replay.
+         *
+         * @param {const char*} name - The name of the handler, used in the report.
+         * @param {packethandler_f&} incoming - The incoming packet handler. (Can be empty.)
+         * @param {packethandler_f&} outgoing - The outgoing packet handler. (Can be empty.)
+         */
+        void AddHandler(const char* name, const packethandler_f& incoming, const packethandler_f& outgoing)
+        {
+            this->m_Handlers.push_back({name == nullptr ? "" : name, incoming, outgoing, LatencyHistogram()});
+        }
+
+        /**
+         * Adds a plugin to the replay.
+         *
+         * @param {const char*} name - The name of the plugin, used in the report.
+         * @param {T*} plugin - The plugin object. (Must implement HandleIncomingPacket and HandleOutgoingPacket.)
+         */
+        template<typename T>
+        void AddPlugin(const char* name, T* plugin)
+        {
+            this->AddHandler(
+                name,
+                [plugin](uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked) {
+                    return plugin->HandleIncomingPacket(id, size, data, modified, sizeChunk, dataChunk, injected, blocked);
+                },
+                [plugin](uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked) {
+                    return plugin->HandleOutgoingPacket(id, size, data, modified, sizeChunk, dataChunk, injected, blocked);
+                });
+        }
+
+        /**
+         * Replays every record of the given capture through the handlers.
+         *
+         * @param {PacketCaptureReader&} reader - The capture reader.
+         * @param {uint32_t} iterations - The number of times to replay the capture.
+         * @return {uint64_t} The number of packets replayed.
+         */
+        uint64_t Run(PacketCaptureReader& reader, const uint32_t iterations = 1)
+        {
+            uint8_t modified[0x10000]{};
+            uint64_t count = 0;
+
+            for (uint32_t x = 0; x < iterations; x++)
+            {
+                reader.Rewind();
+
+                const packetcapturerecord_t* record = nullptr;
+                const uint8_t* data                 = nullptr;
+
+                while (reader.Next(&record, &data))
+                {
+                    std::memcpy(modified, data, record->Size);
+
+                    const auto injected = (record->Flags & PacketCapture::FlagInjected) != 0;
+                    auto blocked        = (record->Flags & PacketCapture::FlagBlocked) != 0;
+
+                    for (auto& h : this->m_Handlers)
+                    {
+                        const auto& handler = record->Direction == (uint8_t)PacketDirection::Incoming ? h.Incoming : h.Outgoing;
+                        if (!handler)
+                            continue;
+
+                        const auto start = std::chrono::steady_clock::now();
+                        const auto ret   = handler(record->Id, record->Size, data, modified, record->Size, data, injected, blocked);
+                        const auto end   = std::chrono::steady_clock::now();
+
+                        h.Histogram.Record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+                        if (ret)
+                            blocked = true;
+                    }
+
+                    count++;
+                }
+            }
+
+            return count;
+        }
+
+        /**
+         * Returns the histogram of the given handler.
+         *
+         * @param {size_t} index - The index of the handler.
+         * @return {const LatencyHistogram*} The histogram if valid, nullptr otherwise.
+         */
+        const LatencyHistogram* GetHistogram(const size_t index) const
+        {
+            return index < this->m_Handlers.size() ? &this->m_Handlers[index].Histogram : nullptr;
+        }
+
+        /**
+         * Returns a report of the per-handler timings.
+         *
+         * @return {std::string} The report, one line per handler.
+         */
+        std::string GetReport(void) const
+        {
+            std::string ret;
+            char line[512]{};
+
+            ::snprintf(line, sizeof(line), "%-24s %12s %10s %10s %10s %10s %10s\n", "handler", "packets", "mean(ns)", "p50(ns)", "p90(ns)", "p99(ns)", "max(ns)");
+            ret += line;
+
+            for (const auto& h : this->m_Handlers)
+            {
+                const auto& hist = h.Histogram;
+                ::snprintf(line, sizeof(line), "%-24s %12" PRIu64 " %10.1f %10" PRIu64 " %10" PRIu64 " %10" PRIu64 " %10" PRIu64 "\n",
+                    h.Name.c_str(), hist.GetCount(), hist.GetMean(), hist.GetPercentile(50.0), hist.GetPercentile(90.0), hist.GetPercentile(99.0), hist.GetMax());
+                ret += line;
+            }
+
+            return ret;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PACKETCAPTURE_H_INCLUDED
\ No newline at end of file
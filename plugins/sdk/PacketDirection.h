@@ -0,0 +1,47 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ASHITA_SDK_PACKETDIRECTION_H_INCLUDED
+#define ASHITA_SDK_PACKETDIRECTION_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cinttypes>
+
+namespace Ashita
+{
+    /**
+     * Packet Direction
+     *
+     * The direction a packet is travelling in.
+     */
+    enum class PacketDirection : uint8_t
+    {
+        Incoming = 0, // The packet was sent from the server to the client.
+        Outgoing = 1, // The packet was sent from the client to the server.
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PACKETDIRECTION_H_INCLUDED
\ No newline at end of file
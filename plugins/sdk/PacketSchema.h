@@ -0,0 +1,957 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_PACKETSCHEMA_H_INCLUDED
+#define ASHITA_SDK_PACKETSCHEMA_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <cinttypes>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "BinaryData.h"
+#include "PacketDirection.h"
+
+namespace Ashita
+{
+    /**
+     * Schema Field Type
+     *
+     * Defines how the raw bits of a field are interpreted.
+     */
+    enum class SchemaFieldType : uint8_t
+    {
+        Unsigned = 0, // The field is an unsigned integer.
+        Signed   = 1, // The field is a signed integer. (Sign extended from the field width.)
+        Float    = 2, // The field is a 32bit float.
+        Bytes    = 3, // The field is a raw block of bytes. (ie. strings, the value holds the bit position of the block.)
+        Array    = 4, // The field is an array of records.
+    };
+
+    /**
+     * Schema Instruction Object
+     *
+     * A single instruction of a compiled packet schema program.
+     */
+    struct schemainstr_t
+    {
+        enum class OpCode : uint8_t
+        {
+            Seek,       // Moves the cursor to the bit position in Arg.
+            Value,      // Reads a value into Slot.
+            Bytes,      // Skips Arg bytes, storing the start position of the block into Slot.
+            Array,      // Decodes an array of records. (Count taken from the slot in Arg, or Arg itself if Flag is set.)
+            If,         // Executes the following block if the slot in Arg is non-zero.
+            End,        // Ends an Array or If block.
+        };
+
+        OpCode Op;            // The instruction operation.
+        SchemaFieldType Type; // The field type of a Value instruction.
+        uint8_t Bits;         // The field width, in bits, of a Value instruction.
+        bool Flag;            // Flag set if an Array instructions count is a fixed count.
+        uint32_t Slot;        // The destination slot within the current record.
+        uint32_t Arg;         // The instruction argument.
+        uint32_t Scope;       // The record scope of an Array instructions elements.
+        uint32_t Jump;        // The index of the matching End instruction of an Array or If block.
+    };
+
+    /**
+     * Schema Field Object
+     *
+     * Describes a named field of a compiled packet schema.
+     */
+    struct schemafield_t
+    {
+        std::string Name;     // The full path of the field. (ie. target.result.value)
+        SchemaFieldType Type; // The field type.
+        uint8_t Bits;         // The field width, in bits. (Or size, in bytes, of a Bytes field.)
+        uint32_t Scope;       // The record scope the field belongs to.
+        uint32_t Slot;        // The slot of the field within its record.
+        uint32_t Child;       // The record scope of an Array fields elements.
+        uint32_t Position;    // The static bit position of the field. (PacketSchema::NoPosition if it depends on earlier fields.)
+    };
+
+    class DecodedPacket;
+
+    /**
+     * Packet Schema
+     *
+     * Declares the layout of a single packet and compiles it into a flat decode program.
+     *
+     * @notes
+     *
+     *      Fields are read from a cursor that advances as each field is read, in the same bit order as
+     *      Ashita::BinaryData::UnpackBitsBE. Fixed fields are declared by seeking to their offset first. Offsets
+     *      are relative to the start of the packet data, including the packet header.
+     *
+     *      Every record (the packet itself, and each element of an array) is stored as a fixed block of 64bit
+     *      slots. Value fields take one slot, array fields take two. (The index of the arrays first element
+     *      block and the element count.) Fields within a skipped If block are left as 0.
+     *
+     *      The schema must be compiled before it can be used to decode packets. Once compiled, the schema is
+     *      immutable and can be shared across threads.
+     */
+    class PacketSchema
+    {
+        /**
+         * Schema Scope Object
+         *
+         * Holds the layout of a record scope while the schema is being declared.
+         */
+        struct scope_t
+        {
+            std::string Path; // The path prefix of the scopes fields.
+            uint32_t Size;    // The number of slots used by the scopes records.
+        };
+
+        uint16_t m_Id;
+        PacketDirection m_Direction;
+        bool m_IsCompiled;
+        bool m_IsValid;
+        uint32_t m_Cursor; // The static cursor position while declaring. (NoPosition once it depends on earlier fields.)
+
+        std::vector<schemainstr_t> m_Program;
+        std::vector<schemafield_t> m_Fields;
+        std::vector<scope_t> m_Scopes;
+        std::vector<uint32_t> m_Open; // The instruction indexes of the currently open Array and If blocks.
+        std::vector<uint32_t> m_Stack; // The currently open record scopes.
+
+    public:
+        static constexpr uint32_t MaxDepth   = 16;         // The maximum array nesting depth.
+        static constexpr uint32_t NoPosition = 0xFFFFFFFF; // The position of fields without a static position.
+
+        PacketSchema(const uint16_t id, const PacketDirection direction)
+            : m_Id(id)
+            , m_Direction(direction)
+            , m_IsCompiled(false)
+            , m_IsValid(true)
+            , m_Cursor(0)
+        {
+            this->m_Scopes.push_back({"", 0});
+            this->m_Stack.push_back(0);
+        }
+
+        /**
+         * Moves the cursor to the given position.
+         *
+         * @param {uint32_t} byteOffset - The byte offset to move to.
+         * @param {uint32_t} bitOffset - The bit offset, within the byte, to move to.
+         * @return {PacketSchema&} The schema object.
+         */
+        PacketSchema& Seek(const uint32_t byteOffset, const uint32_t bitOffset = 0)
+        {
+            this->Emit(schemainstr_t::OpCode::Seek, SchemaFieldType::Unsigned, 0, 0, (byteOffset * 8) + bitOffset);
+            this->m_Cursor = (byteOffset * 8) + bitOffset;
+            return *this;
+        }
+
+        /**
+         * Declares a value field at the current cursor position.
+         *
+         * @param {const char*} name - The name of the field.
+         * @param {uint8_t} bits - The width of the field, in bits. (1 to 64.)
+         * @param {SchemaFieldType} type - The type of the field.
+         * @return {PacketSchema&} The schema object.
+         */
+        PacketSchema& Field(const char* name, const uint8_t bits, const SchemaFieldType type = SchemaFieldType::Unsigned)
+        {
+            if (bits == 0 || bits > 64 || (type == SchemaFieldType::Float && bits != 32) || type == SchemaFieldType::Bytes || type == SchemaFieldType::Array)
+            {
+                this->m_IsValid = false;
+                return *this;
+            }
+
+            const auto slot = this->AddField(name, type, bits, 1);
+            if (!this->m_IsValid)
+                return *this;
+
+            this->Emit(schemainstr_t::OpCode::Value, type, bits, slot, 0);
+            this->Advance(bits);
+            return *this;
+        }
+
+        /**
+         * Declares a value field at the given position.
+         *
+         * @param {const char*} name - The name of the field.
+         * @param {uint32_t} byteOffset - The byte offset of the field.
+         * @param {uint8_t} bits - The width of the field, in bits. (1 to 64.)
+         * @param {SchemaFieldType} type - The type of the field.
+         * @return {PacketSchema&} The schema object.
+         */
+        PacketSchema& Field(const char* name, const uint32_t byteOffset, const uint8_t bits, const SchemaFieldType type = SchemaFieldType::Unsigned)
+        {
+            return this->Seek(byteOffset).Field(name, bits, type);
+        }
+
+        /**
+         * Declares a raw block of bytes at the current cursor position.
+         *
+         * @param {const char*} name - The name of the field.
+         * @param {uint8_t} size - The size of the block, in bytes.
+         * @return {PacketSchema&} The schema object.
+         */
+        PacketSchema& Bytes(const char* name, const uint8_t size)
+        {
+            const auto slot = this->AddField(name, SchemaFieldType::Bytes, size, 1);
+            if (!this->m_IsValid)
+                return *this;
+
+            this->Emit(schemainstr_t::OpCode::Bytes, SchemaFieldType::Bytes, 0, slot, size);
+            this->Advance(size * 8);
+            return *this;
+        }
+
+        /**
+         * Begins an array of records whose element count is read from a previously declared field.
+         *
+         * @param {const char*} name - The name of the array.
+         * @param {const char*} countField - The name of the field holding the element count. (Must belong to the current record.)
+         * @return {PacketSchema&} The schema object.
+         */
+        PacketSchema& BeginArray(const char* name, const char* countField)
+        {
+            const auto field = this->FindLocal(countField);
+            if (field == nullptr || field->Type == SchemaFieldType::Array || field->Type == SchemaFieldType::Bytes)
+            {
+                this->m_IsValid = false;
+                return *this;
+            }
+
+            return this->OpenArray(name, field->Slot, false);
+        }
+
+        /**
+         * Begins an array of records with a fixed element count.
+         *
+         * @param {const char*} name - The name of the array.
+         * @param {uint32_t} count - The element count.
+         * @return {PacketSchema&} The schema object.
+         */
+        PacketSchema& BeginArray(const char* name, const uint32_t count)
+        {
+            return this->OpenArray(name, count, true);
+        }
+
+        /**
+         * Ends the current array.
+         *
+         * @return {PacketSchema&} The schema object.
+         */
+        PacketSchema& EndArray(void)
+        {
+            return this->Close(schemainstr_t::OpCode::Array);
+        }
+
+        /**
+         * Begins a block of fields that are only present if the given field is non-zero.
+         *
+         * @param {const char*} flagField - The name of the field to test. (Must belong to the current record.)
+         * @return {PacketSchema&} The schema object.
+         */
+        PacketSchema& BeginIf(const char* flagField)
+        {
+            const auto field = this->FindLocal(flagField);
+            if (field == nullptr || field->Type == SchemaFieldType::Array || field->Type == SchemaFieldType::Bytes)
+            {
+                this->m_IsValid = false;
+                return *this;
+            }
+
+            this->m_Open.push_back((uint32_t)this->m_Program.size());
+            this->Emit(schemainstr_t::OpCode::If, SchemaFieldType::Unsigned, 0, 0, field->Slot);
+            this->m_Cursor = PacketSchema::NoPosition;
+            return *this;
+        }
+
+        /**
+         * Ends the current If block.
+         *
+         * @return {PacketSchema&} The schema object.
+         */
+        PacketSchema& EndIf(void)
+        {
+            return this->Close(schemainstr_t::OpCode::If);
+        }
+
+        /**
+         * Compiles the schema, finalizing its program.
+         *
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Compile(void)
+        {
+            if (this->m_IsCompiled)
+                return this->m_IsValid;
+
+            if (this->m_Open.size() != 0)
+                this->m_IsValid = false;
+
+            // Ensure every array element record holds at least one field..
+            for (auto& i : this->m_Program)
+            {
+                if (i.Op == schemainstr_t::OpCode::Array && this->m_Scopes[i.Scope].Size == 0)
+                    this->m_IsValid = false;
+            }
+
+            this->m_IsCompiled = true;
+            this->m_Open.clear();
+            this->m_Stack.clear();
+            this->m_Program.shrink_to_fit();
+            this->m_Fields.shrink_to_fit();
+
+            return this->m_IsValid;
+        }
+
+        /**
+         * Returns the packet id of the schema.
+         *
+         * @return {uint16_t} The packet id.
+         */
+        uint16_t GetId(void) const
+        {
+            return this->m_Id;
+        }
+
+        /**
+         * Returns the packet direction of the schema.
+         *
+         * @return {PacketDirection} The packet direction.
+         */
+        PacketDirection GetDirection(void) const
+        {
+            return this->m_Direction;
+        }
+
+        /**
+         * Returns if the schema has been compiled successfully.
+         *
+         * @return {bool} True if compiled and valid, false otherwise.
+         */
+        bool GetIsCompiled(void) const
+        {
+            return this->m_IsCompiled && this->m_IsValid;
+        }
+
+        /**
+         * Returns the compiled program of the schema.
+         *
+         * @return {std::vector&} The program instructions.
+         */
+        const std::vector<schemainstr_t>& GetProgram(void) const
+        {
+            return this->m_Program;
+        }
+
+        /**
+         * Returns the fields of the schema.
+         *
+         * @return {std::vector&} The schema fields.
+         */
+        const std::vector<schemafield_t>& GetFields(void) const
+        {
+            return this->m_Fields;
+        }
+
+        /**
+         * Returns the number of slots used by the records of the given scope.
+         *
+         * @param {uint32_t} scope - The record scope.
+         * @return {uint32_t} The number of slots.
+         */
+        uint32_t GetScopeSize(const uint32_t scope) const
+        {
+            return scope < this->m_Scopes.size() ? this->m_Scopes[scope].Size : 0;
+        }
+
+        /**
+         * Returns the field with the given path.
+         *
+         * @param {const char*} path - The full path of the field. (ie. target.result.value)
+         * @return {const schemafield_t*} The field on success, nullptr otherwise.
+         */
+        const schemafield_t* Find(const char* path) const
+        {
+            if (path == nullptr)
+                return nullptr;
+
+            for (const auto& f : this->m_Fields)
+            {
+                if (f.Name == path)
+                    return &f;
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * Decodes the given packet data.
+         *
+         * @param {const uint8_t*} data - The packet data.
+         * @param {uint32_t} size - The size of the packet data.
+         * @param {DecodedPacket*} packet - The decoded packet object to decode into.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Decode(const uint8_t* data, uint32_t size, DecodedPacket* packet) const;
+
+    private:
+        /**
+         * Appends an instruction to the program.
+         */
+        void Emit(const schemainstr_t::OpCode op, const SchemaFieldType type, const uint8_t bits, const uint32_t slot, const uint32_t arg)
+        {
+            if (this->m_IsCompiled)
+            {
+                this->m_IsValid = false;
+                return;
+            }
+
+            this->m_Program.push_back({op, type, bits, false, slot, arg, 0, 0});
+        }
+
+        /**
+         * Adds a field to the current record scope, returning its slot.
+         */
+        uint32_t AddField(const char* name, const SchemaFieldType type, const uint8_t bits, const uint32_t slots)
+        {
+            if (name == nullptr || name[0] == '\0' || this->m_Stack.size() == 0 || this->FindLocal(name) != nullptr)
+            {
+                this->m_IsValid = false;
+                return 0;
+            }
+
+            auto& scope     = this->m_Scopes[this->m_Stack.back()];
+            const auto slot = scope.Size;
+            scope.Size += slots;
+
+            this->m_Fields.push_back({scope.Path + name, type, bits, this->m_Stack.back(), slot, 0, PacketSchema::NoPosition});
+            return slot;
+        }
+
+        /**
+         * Stores the static position of the last declared field and advances the cursor past it.
+         *
+         * @notes
+         *
+         *      Only root fields outside of any Array or If block are given a static position. Fields within an
+         *      If block may not be present, so they are always read by decoding the full packet.
+         */
+        void Advance(const uint32_t bits)
+        {
+            if (this->m_Cursor == PacketSchema::NoPosition)
+                return;
+
+            if (this->m_Open.size() == 0)
+                this->m_Fields.back().Position = this->m_Cursor;
+
+            this->m_Cursor += bits;
+        }
+
+        /**
+         * Returns the field of the current record scope with the given name.
+         */
+        const schemafield_t* FindLocal(const char* name) const
+        {
+            if (name == nullptr || this->m_Stack.size() == 0)
+                return nullptr;
+
+            const auto path = this->m_Scopes[this->m_Stack.back()].Path + name;
+            return this->Find(path.c_str());
+        }
+
+        /**
+         * Opens a new array block and its element record scope.
+         */
+        PacketSchema& OpenArray(const char* name, const uint32_t count, const bool fixed)
+        {
+            const auto slot = this->AddField(name, SchemaFieldType::Array, 0, 2);
+            if (!this->m_IsValid)
+                return *this;
+
+            if (this->m_Stack.size() >= PacketSchema::MaxDepth)
+            {
+                this->m_IsValid = false;
+                return *this;
+            }
+
+            const auto scope = (uint32_t)this->m_Scopes.size();
+            this->m_Fields.back().Child = scope;
+            this->m_Scopes.push_back({this->m_Scopes[this->m_Stack.back()].Path + name + ".", 0});
+
+            this->m_Open.push_back((uint32_t)this->m_Program.size());
+            this->Emit(schemainstr_t::OpCode::Array, SchemaFieldType::Array, 0, slot, count);
+            this->m_Program.back().Flag  = fixed;
+            this->m_Program.back().Scope = scope;
+            this->m_Stack.push_back(scope);
+            this->m_Cursor = PacketSchema::NoPosition;
+
+            return *this;
+        }
+
+        /**
+         * Closes the current Array or If block.
+         */
+        PacketSchema& Close(const schemainstr_t::OpCode op)
+        {
+            if (this->m_Open.size() == 0 || this->m_Program[this->m_Open.back()].Op != op)
+            {
+                this->m_IsValid = false;
+                return *this;
+            }
+
+            const auto open = this->m_Open.back();
+            this->m_Open.pop_back();
+
+            this->m_Program[open].Jump = (uint32_t)this->m_Program.size();
+            this->Emit(schemainstr_t::OpCode::End, SchemaFieldType::Unsigned, 0, 0, open);
+
+            if (op == schemainstr_t::OpCode::Array)
+                this->m_Stack.pop_back();
+
+            this->m_Cursor = PacketSchema::NoPosition;
+            return *this;
+        }
+    };
+
+    /**
+     * Packet Record
+     *
+     * A lightweight view of a single record (the packet itself, or an array element) of a decoded packet.
+     */
+    class PacketRecord
+    {
+        const DecodedPacket* m_Packet;
+        uint32_t m_Scope;
+        uint32_t m_Base;
+
+    public:
+        PacketRecord(const DecodedPacket* packet, const uint32_t scope, const uint32_t base)
+            : m_Packet(packet)
+            , m_Scope(scope)
+            , m_Base(base)
+        {}
+
+        /**
+         * Returns if the record is valid.
+         *
+         * @return {bool} True if valid, false otherwise.
+         */
+        bool IsValid(void) const
+        {
+            return this->m_Packet != nullptr;
+        }
+
+        uint64_t Get(const schemafield_t* field) const;
+        int64_t GetSigned(const schemafield_t* field) const;
+        float GetFloat(const schemafield_t* field) const;
+        const uint8_t* GetBytes(const schemafield_t* field, uint32_t* size) const;
+        uint32_t GetCount(const schemafield_t* field) const;
+        PacketRecord GetElement(const schemafield_t* field, uint32_t index) const;
+    };
+
+    /**
+     * Decoded Packet
+     *
+     * Holds the result of decoding a packet with a packet schema.
+     *
+     * @notes
+     *
+     *      The decoded values are stored in a single slot arena that is reused between decodes. Reusing the
+     *      same object for each packet avoids allocating once the arena has grown to fit the largest packet.
+     *
+     *      Bytes fields point into the original packet data and are only valid while that data is.
+     */
+    class DecodedPacket
+    {
+        friend class PacketSchema;
+        friend class PacketRecord;
+
+        const PacketSchema* m_Schema;
+        const uint8_t* m_Data;
+        uint32_t m_Size;
+        std::vector<uint64_t> m_Slots;
+
+    public:
+        DecodedPacket(void)
+            : m_Schema(nullptr)
+            , m_Data(nullptr)
+            , m_Size(0)
+        {}
+
+        /**
+         * Returns the schema used to decode the packet.
+         *
+         * @return {const PacketSchema*} The packet schema.
+         */
+        const PacketSchema* GetSchema(void) const
+        {
+            return this->m_Schema;
+        }
+
+        /**
+         * Returns the root record of the packet.
+         *
+         * @return {PacketRecord} The root record.
+         */
+        PacketRecord GetRoot(void) const
+        {
+            return PacketRecord(this->m_Schema == nullptr ? nullptr : this, 0, 0);
+        }
+
+        /**
+         * Returns the value of a root field, by its path.
+         *
+         * @param {const char*} path - The path of the field.
+         * @return {uint64_t} The field value.
+         */
+        uint64_t Get(const char* path) const
+        {
+            if (this->m_Schema == nullptr)
+                return 0;
+
+            return this->GetRoot().Get(this->m_Schema->Find(path));
+        }
+
+        /**
+         * Returns the number of slots in use by the decoded packet.
+         *
+         * @return {size_t} The number of slots.
+         */
+        size_t GetSlotCount(void) const
+        {
+            return this->m_Slots.size();
+        }
+    };
+
+    /**
+     * Executes the schema program over the given packet data.
+     *
+     * @notes
+     *
+     *      The program is run with a small explicit stack instead of recursion. Each open array keeps the
+     *      instruction index of its body, its remaining element count, the base slot of its current element and
+     *      the bit position its current element started at.
+     *
+     *      Arrays whose count is read from the packet are bounded by the packet itself; the count may not exceed
+     *      the bits remaining, and every element must consume at least one bit. Packets that fail either check are
+     *      rejected instead of decoding (and allocating) elements that read nothing.
+     */
+    inline bool PacketSchema::Decode(const uint8_t* data, const uint32_t size, DecodedPacket* packet) const
+    {
+        if (packet == nullptr || data == nullptr || !this->GetIsCompiled())
+            return false;
+
+        struct frame_t
+        {
+            uint32_t Instr; // The index of the Array instruction.
+            uint32_t Base;  // The base slot of the current element.
+            uint32_t Left;  // The remaining element count.
+            uint32_t Start; // The bit position the current element started at.
+        };
+
+        packet->m_Schema = this;
+        packet->m_Data   = data;
+        packet->m_Size   = size;
+        packet->m_Slots.assign(this->m_Scopes[0].Size, 0);
+
+        Ashita::BitReader reader(data, size);
+
+        frame_t frames[PacketSchema::MaxDepth]{};
+        uint32_t depth = 0;
+        uint32_t base  = 0;
+
+        for (uint32_t pc = 0; pc < this->m_Program.size(); pc++)
+        {
+            const auto& i = this->m_Program[pc];
+
+            switch (i.Op)
+            {
+                case schemainstr_t::OpCode::Seek:
+                    reader.Seek(i.Arg);
+                    break;
+
+                case schemainstr_t::OpCode::Value:
+                {
+                    auto value = reader.Read(i.Bits);
+                    if (i.Type == SchemaFieldType::Signed && i.Bits < 64 && (value >> (i.Bits - 1)) & 1)
+                        value |= ~Ashita::BinaryData::BitMask(i.Bits);
+
+                    packet->m_Slots[base + i.Slot] = value;
+                    break;
+                }
+
+                case schemainstr_t::OpCode::Bytes:
+                    packet->m_Slots[base + i.Slot] = reader.GetPosition();
+                    reader.Skip(i.Arg * 8);
+                    break;
+
+                case schemainstr_t::OpCode::Array:
+                {
+                    const auto count = i.Flag ? i.Arg : (uint32_t)packet->m_Slots[base + i.Arg];
+                    const auto scope = this->m_Scopes[i.Scope].Size;
+
+                    // Guard against malformed counts; every element must consume at least one bit..
+                    if (depth == PacketSchema::MaxDepth || (!i.Flag && count > reader.GetRemaining()))
+                        return false;
+
+                    const auto first = (uint32_t)packet->m_Slots.size();
+                    packet->m_Slots[base + i.Slot]     = first;
+                    packet->m_Slots[base + i.Slot + 1] = count;
+
+                    if (count == 0)
+                    {
+                        pc = i.Jump;
+                        break;
+                    }
+
+                    packet->m_Slots.resize(first + (size_t)count * scope, 0);
+                    frames[depth++] = {pc, base, count, reader.GetPosition()};
+                    base            = first;
+                    break;
+                }
+
+                case schemainstr_t::OpCode::If:
+                    if (packet->m_Slots[base + i.Arg] == 0)
+                        pc = i.Jump;
+                    break;
+
+                case schemainstr_t::OpCode::End:
+                {
+                    if (this->m_Program[i.Arg].Op != schemainstr_t::OpCode::Array)
+                        break;
+
+                    auto& f = frames[depth - 1];
+
+                    // Reject counted elements that did not advance the reader..
+                    if (!this->m_Program[f.Instr].Flag && reader.GetPosition() <= f.Start)
+                        return false;
+
+                    if (--f.Left > 0)
+                    {
+                        base += this->m_Scopes[this->m_Program[f.Instr].Scope].Size;
+                        f.Start = reader.GetPosition();
+                        pc      = f.Instr;
+                        break;
+                    }
+
+                    base = f.Base;
+                    depth--;
+                    break;
+                }
+            }
+
+            if (reader.GetIsOverrun())
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Returns the unsigned value of a field.
+     *
+     * @param {const schemafield_t*} field - The field to read.
+     * @return {uint64_t} The field value.
+     */
+    inline uint64_t PacketRecord::Get(const schemafield_t* field) const
+    {
+        if (this->m_Packet == nullptr || field == nullptr || field->Scope != this->m_Scope)
+            return 0;
+
+        return this->m_Packet->m_Slots[this->m_Base + field->Slot];
+    }
+
+    /**
+     * Returns the signed value of a field.
+     *
+     * @param {const schemafield_t*} field - The field to read.
+     * @return {int64_t} The field value.
+     */
+    inline int64_t PacketRecord::GetSigned(const schemafield_t* field) const
+    {
+        return (int64_t)this->Get(field);
+    }
+
+    /**
+     * Returns the float value of a field.
+     *
+     * @param {const schemafield_t*} field - The field to read.
+     * @return {float} The field value.
+     */
+    inline float PacketRecord::GetFloat(const schemafield_t* field) const
+    {
+        const auto raw = (uint32_t)this->Get(field);
+
+        float ret = 0.0f;
+        std::memcpy(&ret, &raw, sizeof(float));
+        return ret;
+    }
+
+    /**
+     * Returns a pointer to the data of a Bytes field.
+     *
+     * @param {const schemafield_t*} field - The field to read.
+     * @param {uint32_t*} size - The size of the field, in bytes.
+     * @return {const uint8_t*} The field data on success, nullptr otherwise.
+     *
+     * @notes
+     *
+     *      Bytes fields that do not start on a byte boundary cannot be returned directly and will return nullptr.
+     */
+    inline const uint8_t* PacketRecord::GetBytes(const schemafield_t* field, uint32_t* size) const
+    {
+        if (field == nullptr || field->Type != SchemaFieldType::Bytes)
+            return nullptr;
+
+        const auto pos = this->Get(field);
+        if ((pos & 7) != 0 || this->m_Packet == nullptr)
+            return nullptr;
+
+        if (size != nullptr)
+            *size = field->Bits;
+
+        return this->m_Packet->m_Data + (pos / 8);
+    }
+
+    /**
+     * Returns the element count of an Array field.
+     *
+     * @param {const schemafield_t*} field - The array field.
+     * @return {uint32_t} The element count.
+     */
+    inline uint32_t PacketRecord::GetCount(const schemafield_t* field) const
+    {
+        if (field == nullptr || field->Type != SchemaFieldType::Array || this->m_Packet == nullptr || field->Scope != this->m_Scope)
+            return 0;
+
+        return (uint32_t)this->m_Packet->m_Slots[this->m_Base + field->Slot + 1];
+    }
+
+    /**
+     * Returns an element record of an Array field.
+     *
+     * @param {const schemafield_t*} field - The array field.
+     * @param {uint32_t} index - The element index.
+     * @return {PacketRecord} The element record. (Invalid if the index is out of range.)
+     */
+    inline PacketRecord PacketRecord::GetElement(const schemafield_t* field, const uint32_t index) const
+    {
+        if (index >= this->GetCount(field))
+            return PacketRecord(nullptr, 0, 0);
+
+        const auto first = (uint32_t)this->m_Packet->m_Slots[this->m_Base + field->Slot];
+        const auto size  = this->m_Packet->m_Schema->GetScopeSize(field->Child);
+
+        return PacketRecord(this->m_Packet, field->Child, first + (index * size));
+    }
+
+    /**
+     * Packet Schema Registry
+     *
+     * Holds the compiled schemas of each packet id, per direction.
+     */
+    class PacketSchemaRegistry
+    {
+        mutable std::mutex m_Mutex;
+        std::array<std::shared_ptr<const PacketSchema>, 512> m_Incoming;
+        std::array<std::shared_ptr<const PacketSchema>, 512> m_Outgoing;
+
+    public:
+        /**
+         * Registers a schema, replacing any previously registered schema of the same packet.
+         *
+         * @param {std::shared_ptr} schema - The schema to register. (Compiled if it has not been already.)
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Register(std::shared_ptr<PacketSchema> schema)
+        {
+            if (schema == nullptr || schema->GetId() >= 512 || !schema->Compile())
+                return false;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            auto& table = schema->GetDirection() == PacketDirection::Incoming ? this->m_Incoming : this->m_Outgoing;
+            table[schema->GetId()] = schema;
+            return true;
+        }
+
+        /**
+         * Removes the schema of the given packet.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {uint16_t} id - The packet id.
+         */
+        void Unregister(const PacketDirection direction, const uint16_t id)
+        {
+            if (id >= 512)
+                return;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            (direction == PacketDirection::Incoming ? this->m_Incoming : this->m_Outgoing)[id] = nullptr;
+        }
+
+        /**
+         * Returns the schema of the given packet.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {uint16_t} id - The packet id.
+         * @return {std::shared_ptr} The schema if registered, nullptr otherwise.
+         */
+        std::shared_ptr<const PacketSchema> Get(const PacketDirection direction, const uint16_t id) const
+        {
+            if (id >= 512)
+                return nullptr;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            return (direction == PacketDirection::Incoming ? this->m_Incoming : this->m_Outgoing)[id];
+        }
+
+        /**
+         * Decodes the given packet with its registered schema.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {uint16_t} id - The packet id.
+         * @param {const uint8_t*} data - The packet data.
+         * @param {uint32_t} size - The size of the packet data.
+         * @param {DecodedPacket*} packet - The decoded packet object to decode into.
+         * @return {bool} True on success, false otherwise.
+         *
+         * @notes
+         *
+         *      The decoded packet holds a raw pointer to the schema. Schemas should not be replaced or removed
+         *      while a decoded packet of them is still in use.
+         */
+        bool Decode(const PacketDirection direction, const uint16_t id, const uint8_t* data, const uint32_t size, DecodedPacket* packet) const
+        {
+            const auto schema = this->Get(direction, id);
+            return schema != nullptr && schema->Decode(data, size, packet);
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PACKETSCHEMA_H_INCLUDED
\ No newline at end of file
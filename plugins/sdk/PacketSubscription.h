@@ -0,0 +1,306 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_PACKETSUBSCRIPTION_H_INCLUDED
+#define ASHITA_SDK_PACKETSUBSCRIPTION_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <vector>
+
+#include "PacketDirection.h"
+
+namespace Ashita
+{
+    /**
+     * Packet Subscription Object
+     *
+     * Holds the packet ids a plugin (or handler) wishes to receive, as a bitmap per direction.
+     *
+     * @notes
+     *
+     *      Packet ids are 9 bits wide, so each direction holds 512 bits.
+     *
+     *      This is an SDK-side filter; the core does not read it. Plugins check it themselves from their
+     *      packet events (or use PacketDispatcher) to skip the packets they are not interested in.
+     */
+    struct packetsubscription_t
+    {
+        uint32_t Incoming[16]; // The subscribed incoming packet ids.
+        uint32_t Outgoing[16]; // The subscribed outgoing packet ids.
+
+        packetsubscription_t(void)
+        {
+            this->Clear();
+        }
+
+        /**
+         * Removes all subscribed packet ids.
+         */
+        void Clear(void)
+        {
+            std::memset(this->Incoming, 0x00, sizeof(this->Incoming));
+            std::memset(this->Outgoing, 0x00, sizeof(this->Outgoing));
+        }
+
+        /**
+         * Subscribes to every packet of the given direction.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         */
+        void SubscribeAll(const PacketDirection direction)
+        {
+            std::memset(direction == PacketDirection::Incoming ? this->Incoming : this->Outgoing, 0xFF, sizeof(this->Incoming));
+        }
+
+        /**
+         * Subscribes to the given packet.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {uint16_t} id - The packet id.
+         */
+        void Subscribe(const PacketDirection direction, const uint16_t id)
+        {
+            if (id < 512)
+                (direction == PacketDirection::Incoming ? this->Incoming : this->Outgoing)[id >> 5] |= 1u << (id & 31);
+        }
+
+        /**
+         * Subscribes to the given packets.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {std::initializer_list} ids - The packet ids.
+         */
+        void Subscribe(const PacketDirection direction, std::initializer_list<uint16_t> ids)
+        {
+            for (const auto id : ids)
+                this->Subscribe(direction, id);
+        }
+
+        /**
+         * Unsubscribes from the given packet.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {uint16_t} id - The packet id.
+         */
+        void Unsubscribe(const PacketDirection direction, const uint16_t id)
+        {
+            if (id < 512)
+                (direction == PacketDirection::Incoming ? this->Incoming : this->Outgoing)[id >> 5] &= ~(1u << (id & 31));
+        }
+
+        /**
+         * Returns if the given packet is subscribed to.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {uint16_t} id - The packet id.
+         * @return {bool} True if subscribed, false otherwise.
+         */
+        bool IsSubscribed(const PacketDirection direction, const uint16_t id) const
+        {
+            if (id >= 512)
+                return false;
+
+            return ((direction == PacketDirection::Incoming ? this->Incoming : this->Outgoing)[id >> 5] >> (id & 31)) & 1;
+        }
+    };
+
+    /**
+     * Packet handler callback, matching the arguments of IPlugin::HandleIncomingPacket/HandleOutgoingPacket.
+     *
+     * @return {bool} True if the packet should be blocked, false otherwise.
+     */
+    typedef std::function<bool(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked)> packethandler_f;
+
+    /**
+     * Packet Dispatcher
+     *
+     * Dispatches packets only to the handlers subscribed to their id, using a 512 entry id to handler list
+     * table per direction. Intended for plugins that route packets to many internal handlers; the core still
+     * invokes the plugins packet events for every packet, and the plugin forwards them to Dispatch.
+     *
+     * @notes
+     *
+     *      Handlers are called in the order they were registered. Handlers subscribed to every packet are
+     *      added to every list, so dispatching a packet is a single table lookup regardless of how handlers
+     *      were registered.
+     *
+     *      Registration is guarded by a lock; dispatching is not, and must not overlap with registration.
+     *      (ie. register handlers during plugin initialization, or from the same thread packets are handled on.)
+     */
+    class PacketDispatcher
+    {
+        /**
+         * Handler Entry Object
+         */
+        struct entry_t
+        {
+            uint32_t Handle;         // The handle returned when the handler was registered. (Also its registration order.)
+            packethandler_f Handler; // The handler callback.
+        };
+
+        std::mutex m_Mutex;
+        uint32_t m_NextHandle;
+        std::array<std::vector<entry_t>, 512> m_Incoming;
+        std::array<std::vector<entry_t>, 512> m_Outgoing;
+
+    public:
+        PacketDispatcher(void)
+            : m_NextHandle(1)
+        {}
+
+        /**
+         * Registers a handler for the packets of the given subscription.
+         *
+         * @param {packetsubscription_t&} subscription - The packets to handle.
+         * @param {packethandler_f&} handler - The handler callback.
+         * @return {uint32_t} The handle of the registered handler, 0 on failure.
+         */
+        uint32_t Register(const packetsubscription_t& subscription, const packethandler_f& handler)
+        {
+            if (!handler)
+                return 0;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            const auto handle = this->m_NextHandle++;
+            for (uint16_t x = 0; x < 512; x++)
+            {
+                if (subscription.IsSubscribed(PacketDirection::Incoming, x))
+                    this->m_Incoming[x].push_back({handle, handler});
+                if (subscription.IsSubscribed(PacketDirection::Outgoing, x))
+                    this->m_Outgoing[x].push_back({handle, handler});
+            }
+
+            return handle;
+        }
+
+        /**
+         * Registers a handler for the given packets.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {std::initializer_list} ids - The packet ids to handle.
+         * @param {packethandler_f&} handler - The handler callback.
+         * @return {uint32_t} The handle of the registered handler, 0 on failure.
+         */
+        uint32_t Register(const PacketDirection direction, std::initializer_list<uint16_t> ids, const packethandler_f& handler)
+        {
+            packetsubscription_t subscription;
+            subscription.Subscribe(direction, ids);
+            return this->Register(subscription, handler);
+        }
+
+        /**
+         * Unregisters a previously registered handler.
+         *
+         * @param {uint32_t} handle - The handle of the handler.
+         */
+        void Unregister(const uint32_t handle)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            const auto pred = [handle](const entry_t& e) {
+                return e.Handle == handle;
+            };
+
+            for (uint16_t x = 0; x < 512; x++)
+            {
+                auto& in  = this->m_Incoming[x];
+                auto& out = this->m_Outgoing[x];
+                in.erase(std::remove_if(in.begin(), in.end(), pred), in.end());
+                out.erase(std::remove_if(out.begin(), out.end(), pred), out.end());
+            }
+        }
+
+        /**
+         * Returns if any handler is subscribed to the given packet.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {uint16_t} id - The packet id.
+         * @return {bool} True if subscribed, false otherwise.
+         */
+        bool IsSubscribed(const PacketDirection direction, const uint16_t id) const
+        {
+            return id < 512 && (direction == PacketDirection::Incoming ? this->m_Incoming : this->m_Outgoing)[id].size() > 0;
+        }
+
+        /**
+         * Returns the combined subscription of all registered handlers.
+         *
+         * @param {packetsubscription_t*} subscription - The subscription object to fill.
+         */
+        void GetSubscription(packetsubscription_t* subscription) const
+        {
+            if (subscription == nullptr)
+                return;
+
+            subscription->Clear();
+
+            for (uint16_t x = 0; x < 512; x++)
+            {
+                if (this->m_Incoming[x].size() > 0)
+                    subscription->Subscribe(PacketDirection::Incoming, x);
+                if (this->m_Outgoing[x].size() > 0)
+                    subscription->Subscribe(PacketDirection::Outgoing, x);
+            }
+        }
+
+        /**
+         * Dispatches a packet to the handlers subscribed to it.
+         *
+         * @param {PacketDirection} direction - The packet direction.
+         * @param {uint16_t} id - The packet id.
+         * @param {uint32_t} size - The size of the packet.
+         * @param {const uint8_t*} data - The original packet data.
+         * @param {uint8_t*} modified - The modified packet data.
+         * @param {uint32_t} sizeChunk - The size of the full packet chunk.
+         * @param {const uint8_t*} dataChunk - The data of the full packet chunk.
+         * @param {bool} injected - Flag if the packet was injected.
+         * @param {bool} blocked - Flag if the packet is blocked.
+         * @return {bool} True if the packet should be blocked, false otherwise.
+         */
+        bool Dispatch(const PacketDirection direction, const uint16_t id, const uint32_t size, const uint8_t* data, uint8_t* modified, const uint32_t sizeChunk, const uint8_t* dataChunk, const bool injected, bool blocked) const
+        {
+            if (id >= 512)
+                return blocked;
+
+            for (const auto& e : (direction == PacketDirection::Incoming ? this->m_Incoming : this->m_Outgoing)[id])
+            {
+                if (e.Handler(id, size, data, modified, sizeChunk, dataChunk, injected, blocked))
+                    blocked = true;
+            }
+
+            return blocked;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PACKETSUBSCRIPTION_H_INCLUDED
\ No newline at end of file
@@ -0,0 +1,334 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_PACKETVIEW_H_INCLUDED
+#define ASHITA_SDK_PACKETVIEW_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "BinaryData.h"
+#include "PacketSchema.h"
+
+namespace Ashita
+{
+    /**
+     * Packet View
+     *
+     * A zero-copy view over the raw data of a packet. (ie. the data given to HandleIncomingPacket and
+     * HandleOutgoingPacket.) Fields are only decoded when they are accessed.
+     *
+     * @notes
+     *
+     *      Raw reads (Read, ReadBits, ReadString) read directly from the packet data and are bounds checked,
+     *      returning 0 (or an empty string) when the read would pass the end of the packet.
+     *
+     *      When the view is given a schema, named fields can be accessed as well. Fields with a static position
+     *      are read directly the first time they are accessed and cached. Fields whose position depends on
+     *      earlier fields (ie. fields within arrays) cause the full packet to be decoded once, on first access.
+     *
+     *      The view does not own the packet data; it is only valid while the data is. A view can be reused
+     *      for the next packet by calling Reset, which avoids reallocating its caches.
+     */
+    class PacketView
+    {
+        const PacketSchema* m_Schema;
+        const uint8_t* m_Data;
+        uint32_t m_Size;
+
+        uint32_t m_Generation;               // The current generation of the cache. (Incremented on each reset.)
+        std::vector<uint32_t> m_Generations; // The generation each cached field value was stored in.
+        std::vector<uint64_t> m_Values;      // The cached field values.
+
+        DecodedPacket m_Decoded;
+        bool m_IsDecoded;
+        bool m_IsDecodeValid;
+
+    public:
+        PacketView(const uint8_t* data, const uint32_t size)
+            : m_Schema(nullptr)
+            , m_Data(nullptr)
+            , m_Size(0)
+            , m_Generation(0)
+            , m_IsDecoded(false)
+            , m_IsDecodeValid(false)
+        {
+            this->Reset(data, size);
+        }
+
+        PacketView(const PacketSchema* schema, const uint8_t* data, const uint32_t size)
+            : m_Schema(schema != nullptr && schema->GetIsCompiled() ? schema : nullptr)
+            , m_Data(nullptr)
+            , m_Size(0)
+            , m_Generation(0)
+            , m_IsDecoded(false)
+            , m_IsDecodeValid(false)
+        {
+            if (this->m_Schema != nullptr)
+            {
+                this->m_Generations.resize(this->m_Schema->GetFields().size(), 0);
+                this->m_Values.resize(this->m_Schema->GetFields().size(), 0);
+            }
+
+            this->Reset(data, size);
+        }
+
+        /**
+         * Points the view at new packet data, invalidating any cached fields.
+         *
+         * @param {const uint8_t*} data - The packet data.
+         * @param {uint32_t} size - The size of the packet data.
+         */
+        void Reset(const uint8_t* data, const uint32_t size)
+        {
+            this->m_Data          = data;
+            this->m_Size          = data == nullptr ? 0 : size;
+            this->m_IsDecoded     = false;
+            this->m_IsDecodeValid = false;
+
+            // Invalidate the cache by generation; on wrap around the cache must be cleared instead..
+            if (++this->m_Generation == 0)
+            {
+                std::fill(this->m_Generations.begin(), this->m_Generations.end(), 0);
+                this->m_Generation = 1;
+            }
+        }
+
+        /**
+         * Returns the packet data.
+         *
+         * @return {const uint8_t*} The packet data.
+         */
+        const uint8_t* GetData(void) const
+        {
+            return this->m_Data;
+        }
+
+        /**
+         * Returns the size of the packet data.
+         *
+         * @return {uint32_t} The size of the packet data.
+         */
+        uint32_t GetSize(void) const
+        {
+            return this->m_Size;
+        }
+
+        /**
+         * Returns the packet id. (Read from the packet header.)
+         *
+         * @return {uint16_t} The packet id.
+         */
+        uint16_t GetId(void) const
+        {
+            return (uint16_t)this->ReadBits(0, 0, 9);
+        }
+
+        /**
+         * Reads a value from the packet data.
+         *
+         * @param {uint32_t} offset - The byte offset to read from.
+         * @return {T} The read value, or a default value if out of range.
+         */
+        template<typename T>
+        T Read(const uint32_t offset) const
+        {
+            T ret{};
+
+            if (this->m_Data != nullptr && offset <= this->m_Size && sizeof(T) <= this->m_Size - offset)
+                std::memcpy(&ret, this->m_Data + offset, sizeof(T));
+
+            return ret;
+        }
+
+        /**
+         * Reads a packed value from the packet data.
+         *
+         * @param {uint32_t} byteOffset - The byte offset to read from.
+         * @param {uint32_t} bitOffset - The bit offset to read from.
+         * @param {uint8_t} len - The number of bits to read. (1 to 64.)
+         * @return {uint64_t} The read value, or 0 if out of range.
+         */
+        uint64_t ReadBits(const uint32_t byteOffset, const uint32_t bitOffset, const uint8_t len) const
+        {
+            const auto pos = ((uint64_t)byteOffset * 8) + bitOffset;
+            if (this->m_Data == nullptr || len == 0 || len > 64 || pos + len > (uint64_t)this->m_Size * 8)
+                return 0;
+
+            return Ashita::BinaryData::UnpackBitsBE(this->m_Data, (uint32_t)pos, len);
+        }
+
+        /**
+         * Reads a string from the packet data.
+         *
+         * @param {uint32_t} offset - The byte offset to read from.
+         * @param {uint32_t} maxLength - The maximum length of the string.
+         * @return {std::string} The read string. (Stops at the first null terminator.)
+         */
+        std::string ReadString(const uint32_t offset, const uint32_t maxLength) const
+        {
+            if (this->m_Data == nullptr || offset >= this->m_Size)
+                return std::string();
+
+            const auto len = std::min(maxLength, this->m_Size - offset);
+            const auto str = (const char*)this->m_Data + offset;
+            const auto end = (const char*)std::memchr(str, '\0', len);
+
+            return std::string(str, end == nullptr ? len : (size_t)(end - str));
+        }
+
+        /**
+         * Returns the value of a root field of the views schema.
+         *
+         * @param {const schemafield_t*} field - The field to read.
+         * @return {uint64_t} The field value, or 0 if unavailable.
+         */
+        uint64_t Get(const schemafield_t* field)
+        {
+            if (this->m_Schema == nullptr || field == nullptr || field->Scope != 0 || field->Type == SchemaFieldType::Array)
+                return 0;
+
+            const auto index = (size_t)(field - this->m_Schema->GetFields().data());
+            if (index >= this->m_Values.size())
+                return 0;
+
+            if (this->m_Generations[index] == this->m_Generation)
+                return this->m_Values[index];
+
+            auto value = (uint64_t)0;
+            if (field->Position != PacketSchema::NoPosition)
+            {
+                if (field->Type == SchemaFieldType::Bytes)
+                    value = field->Position;
+                else
+                {
+                    value = this->ReadBits(0, field->Position, field->Bits);
+                    if (field->Type == SchemaFieldType::Signed && field->Bits < 64 && (value >> (field->Bits - 1)) & 1)
+                        value |= ~Ashita::BinaryData::BitMask(field->Bits);
+                }
+            }
+            else
+            {
+                value = this->GetRoot().Get(field);
+            }
+
+            this->m_Generations[index] = this->m_Generation;
+            this->m_Values[index]      = value;
+
+            return value;
+        }
+
+        /**
+         * Returns the value of a root field of the views schema, by its path.
+         *
+         * @param {const char*} path - The path of the field.
+         * @return {uint64_t} The field value, or 0 if unavailable.
+         */
+        uint64_t Get(const char* path)
+        {
+            return this->m_Schema == nullptr ? 0 : this->Get(this->m_Schema->Find(path));
+        }
+
+        /**
+         * Returns the signed value of a root field of the views schema.
+         *
+         * @param {const schemafield_t*} field - The field to read.
+         * @return {int64_t} The field value, or 0 if unavailable.
+         */
+        int64_t GetSigned(const schemafield_t* field)
+        {
+            return (int64_t)this->Get(field);
+        }
+
+        /**
+         * Returns the float value of a root field of the views schema.
+         *
+         * @param {const schemafield_t*} field - The field to read.
+         * @return {float} The field value, or 0 if unavailable.
+         */
+        float GetFloat(const schemafield_t* field)
+        {
+            const auto raw = (uint32_t)this->Get(field);
+
+            float ret = 0.0f;
+            std::memcpy(&ret, &raw, sizeof(float));
+            return ret;
+        }
+
+        /**
+         * Returns a pointer to the data of a root Bytes field of the views schema.
+         *
+         * @param {const schemafield_t*} field - The field to read.
+         * @param {uint32_t*} size - The size of the field, in bytes.
+         * @return {const uint8_t*} The field data on success, nullptr otherwise.
+         */
+        const uint8_t* GetBytes(const schemafield_t* field, uint32_t* size)
+        {
+            if (field == nullptr || field->Type != SchemaFieldType::Bytes || field->Position == PacketSchema::NoPosition)
+                return this->GetRoot().GetBytes(field, size);
+
+            const auto pos = this->Get(field);
+            if ((pos & 7) != 0 || pos + ((uint64_t)field->Bits * 8) > (uint64_t)this->m_Size * 8)
+                return nullptr;
+
+            if (size != nullptr)
+                *size = field->Bits;
+
+            return this->m_Data + (pos / 8);
+        }
+
+        /**
+         * Returns the root record of the fully decoded packet, decoding it if it has not been already.
+         *
+         * @return {PacketRecord} The root record. (Invalid if the packet could not be decoded.)
+         */
+        PacketRecord GetRoot(void)
+        {
+            if (!this->m_IsDecoded)
+            {
+                this->m_IsDecoded     = true;
+                this->m_IsDecodeValid = this->m_Schema != nullptr && this->m_Schema->Decode(this->m_Data, this->m_Size, &this->m_Decoded);
+            }
+
+            return this->m_IsDecodeValid ? this->m_Decoded.GetRoot() : PacketRecord(nullptr, 0, 0);
+        }
+
+        /**
+         * Returns if the full packet has been decoded.
+         *
+         * @return {bool} True if decoded, false otherwise.
+         */
+        bool GetIsDecoded(void) const
+        {
+            return this->m_IsDecoded;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PACKETVIEW_H_INCLUDED
\ No newline at end of file
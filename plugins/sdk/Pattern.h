@@ -0,0 +1,565 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_PATTERN_H_INCLUDED
+#define ASHITA_SDK_PATTERN_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+#include <vector>
+
+/**
+ * Instruction Set Configurations
+ *
+ * The scanner makes use of SSE2 whenever the target supports it, and will additionally make use of
+ * AVX2 when the running processor (and operating system) supports it. Targets without SSE2 fall back
+ * to the portable scalar scanner.
+ */
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#define ASHITA_PATTERN_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#define ASHITA_PATTERN_USE_AVX2 1
+#define ASHITA_PATTERN_AVX2_TARGET
+#include <immintrin.h>
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define ASHITA_PATTERN_USE_AVX2 1
+#define ASHITA_PATTERN_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+namespace Ashita
+{
+    /**
+     * Compiled Pattern Object
+     *
+     * Holds a pre-parsed pattern that can be scanned for repeatedly without needing to re-parse the
+     * pattern string. Wildcard bytes are stored with a mask of 0x00 and a byte value of 0x00.
+     */
+    struct compiledpattern_t
+    {
+        std::vector<uint8_t> Bytes; // The patterns byte values. (Pre-masked.)
+        std::vector<uint8_t> Masks; // The patterns byte masks. (0xFF = Must match, 0x00 = Wildcard.)
+        uint32_t Anchor;            // The index of the anchor byte used to locate candidate matches.
+        intptr_t Offset;            // The offset to add to the result if the pattern is found.
+        uintptr_t Count;            // The result count to use if the pattern is known to be found more than once.
+
+        compiledpattern_t(void)
+            : Anchor(0)
+            , Offset(0)
+            , Count(0)
+        {}
+
+        /**
+         * Returns if the pattern was compiled successfully.
+         *
+         * @return {bool} True if valid, false otherwise.
+         */
+        bool IsValid(void) const
+        {
+            return this->Bytes.size() > 0 && this->Bytes.size() == this->Masks.size();
+        }
+
+        /**
+         * Returns if the pattern contains at least one non-wildcard byte.
+         *
+         * @return {bool} True if anchored, false otherwise.
+         */
+        bool IsAnchored(void) const
+        {
+            return this->IsValid() && this->Masks[this->Anchor] != 0;
+        }
+    };
+
+    class PatternScanner
+    {
+    public:
+        /**
+         * Returns the rarity score of the given byte value. (Higher is rarer.)
+         *
+         * The scores are based on the general byte frequency of compiled 32bit x86 code sections. Common
+         * opcodes, ModR/M bytes and immediates are given a low score so they are avoided as anchors.
+         *
+         * @param {uint8_t} b - The byte to score.
+         * @return {uint32_t} The rarity score of the byte.
+         */
+        static uint32_t GetByteRarity(const uint8_t b)
+        {
+            // Most frequent bytes, ordered from most to least common..
+            static constexpr uint8_t common[] = {
+                0x00, 0xFF, 0x8B, 0x24, 0x44, 0x89, 0x01, 0xE8, 0x04, 0x83, 0x08, 0x10, 0x0F, 0x85, 0xC0, 0x74,
+                0x4C, 0x02, 0x50, 0x75, 0x8D, 0x56, 0x0C, 0x4D, 0x45, 0x6A, 0xCC, 0x33, 0x57, 0xC4, 0x14, 0x03,
+                0x18, 0x46, 0x20, 0x5E, 0xC3, 0x53, 0x55, 0x51, 0x5F, 0x90, 0x84, 0x80, 0x7C, 0x8A, 0xB8, 0x40,
+                0x1C, 0x0D, 0xE9, 0x06, 0x5D, 0x5B, 0x48, 0x4E, 0x0E, 0xEB, 0x3B, 0x47, 0xC7, 0xF6, 0xD8, 0x30,
+            };
+
+            for (uint32_t x = 0; x < sizeof(common); x++)
+            {
+                if (common[x] == b)
+                    return x;
+            }
+
+            return sizeof(common);
+        }
+
+        /**
+         * Compiles the given pattern string.
+         *
+         * @param {const char*} pattern - The pattern to compile. (?? as wildcard bytes.)
+         * @param {intptr_t} offset - The offset to add to the result if the pattern is found.
+         * @param {uintptr_t} count - The result count to use if the pattern is known to be found more than once.
+         * @param {compiledpattern_t*} out - The compiled pattern output.
+         * @return {bool} True on success, false otherwise.
+         */
+        static bool Compile(const char* pattern, const intptr_t offset, const uintptr_t count, compiledpattern_t* out)
+        {
+            if (pattern == nullptr || out == nullptr)
+                return false;
+
+            out->Bytes.clear();
+            out->Masks.clear();
+            out->Anchor = 0;
+            out->Offset = offset;
+            out->Count  = count;
+
+            // Validate the incoming pattern is properly aligned..
+            const auto len = strlen(pattern);
+            if (len == 0 || len % 2 > 0)
+                return false;
+
+            out->Bytes.reserve(len / 2);
+            out->Masks.reserve(len / 2);
+
+            for (size_t x = 0; x < len; x += 2)
+            {
+                // Handle wildcard bytes..
+                if (pattern[x] == '?' && pattern[x + 1] == '?')
+                {
+                    out->Bytes.push_back(0x00);
+                    out->Masks.push_back(0x00);
+                    continue;
+                }
+
+                const auto hi = PatternScanner::HexToNibble(pattern[x]);
+                const auto lo = PatternScanner::HexToNibble(pattern[x + 1]);
+                out->Bytes.push_back((uint8_t)((hi << 4) | lo));
+                out->Masks.push_back(0xFF);
+            }
+
+            // Select the rarest non-wildcard byte as the anchor..
+            auto rarity = (uint32_t)0;
+            for (uint32_t x = 0; x < (uint32_t)out->Masks.size(); x++)
+            {
+                if (out->Masks[x] == 0)
+                    continue;
+
+                const auto r = PatternScanner::GetByteRarity(out->Bytes[x]);
+                if (out->Masks[out->Anchor] == 0 || r > rarity)
+                {
+                    out->Anchor = x;
+                    rarity      = r;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Finds the given compiled pattern within the given address space.
+         *
+         * @param {uintptr_t} baseAddress - The address to start searching for the pattern within.
+         * @param {uintptr_t} size - The size of data to search within. (Starting from baseAddress.)
+         * @param {compiledpattern_t&} pattern - The compiled pattern to search for.
+         * @return {uintptr_t} The address where the pattern was found on success, 0 otherwise.
+         */
+        static uintptr_t Scan(const uintptr_t baseAddress, const uintptr_t size, const compiledpattern_t& pattern)
+        {
+            auto result = (uintptr_t)0;
+            PatternScanner::ScanBatch(baseAddress, size, &pattern, 1, &result);
+            return result;
+        }
+
+        /**
+         * Finds the given compiled patterns within the given address space, in a single pass.
+         *
+         * @param {uintptr_t} baseAddress - The address to start searching for the patterns within.
+         * @param {uintptr_t} size - The size of data to search within. (Starting from baseAddress.)
+         * @param {compiledpattern_t*} patterns - The compiled patterns to search for.
+         * @param {size_t} count - The number of patterns to search for.
+         * @param {uintptr_t*} results - The output results. (One per pattern. 0 if the pattern was not found.)
+         * @param {double*} times - Optional output times, in milliseconds, from the start of the scan until each pattern was resolved. (One per pattern.)
+         * @return {size_t} The number of patterns that were found.
+         *
+         * @notes
+         *
+         *      Patterns are grouped by their anchor byte so each distinct anchor is compared against the data
+         *      once per block, regardless of how many patterns share it. Candidates are then verified against
+         *      the full pattern. Each pattern honors its own Count value, with matches counted in address order.
+         *
+         *      Patterns that are not found are given the time of the full scan.
+         */
+        static size_t ScanBatch(const uintptr_t baseAddress, const uintptr_t size, const compiledpattern_t* patterns, const size_t count, uintptr_t* results, double* times = nullptr)
+        {
+            if (patterns == nullptr || results == nullptr || count == 0)
+                return 0;
+
+            for (size_t x = 0; x < count; x++)
+            {
+                results[x] = 0;
+                if (times != nullptr)
+                    times[x] = 0.0;
+            }
+
+            // Validate the base address and size parameters..
+            if (baseAddress == 0 || size == 0)
+                return 0;
+
+            scanstate_t state(patterns, count, results, times);
+            const auto data = (const uint8_t*)baseAddress;
+
+            // Prepare the anchor groups; patterns without an anchor are resolved directly..
+            for (size_t x = 0; x < count; x++)
+            {
+                const auto& p = patterns[x];
+                if (!p.IsValid() || p.Bytes.size() > size)
+                    continue;
+
+                if (!p.IsAnchored())
+                {
+                    if (p.Count + p.Bytes.size() <= size)
+                    {
+                        results[x] = baseAddress + p.Count + p.Offset;
+                        state.Found++;
+                    }
+                    continue;
+                }
+
+                state.AddToGroup(p.Bytes[p.Anchor], x);
+            }
+
+            if (state.Groups.size() == 0)
+                return state.Found;
+
+            auto pos = (uintptr_t)0;
+
+#if defined(ASHITA_PATTERN_USE_AVX2)
+            if (PatternScanner::HasAvx2())
+                pos = PatternScanner::ScanAvx2(data, size, pos, state);
+#endif
+#if defined(ASHITA_PATTERN_USE_SSE2)
+            pos = PatternScanner::ScanSse2(data, size, pos, state);
+#endif
+
+            // Scan the remaining data..
+            for (; pos < size && state.Active > 0; pos++)
+            {
+                for (auto& g : state.Groups)
+                {
+                    if (g.Active > 0 && data[pos] == g.Byte)
+                        PatternScanner::TestCandidate(data, baseAddress, size, pos, g, state);
+                }
+            }
+
+            // Give the unresolved patterns the time of the full scan..
+            if (times != nullptr && state.Active > 0)
+            {
+                const auto elapsed = state.GetElapsed();
+                for (size_t x = 0; x < count; x++)
+                {
+                    if (!state.Resolved[x])
+                        times[x] = elapsed;
+                }
+            }
+
+            return state.Found;
+        }
+
+    private:
+        /**
+         * Anchor Group Object
+         *
+         * Holds the patterns that share the same anchor byte.
+         */
+        struct anchorgroup_t
+        {
+            uint8_t Byte;                 // The anchor byte value.
+            size_t Active;                // The number of unresolved patterns within the group.
+            std::vector<size_t> Patterns; // The indexes of the patterns within the group.
+        };
+
+        /**
+         * Scan State Object
+         *
+         * Holds the working state of a batch scan.
+         */
+        struct scanstate_t
+        {
+            const compiledpattern_t* Patterns;
+            uintptr_t* Results;
+            double* Times;
+            std::vector<uintptr_t> Matches;
+            std::vector<bool> Resolved;
+            std::vector<anchorgroup_t> Groups;
+            size_t Active;
+            size_t Found;
+            std::chrono::steady_clock::time_point Start;
+
+            scanstate_t(const compiledpattern_t* patterns, const size_t count, uintptr_t* results, double* times)
+                : Patterns(patterns)
+                , Results(results)
+                , Times(times)
+                , Matches(count, 0)
+                , Resolved(count, false)
+                , Active(0)
+                , Found(0)
+                , Start(std::chrono::steady_clock::now())
+            {}
+
+            double GetElapsed(void) const
+            {
+                return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - this->Start).count();
+            }
+
+            void AddToGroup(const uint8_t b, const size_t index)
+            {
+                this->Active++;
+
+                for (auto& g : this->Groups)
+                {
+                    if (g.Byte == b)
+                    {
+                        g.Patterns.push_back(index);
+                        g.Active++;
+                        return;
+                    }
+                }
+
+                this->Groups.push_back({b, 1, {index}});
+            }
+        };
+
+        /**
+         * Converts a hexadecimal character to its nibble value.
+         *
+         * @param {char} c - The character to convert.
+         * @return {uint8_t} The nibble value, 0 if invalid.
+         */
+        static uint8_t HexToNibble(const char c)
+        {
+            if (c >= '0' && c <= '9')
+                return (uint8_t)(c - '0');
+            if (c >= 'a' && c <= 'f')
+                return (uint8_t)(c - 'a' + 10);
+            if (c >= 'A' && c <= 'F')
+                return (uint8_t)(c - 'A' + 10);
+            return 0;
+        }
+
+        /**
+         * Returns the index of the lowest set bit of the given mask.
+         *
+         * @param {uint32_t} mask - The mask to check. (Must not be 0.)
+         * @return {uint32_t} The index of the lowest set bit.
+         */
+        static uint32_t LowestBit(const uint32_t mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long index = 0;
+            ::_BitScanForward(&index, mask);
+            return (uint32_t)index;
+#else
+            return (uint32_t)__builtin_ctz(mask);
+#endif
+        }
+
+        /**
+         * Verifies a candidate position for each unresolved pattern in the given anchor group.
+         *
+         * @param {uint8_t*} data - The data being scanned.
+         * @param {uintptr_t} baseAddress - The base address of the data being scanned.
+         * @param {uintptr_t} size - The size of the data being scanned.
+         * @param {uintptr_t} pos - The position where the anchor byte was found.
+         * @param {anchorgroup_t&} group - The anchor group that matched.
+         * @param {scanstate_t&} state - The current scan state.
+         */
+        static void TestCandidate(const uint8_t* data, const uintptr_t baseAddress, const uintptr_t size, const uintptr_t pos, anchorgroup_t& group, scanstate_t& state)
+        {
+            for (const auto index : group.Patterns)
+            {
+                if (state.Resolved[index])
+                    continue;
+
+                const auto& p = state.Patterns[index];
+                if (pos < p.Anchor)
+                    continue;
+
+                const auto start = pos - p.Anchor;
+                const auto len   = p.Bytes.size();
+                if (start + len > size)
+                    continue;
+
+                // Verify the full pattern against the data..
+                auto matched = true;
+                for (size_t x = 0; x < len; x++)
+                {
+                    if ((data[start + x] & p.Masks[x]) != p.Bytes[x])
+                    {
+                        matched = false;
+                        break;
+                    }
+                }
+
+                if (!matched)
+                    continue;
+
+                // Use the current result if no increased count expected..
+                if (state.Matches[index]++ == p.Count)
+                {
+                    state.Results[index]  = baseAddress + start + p.Offset;
+                    state.Resolved[index] = true;
+                    if (state.Times != nullptr)
+                        state.Times[index] = state.GetElapsed();
+                    state.Found++;
+                    state.Active--;
+                    group.Active--;
+                }
+            }
+        }
+
+#if defined(ASHITA_PATTERN_USE_SSE2)
+        /**
+         * Scans the given data for candidates, 16 bytes at a time. (SSE2)
+         *
+         * @param {uint8_t*} data - The data to scan.
+         * @param {uintptr_t} size - The size of the data to scan.
+         * @param {uintptr_t} start - The position to start scanning from.
+         * @param {scanstate_t&} state - The current scan state.
+         * @return {uintptr_t} The position where the scan stopped.
+         */
+        static uintptr_t ScanSse2(const uint8_t* data, const uintptr_t size, const uintptr_t start, scanstate_t& state)
+        {
+            auto pos = start;
+            if (size < 16 || state.Active == 0)
+                return pos;
+
+            for (; pos <= size - 16 && state.Active > 0; pos += 16)
+            {
+                const auto block = _mm_loadu_si128((const __m128i*)(data + pos));
+
+                for (auto& g : state.Groups)
+                {
+                    if (g.Active == 0)
+                        continue;
+
+                    auto mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8((char)g.Byte)));
+                    while (mask != 0 && g.Active > 0)
+                    {
+                        PatternScanner::TestCandidate(data, (uintptr_t)data, size, pos + PatternScanner::LowestBit(mask), g, state);
+                        mask &= mask - 1;
+                    }
+                }
+            }
+
+            return pos;
+        }
+#endif
+
+#if defined(ASHITA_PATTERN_USE_AVX2)
+        /**
+         * Returns if the current processor and operating system support AVX2.
+         *
+         * @return {bool} True if supported, false otherwise.
+         */
+        static bool HasAvx2(void)
+        {
+            static const auto supported = []() -> bool {
+#if defined(_MSC_VER)
+                int32_t info[4]{};
+                ::__cpuid(info, 0);
+                if (info[0] < 7)
+                    return false;
+
+                // Check for OSXSAVE and AVX support, then ensure the OS saves the YMM state..
+                ::__cpuid(info, 1);
+                if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+                    return false;
+                if ((::_xgetbv(0) & 0x06) != 0x06)
+                    return false;
+
+                ::__cpuidex(info, 7, 0);
+                return (info[1] & (1 << 5)) != 0;
+#else
+                return __builtin_cpu_supports("avx2") != 0;
+#endif
+            }();
+
+            return supported;
+        }
+
+        /**
+         * Scans the given data for candidates, 32 bytes at a time. (AVX2)
+         *
+         * @param {uint8_t*} data - The data to scan.
+         * @param {uintptr_t} size - The size of the data to scan.
+         * @param {uintptr_t} start - The position to start scanning from.
+         * @param {scanstate_t&} state - The current scan state.
+         * @return {uintptr_t} The position where the scan stopped.
+         */
+        ASHITA_PATTERN_AVX2_TARGET static uintptr_t ScanAvx2(const uint8_t* data, const uintptr_t size, const uintptr_t start, scanstate_t& state)
+        {
+            auto pos = start;
+            if (size < 32 || state.Active == 0)
+                return pos;
+
+            for (; pos <= size - 32 && state.Active > 0; pos += 32)
+            {
+                const auto block = _mm256_loadu_si256((const __m256i*)(data + pos));
+
+                for (auto& g : state.Groups)
+                {
+                    if (g.Active == 0)
+                        continue;
+
+                    auto mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8((char)g.Byte)));
+                    while (mask != 0 && g.Active > 0)
+                    {
+                        PatternScanner::TestCandidate(data, (uintptr_t)data, size, pos + PatternScanner::LowestBit(mask), g, state);
+                        mask &= mask - 1;
+                    }
+                }
+            }
+
+            return pos;
+        }
+#endif
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PATTERN_H_INCLUDED
\ No newline at end of file
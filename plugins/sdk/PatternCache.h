@@ -0,0 +1,456 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_PATTERNCACHE_H_INCLUDED
+#define ASHITA_SDK_PATTERNCACHE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cinttypes>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "AtomicFile.h"
+#include "Pattern.h"
+
+namespace Ashita
+{
+    /**
+     * Module Identity Object
+     *
+     * Describes a specific build of a module. Cached pattern results are only reused while the
+     * identity of the module matches the identity the results were cached with.
+     */
+    struct moduleidentity_t
+    {
+        uint64_t FileSize;  // The modules file size.
+        uint64_t Timestamp; // The modules file timestamp.
+        uint64_t Hash;      // The modules content hash. (See: PatternCache::Hash)
+
+        bool operator==(const moduleidentity_t& rhs) const
+        {
+            return this->FileSize == rhs.FileSize && this->Timestamp == rhs.Timestamp && this->Hash == rhs.Hash;
+        }
+        bool operator!=(const moduleidentity_t& rhs) const
+        {
+            return !(*this == rhs);
+        }
+    };
+
+    /**
+     * Implements a persistent cache of resolved pattern results.
+     *
+     * Results are stored per-module as the relative address of the pattern match. Cached results are
+     * verified before use by re-checking the pattern bytes at the cached address, (and, for patterns with a
+     * Count, that the address is still the Count-th match,) falling back to a full scan if they no longer match.
+     */
+    class PatternCache
+    {
+        /**
+         * Cached Module Object
+         */
+        struct cachedmodule_t
+        {
+            moduleidentity_t Identity;
+            std::map<std::string, uint64_t> Entries; // Pattern key -> match relative address.
+        };
+
+        static constexpr uint32_t CacheMagic   = 0x31435041; // 'APC1'
+        static constexpr uint32_t CacheVersion = 1;
+
+        std::map<std::string, cachedmodule_t> m_Modules;
+        mutable std::mutex m_Mutex;
+        bool m_IsDirty;
+
+    public:
+        PatternCache(void)
+            : m_IsDirty(false)
+        {}
+        ~PatternCache(void)
+        {}
+
+        /**
+         * Computes the FNV-1a hash of the given data.
+         *
+         * @param {void*} data - The data to hash.
+         * @param {size_t} size - The size of the data to hash.
+         * @param {uint64_t} hash - The initial hash value. (Allows hashing multiple blocks.)
+         * @return {uint64_t} The hash value.
+         */
+        static uint64_t Hash(const void* data, const size_t size, uint64_t hash = 0xCBF29CE484222325ull)
+        {
+            const auto bytes = (const uint8_t*)data;
+            for (size_t x = 0; x < size; x++)
+            {
+                hash ^= bytes[x];
+                hash *= 0x00000100000001B3ull;
+            }
+            return hash;
+        }
+
+        /**
+         * Loads the cache from the given file.
+         *
+         * @param {const char*} path - The path to the cache file.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Load(const char* path)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            this->m_Modules.clear();
+            this->m_IsDirty = false;
+
+            std::ifstream f(path, std::ios::binary);
+            if (!f.is_open())
+                return false;
+
+            // Validate the cache header..
+            uint32_t magic = 0, version = 0, modules = 0;
+            if (!PatternCache::ReadValue(f, &magic) || !PatternCache::ReadValue(f, &version) || !PatternCache::ReadValue(f, &modules))
+                return false;
+            if (magic != CacheMagic || version != CacheVersion)
+                return false;
+
+            for (uint32_t x = 0; x < modules; x++)
+            {
+                std::string name;
+                cachedmodule_t mod{};
+                uint32_t entries = 0;
+
+                if (!PatternCache::ReadString(f, &name) ||
+                    !PatternCache::ReadValue(f, &mod.Identity.FileSize) ||
+                    !PatternCache::ReadValue(f, &mod.Identity.Timestamp) ||
+                    !PatternCache::ReadValue(f, &mod.Identity.Hash) ||
+                    !PatternCache::ReadValue(f, &entries))
+                {
+                    this->m_Modules.clear();
+                    return false;
+                }
+
+                for (uint32_t y = 0; y < entries; y++)
+                {
+                    std::string key;
+                    uint64_t rva = 0;
+
+                    if (!PatternCache::ReadString(f, &key) || !PatternCache::ReadValue(f, &rva))
+                    {
+                        this->m_Modules.clear();
+                        return false;
+                    }
+
+                    mod.Entries[key] = rva;
+                }
+
+                this->m_Modules[name] = std::move(mod);
+            }
+
+            return true;
+        }
+
+        /**
+         * Saves the cache to the given file.
+         *
+         * @param {const char*} path - The path to the cache file.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Save(const char* path)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            // Write to a temporary file that replaces the cache once complete..
+            AtomicFileWriter file(path);
+            if (!file.IsOpen())
+                return false;
+
+            auto& f = file.GetStream();
+
+            PatternCache::WriteValue(f, CacheMagic);
+            PatternCache::WriteValue(f, CacheVersion);
+            PatternCache::WriteValue(f, (uint32_t)this->m_Modules.size());
+
+            for (const auto& [name, mod] : this->m_Modules)
+            {
+                PatternCache::WriteString(f, name);
+                PatternCache::WriteValue(f, mod.Identity.FileSize);
+                PatternCache::WriteValue(f, mod.Identity.Timestamp);
+                PatternCache::WriteValue(f, mod.Identity.Hash);
+                PatternCache::WriteValue(f, (uint32_t)mod.Entries.size());
+
+                for (const auto& [key, rva] : mod.Entries)
+                {
+                    PatternCache::WriteString(f, key);
+                    PatternCache::WriteValue(f, rva);
+                }
+            }
+
+            if (!file.Commit())
+                return false;
+
+            this->m_IsDirty = false;
+            return true;
+        }
+
+        /**
+         * Returns if the cache has been modified since it was last loaded or saved.
+         *
+         * @return {bool} True if modified, false otherwise.
+         */
+        bool GetIsDirty(void) const
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            return this->m_IsDirty;
+        }
+
+        /**
+         * Sets the current identity of the given module. Cached entries for the module are discarded if the
+         * identity does not match the identity they were cached with.
+         *
+         * @param {const char*} moduleName - The name of the module.
+         * @param {moduleidentity_t&} identity - The current identity of the module.
+         */
+        void SetModuleIdentity(const char* moduleName, const moduleidentity_t& identity)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            auto& mod = this->m_Modules[PatternCache::NormalizeName(moduleName)];
+            if (mod.Identity != identity)
+            {
+                mod.Identity = identity;
+                mod.Entries.clear();
+                this->m_IsDirty = true;
+            }
+        }
+
+        /**
+         * Looks up and verifies a cached pattern result.
+         *
+         * @param {const char*} moduleName - The name of the module the pattern was scanned within.
+         * @param {uintptr_t} baseAddress - The base address of the module.
+         * @param {uintptr_t} size - The size of the module.
+         * @param {const char*} pattern - The pattern string.
+         * @param {compiledpattern_t&} cpattern - The compiled pattern.
+         * @param {uintptr_t*} result - The cached result, if found and verified.
+         * @return {bool} True if a verified result was found, false otherwise.
+         */
+        bool Lookup(const char* moduleName, const uintptr_t baseAddress, const uintptr_t size, const char* pattern, const compiledpattern_t& cpattern, uintptr_t* result) const
+        {
+            if (baseAddress == 0 || size == 0 || result == nullptr || !cpattern.IsValid())
+                return false;
+
+            uint64_t rva = 0;
+            {
+                std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+                const auto mod = this->m_Modules.find(PatternCache::NormalizeName(moduleName));
+                if (mod == this->m_Modules.end())
+                    return false;
+
+                const auto entry = mod->second.Entries.find(PatternCache::MakeKey(pattern, cpattern.Offset, cpattern.Count));
+                if (entry == mod->second.Entries.end())
+                    return false;
+
+                rva = entry->second;
+            }
+
+            // Verify the pattern bytes at the cached address..
+            if (!PatternCache::Verify(baseAddress, size, rva, cpattern))
+                return false;
+
+            *result = baseAddress + (uintptr_t)rva + cpattern.Offset;
+            return true;
+        }
+
+        /**
+         * Stores a pattern result in the cache.
+         *
+         * @param {const char*} moduleName - The name of the module the pattern was scanned within.
+         * @param {uintptr_t} baseAddress - The base address of the module.
+         * @param {const char*} pattern - The pattern string.
+         * @param {compiledpattern_t&} cpattern - The compiled pattern.
+         * @param {uintptr_t} result - The result of the pattern scan. (Including the pattern offset.)
+         *
+         * @notes
+         *
+         *      A result of 0 (pattern not found) removes any cached entry of the pattern, so a stale entry is
+         *      not trusted again on the next load.
+         */
+        void Store(const char* moduleName, const uintptr_t baseAddress, const char* pattern, const compiledpattern_t& cpattern, const uintptr_t result)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            if (result == 0)
+            {
+                const auto mod = this->m_Modules.find(PatternCache::NormalizeName(moduleName));
+                if (mod != this->m_Modules.end() && mod->second.Entries.erase(PatternCache::MakeKey(pattern, cpattern.Offset, cpattern.Count)) > 0)
+                    this->m_IsDirty = true;
+                return;
+            }
+
+            const auto rva = (uint64_t)(result - cpattern.Offset - baseAddress);
+            auto& entry    = this->m_Modules[PatternCache::NormalizeName(moduleName)].Entries[PatternCache::MakeKey(pattern, cpattern.Offset, cpattern.Count)];
+            if (entry != rva)
+            {
+                entry           = rva;
+                this->m_IsDirty = true;
+            }
+        }
+
+        /**
+         * Resolves a pattern, using the cached result if it is still valid, otherwise scanning for it.
+         *
+         * @param {const char*} moduleName - The name of the module being scanned.
+         * @param {uintptr_t} baseAddress - The base address of the module.
+         * @param {uintptr_t} size - The size of the module.
+         * @param {const char*} pattern - The pattern to search for.
+         * @param {intptr_t} offset - The offset to add to the result if the pattern is found.
+         * @param {uintptr_t} count - The result count to use if the pattern is known to be found more than once.
+         * @param {bool*} cached - Optional output flag set to true if the result came from the cache.
+         * @return {uintptr_t} The address where the pattern was found on success, 0 otherwise.
+         */
+        uintptr_t Resolve(const char* moduleName, const uintptr_t baseAddress, const uintptr_t size, const char* pattern, const intptr_t offset, const uintptr_t count, bool* cached = nullptr)
+        {
+            if (cached != nullptr)
+                *cached = false;
+
+            compiledpattern_t cpattern;
+            if (!Ashita::PatternScanner::Compile(pattern, offset, count, &cpattern))
+                return 0;
+
+            // Use the cached result if it is still valid..
+            auto result = (uintptr_t)0;
+            if (this->Lookup(moduleName, baseAddress, size, pattern, cpattern, &result))
+            {
+                if (cached != nullptr)
+                    *cached = true;
+                return result;
+            }
+
+            // Fall back to a full scan..
+            result = Ashita::PatternScanner::Scan(baseAddress, size, cpattern);
+            this->Store(moduleName, baseAddress, pattern, cpattern, result);
+
+            return result;
+        }
+
+        /**
+         * Verifies the given compiled pattern matches the data at the given relative address.
+         *
+         * @param {uintptr_t} baseAddress - The base address of the module.
+         * @param {uintptr_t} size - The size of the module.
+         * @param {uint64_t} rva - The relative address of the pattern match.
+         * @param {compiledpattern_t&} cpattern - The compiled pattern.
+         * @return {bool} True if the pattern matches, false otherwise.
+         *
+         * @notes
+         *
+         *      Patterns with a Count must also still be the Count-th match of the module. The data before the
+         *      cached address is rescanned to confirm it, as a match added before the cached address would make
+         *      the cached address a later match.
+         */
+        static bool Verify(const uintptr_t baseAddress, const uintptr_t size, const uint64_t rva, const compiledpattern_t& cpattern)
+        {
+            const auto len = cpattern.Bytes.size();
+            if (len == 0 || len > size || rva > (uint64_t)(size - len))
+                return false;
+
+            const auto data = (const uint8_t*)(baseAddress + (uintptr_t)rva);
+            for (size_t x = 0; x < len; x++)
+            {
+                if ((data[x] & cpattern.Masks[x]) != cpattern.Bytes[x])
+                    return false;
+            }
+
+            if (cpattern.Count == 0)
+                return true;
+
+            // Confirm the match is still the Count-th match..
+            return Ashita::PatternScanner::Scan(baseAddress, (uintptr_t)rva + len, cpattern) == baseAddress + (uintptr_t)rva + cpattern.Offset;
+        }
+
+    private:
+        /**
+         * Returns the normalized (lowercase) form of the given module name.
+         *
+         * @param {const char*} moduleName - The module name.
+         * @return {std::string} The normalized module name.
+         */
+        static std::string NormalizeName(const char* moduleName)
+        {
+            std::string name(moduleName == nullptr ? "" : moduleName);
+            for (auto& c : name)
+            {
+                if (c >= 'A' && c <= 'Z')
+                    c = (char)(c - 'A' + 'a');
+            }
+            return name;
+        }
+
+        /**
+         * Returns the cache key of the given pattern information.
+         *
+         * @param {const char*} pattern - The pattern string.
+         * @param {intptr_t} offset - The pattern offset.
+         * @param {uintptr_t} count - The pattern count.
+         * @return {std::string} The cache key.
+         */
+        static std::string MakeKey(const char* pattern, const intptr_t offset, const uintptr_t count)
+        {
+            return std::string(pattern == nullptr ? "" : pattern) + "|" + std::to_string((int64_t)offset) + "|" + std::to_string((uint64_t)count);
+        }
+
+        template<typename T>
+        static bool ReadValue(std::ifstream& f, T* value)
+        {
+            return (bool)f.read((char*)value, sizeof(T));
+        }
+
+        static bool ReadString(std::ifstream& f, std::string* str)
+        {
+            uint16_t len = 0;
+            if (!PatternCache::ReadValue(f, &len))
+                return false;
+
+            str->resize(len);
+            return len == 0 || (bool)f.read(str->data(), len);
+        }
+
+        template<typename T>
+        static void WriteValue(std::ofstream& f, const T value)
+        {
+            f.write((const char*)&value, sizeof(T));
+        }
+
+        static void WriteString(std::ofstream& f, const std::string& str)
+        {
+            const auto len = (uint16_t)(str.size() > 0xFFFF ? 0xFFFF : str.size());
+            PatternCache::WriteValue(f, len);
+            f.write(str.data(), len);
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PATTERNCACHE_H_INCLUDED
\ No newline at end of file
@@ -0,0 +1,431 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_PATTERNRESOLVER_H_INCLUDED
+#define ASHITA_SDK_PATTERNRESOLVER_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cinttypes>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Pattern.h"
+#include "PatternCache.h"
+#include "Threading.h"
+
+namespace Ashita
+{
+    /**
+     * Pattern Entry Object
+     *
+     * Describes a single pattern to be resolved. Mirrors the entry format used by the pointer configuration
+     * files. (ie. ashita.pointers.ini)
+     */
+    struct patternentry_t
+    {
+        std::string Name;    // The unique name of the entry.
+        std::string Modules; // The module(s) the pattern is found within. (Comma or semi-colon separated, in order of preference.)
+        std::string Pattern; // The pattern to scan for. (?? as wildcard bytes.)
+        intptr_t Offset;     // The offset from the start of the pattern used for the result.
+        uintptr_t Count;     // The appearance count for patterns that are found multiple times.
+    };
+
+    /**
+     * Pattern Result Object
+     *
+     * Holds the result of a resolved pattern entry.
+     */
+    struct patternresult_t
+    {
+        uintptr_t Address;  // The resolved address. (0 if not found.)
+        std::string Module; // The module the pattern was found within.
+        bool Cached;        // Flag set if the result was taken from the pattern cache.
+        double Duration;    // The time, in milliseconds, taken to resolve (or fail to resolve) the entry. (See: PatternResolver::Resolve)
+
+        patternresult_t(void)
+            : Address(0)
+            , Cached(false)
+            , Duration(0.0)
+        {}
+    };
+
+    /**
+     * Module lookup callback used to obtain the base address and size of a module by its name.
+     */
+    typedef std::function<bool(const char* moduleName, uintptr_t* baseAddress, uintptr_t* size)> modulelookup_f;
+
+    class PatternResolver
+    {
+        /**
+         * Scan Job Object
+         *
+         * Holds a group of entries to be scanned for within a range of a single module.
+         */
+        struct scanjob_t
+        {
+            std::string Module;
+            uintptr_t BaseAddress;          // The base address of the module.
+            uintptr_t Size;                 // The size of the module.
+            uintptr_t Start;                // The offset of the range within the module.
+            uintptr_t Length;               // The length of the range. (Including the overlap into the next range.)
+            std::vector<size_t> Entries;    // The entry indexes to scan for.
+            std::vector<uintptr_t> Found;   // The scan result of each entry.
+            std::vector<double> Times;      // The scan time of each entry.
+        };
+
+        static constexpr uintptr_t MinRangeSize = 256 * 1024; // The minimum size of a module range scanned by a single job.
+
+    public:
+        /**
+         * Splits the given module list into its individual module names.
+         *
+         * @param {std::string&} modules - The module list. (Comma or semi-colon separated.)
+         * @return {std::vector} The module names.
+         */
+        static std::vector<std::string> SplitModules(const std::string& modules)
+        {
+            std::vector<std::string> names;
+            std::string curr;
+
+            for (const auto c : modules)
+            {
+                if (c == ',' || c == ';')
+                {
+                    if (curr.size() > 0)
+                        names.push_back(curr);
+                    curr.clear();
+                    continue;
+                }
+                if (c != ' ' && c != '\t')
+                    curr.push_back(c);
+            }
+
+            if (curr.size() > 0)
+                names.push_back(curr);
+
+            return names;
+        }
+
+        /**
+         * Resolves the given pattern entries, scanning each module concurrently.
+         *
+         * @param {std::vector&} entries - The entries to resolve.
+         * @param {modulelookup_f&} lookup - The callback used to obtain module information.
+         * @param {Threading::TaskPool*} pool - The task pool to scan with. (nullptr to scan on the calling thread.)
+         * @param {PatternCache*} cache - The optional pattern cache to consult and update.
+         * @return {std::vector} The results of each entry, in the same order as the given entries.
+         *
+         * @notes
+         *
+         *      Entries are resolved in rounds. Each round attempts the next module within each unresolved
+         *      entries module list, allowing fallback chains (ie. polcore.dll;polcoreeu.dll) to behave the same
+         *      as a serial scan. Within a round, entries are partitioned by module and each module is split into
+         *      address ranges, one job per pool thread, so the module is walked once in total. An entry takes
+         *      the match of the lowest range it was found in. Entries with a Count are scanned over the full
+         *      module by a single job, as their matches must be counted in order.
+         *
+         *      Each entries result only depends on the entry itself and the module contents, so the results are
+         *      deterministic regardless of the thread count or the order the jobs complete in.
+         *
+         *      The Duration of a cached entry is the time taken to verify it. The Duration of a scanned entry is
+         *      the time its job took to locate it, or the time of the longest job of its module if not found.
+         *      Entries that fall back to later modules accumulate the time of every round they took part in.
+         */
+        static std::vector<patternresult_t> Resolve(const std::vector<patternentry_t>& entries, const modulelookup_f& lookup, Threading::TaskPool* pool, PatternCache* cache = nullptr)
+        {
+            std::vector<patternresult_t> results(entries.size());
+            std::vector<compiledpattern_t> patterns(entries.size());
+            std::vector<std::vector<std::string>> chains(entries.size());
+            std::vector<bool> resolved(entries.size(), false);
+
+            const auto rangeCount = pool == nullptr ? 1 : pool->GetThreadCount();
+
+            // Compile the entries..
+            size_t rounds = 0;
+            for (size_t x = 0; x < entries.size(); x++)
+            {
+                if (!Ashita::PatternScanner::Compile(entries[x].Pattern.c_str(), entries[x].Offset, entries[x].Count, &patterns[x]))
+                {
+                    resolved[x] = true;
+                    continue;
+                }
+
+                chains[x] = PatternResolver::SplitModules(entries[x].Modules);
+                rounds    = std::max(rounds, chains[x].size());
+            }
+
+            for (size_t round = 0; round < rounds; round++)
+            {
+                // Partition the unresolved entries by module, in order of appearance..
+                std::vector<scanjob_t> modules;
+                for (size_t x = 0; x < entries.size(); x++)
+                {
+                    if (resolved[x] || chains[x].size() <= round)
+                        continue;
+
+                    const auto& name = chains[x][round];
+                    auto iter        = std::find_if(modules.begin(), modules.end(), [&name](const scanjob_t& j) {
+                        return PatternResolver::EqualsNoCase(j.Module, name);
+                    });
+
+                    if (iter == modules.end())
+                    {
+                        modules.push_back({name, 0, 0, 0, 0, {}, {}, {}});
+                        iter = modules.end() - 1;
+                    }
+
+                    iter->Entries.push_back(x);
+                }
+
+                // Obtain the module information and consult the cache..
+                std::vector<scanjob_t> jobs;
+                for (auto& m : modules)
+                {
+                    if (!lookup || !lookup(m.Module.c_str(), &m.BaseAddress, &m.Size) || m.BaseAddress == 0 || m.Size == 0)
+                        continue;
+
+                    std::vector<size_t> pending;
+                    for (const auto x : m.Entries)
+                    {
+                        const auto start = std::chrono::steady_clock::now();
+
+                        auto address = (uintptr_t)0;
+                        const auto hit = cache != nullptr && cache->Lookup(m.Module.c_str(), m.BaseAddress, m.Size, entries[x].Pattern.c_str(), patterns[x], &address);
+
+                        results[x].Duration += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                        if (hit)
+                        {
+                            results[x].Address = address;
+                            results[x].Module  = m.Module;
+                            results[x].Cached  = true;
+                            resolved[x]        = true;
+                            continue;
+                        }
+
+                        pending.push_back(x);
+                    }
+
+                    PatternResolver::SplitJobs(m, pending, patterns, rangeCount, &jobs);
+                }
+
+                if (jobs.size() == 0)
+                    continue;
+
+                // Scan the jobs; each job only writes to its own result buffers, so no locking is needed..
+                const auto scan = [&patterns](scanjob_t& job) {
+                    std::vector<compiledpattern_t> batch;
+                    batch.reserve(job.Entries.size());
+                    for (const auto x : job.Entries)
+                        batch.push_back(patterns[x]);
+
+                    job.Found.resize(batch.size(), 0);
+                    job.Times.resize(batch.size(), 0.0);
+
+                    Ashita::PatternScanner::ScanBatch(job.BaseAddress + job.Start, job.Length, batch.data(), batch.size(), job.Found.data(), job.Times.data());
+                };
+
+                if (pool == nullptr || jobs.size() == 1)
+                {
+                    for (auto& job : jobs)
+                        scan(job);
+                }
+                else
+                {
+                    std::vector<Threading::Future<void>> futures;
+                    futures.reserve(jobs.size());
+                    for (auto& job : jobs)
+                    {
+                        futures.push_back(pool->Submit([&scan, &job]() {
+                            scan(job);
+                        }));
+                    }
+
+                    for (const auto& f : futures)
+                        f.Wait();
+                }
+
+                // Merge the job results; jobs are in module and range order, so the first match of an entry is the lowest..
+                std::vector<bool> merged(entries.size(), false);
+                std::vector<double> times(entries.size(), 0.0);
+                for (const auto& job : jobs)
+                {
+                    for (size_t y = 0; y < job.Entries.size(); y++)
+                    {
+                        const auto x = job.Entries[y];
+
+                        if (merged[x])
+                            continue;
+
+                        if (job.Found[y] != 0)
+                        {
+                            results[x].Address = job.Found[y];
+                            results[x].Module  = job.Module;
+                            times[x]           = job.Times[y];
+                            merged[x]          = true;
+                        }
+                        else
+                        {
+                            times[x] = std::max(times[x], job.Times[y]);
+                        }
+                    }
+                }
+
+                // Mark the found entries as resolved and update the cache; failed entries are removed from the cache..
+                for (const auto& job : jobs)
+                {
+                    // Each entry has exactly one job at the start of its module..
+                    if (job.Start != 0)
+                        continue;
+
+                    for (const auto x : job.Entries)
+                    {
+                        resolved[x] = results[x].Address != 0;
+                        results[x].Duration += times[x];
+
+                        if (cache != nullptr)
+                            cache->Store(job.Module.c_str(), job.BaseAddress, entries[x].Pattern.c_str(), patterns[x], results[x].Address);
+                    }
+                }
+            }
+
+            return results;
+        }
+
+        /**
+         * Writes the result of each entry to the given log.
+         *
+         * @param {T*} log - The log manager. (Any object implementing Logf; ie. ILogManager.)
+         * @param {uint32_t} level - The level to log the results at. (ie. Ashita::LogLevel::Debug)
+         * @param {std::vector&} entries - The resolved entries.
+         * @param {std::vector&} results - The results of the entries. (As returned by Resolve.)
+         */
+        template<typename T>
+        static void LogResults(T* log, const uint32_t level, const std::vector<patternentry_t>& entries, const std::vector<patternresult_t>& results)
+        {
+            if (log == nullptr || entries.size() != results.size())
+                return;
+
+            auto found  = (size_t)0;
+            auto cached = (size_t)0;
+            auto total  = 0.0;
+
+            for (size_t x = 0; x < entries.size(); x++)
+            {
+                const auto& e = entries[x];
+                const auto& r = results[x];
+
+                if (r.Address != 0)
+                {
+                    log->Logf(level, "PatternResolver", "Resolved '%s' in %s at 0x%p. (%s, %.3f ms)", e.Name.c_str(), r.Module.c_str(), (const void*)r.Address, r.Cached ? "cached" : "scanned", r.Duration);
+                    found++;
+                    cached += r.Cached ? 1 : 0;
+                }
+                else
+                {
+                    log->Logf(level, "PatternResolver", "Failed to resolve '%s' in %s. (%.3f ms)", e.Name.c_str(), e.Modules.c_str(), r.Duration);
+                }
+
+                total += r.Duration;
+            }
+
+            log->Logf(level, "PatternResolver", "Resolved %u of %u entries; %u from the cache. (%.3f ms total entry time)", (uint32_t)found, (uint32_t)entries.size(), (uint32_t)cached, total);
+        }
+
+    private:
+        /**
+         * Compares two strings for equality, ignoring case.
+         *
+         * @param {std::string&} lhs - The first string.
+         * @param {std::string&} rhs - The second string.
+         * @return {bool} True if equal, false otherwise.
+         */
+        static bool EqualsNoCase(const std::string& lhs, const std::string& rhs)
+        {
+            return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](const char a, const char b) {
+                return ::tolower((uint8_t)a) == ::tolower((uint8_t)b);
+            });
+        }
+
+        /**
+         * Splits the pending entries of a module into jobs, one per address range of the module.
+         *
+         * @param {scanjob_t&} module - The module the entries are scanned within.
+         * @param {std::vector&} pending - The pending entry indexes.
+         * @param {std::vector&} patterns - The compiled patterns of all entries.
+         * @param {uint32_t} rangeCount - The maximum number of ranges to split the module into.
+         * @param {std::vector*} jobs - The job list to append the new jobs to.
+         *
+         * @notes
+         *
+         *      Each range overlaps the next by the length of the longest pattern (less one byte), so matches
+         *      that span a range boundary are still found. Entries with a Count are scanned over the full
+         *      module by a job of their own instead.
+         */
+        static void SplitJobs(const scanjob_t& module, const std::vector<size_t>& pending, const std::vector<compiledpattern_t>& patterns, const uint32_t rangeCount, std::vector<scanjob_t>* jobs)
+        {
+            if (pending.size() == 0)
+                return;
+
+            std::vector<size_t> ranged;
+            std::vector<size_t> counted;
+            auto longest = (uintptr_t)0;
+
+            for (const auto x : pending)
+            {
+                if (patterns[x].Count != 0)
+                {
+                    counted.push_back(x);
+                    continue;
+                }
+
+                ranged.push_back(x);
+                longest = std::max<uintptr_t>(longest, patterns[x].Bytes.size());
+            }
+
+            // Split the module into ranges, keeping each range large enough to be worth a job of its own..
+            if (ranged.size() > 0)
+            {
+                const auto count = std::max<uintptr_t>(1, std::min<uintptr_t>(rangeCount, module.Size / MinRangeSize));
+                const auto range = (module.Size + count - 1) / count;
+
+                for (auto start = (uintptr_t)0; start < module.Size; start += range)
+                {
+                    const auto length = std::min<uintptr_t>(module.Size - start, range + longest - 1);
+                    jobs->push_back({module.Module, module.BaseAddress, module.Size, start, length, ranged, {}, {}});
+                }
+            }
+
+            if (counted.size() > 0)
+                jobs->push_back({module.Module, module.BaseAddress, module.Size, 0, module.Size, counted, {}, {}});
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PATTERNRESOLVER_H_INCLUDED
\ No newline at end of file
@@ -0,0 +1,305 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ASHITA_SDK_PRIMITIVEBATCH_H_INCLUDED
+#define ASHITA_SDK_PRIMITIVEBATCH_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
+
+namespace Ashita
+{
+    /**
+     * Primitive Quad Object
+     *
+     * A single colored and/or textured screen-space quad. (ie. a primitive object background, border or bar.)
+     */
+    struct primitivequad_t
+    {
+        float Left;         // The left edge of the quad, in screen pixels.
+        float Top;          // The top edge of the quad, in screen pixels.
+        float Right;        // The right edge of the quad, in screen pixels.
+        float Bottom;       // The bottom edge of the quad, in screen pixels.
+        float U0;           // The left texture coordinate.
+        float V0;           // The top texture coordinate.
+        float U1;           // The right texture coordinate.
+        float V1;           // The bottom texture coordinate.
+        uint32_t Color;     // The quad color. (ARGB)
+        uintptr_t Texture;  // The texture to draw with. (ie. IDirect3DTexture8*; 0 if untextured.)
+        uint32_t Flags;     // The draw state flags. (ie. PrimitiveDrawFlags or blend state; quads only batch with equal flags.)
+        int32_t ZOrder;     // The quad z order. (Higher values are drawn on top.)
+    };
+
+    /**
+     * Primitive Vertex Object
+     *
+     * A pre-transformed, colored and textured vertex. (D3DFVF_XYZRHW | D3DFVF_DIFFUSE | D3DFVF_TEX1)
+     */
+    struct primitivevertex_t
+    {
+        float X;        // The screen X position.
+        float Y;        // The screen Y position.
+        float Z;        // The depth.
+        float Rhw;      // The reciprocal homogeneous w.
+        uint32_t Color; // The vertex color. (ARGB)
+        float U;        // The texture U coordinate.
+        float V;        // The texture V coordinate.
+    };
+
+    /**
+     * Primitive Batch
+     *
+     * Collects the quads of any number of primitive objects each frame and builds them into a single vertex
+     * stream, drawn with one call per run of quads sharing a texture and draw flags.
+     *
+     * @notes
+     *
+     *      Quads are drawn in ascending ZOrder; quads of the same ZOrder are drawn in the order they were added.
+     *      (Objects with LockedZ simply keep the ZOrder they are given.)
+     *
+     *      To merge runs, a quad may be moved into an earlier draw with the same texture and flags, but only
+     *      when it does not overlap any quad drawn between that draw and its own position. The visible result
+     *      is therefore identical to drawing every quad individually in order. The search looks back at most
+     *      MaxLookback draws. Overlap is tested against each quad of the draws it is moved past, or only against
+     *      their bounds once a draw holds more than MaxOverlapTests quads.
+     *
+     *      Quads are written as triangle lists (6 vertices per quad) so no index buffer is needed; the vertices
+     *      can be copied as-is into a single dynamic vertex buffer per frame.
+     */
+    class PrimitiveBatch
+    {
+    public:
+        static constexpr uint32_t MaxLookback     = 8;  // The number of earlier draws a quad may be moved into.
+        static constexpr uint32_t MaxOverlapTests = 64; // The number of quads of a draw tested individually for overlap.
+
+        /**
+         * Draw Call Object
+         */
+        struct draw_t
+        {
+            uintptr_t Texture;    // The texture to draw with.
+            uint32_t Flags;       // The draw state flags.
+            uint32_t StartVertex; // The first vertex of the draw.
+            uint32_t Primitives;  // The number of triangles to draw.
+        };
+
+    private:
+        /**
+         * Draw Build State Object
+         */
+        struct run_t
+        {
+            uintptr_t Texture;           // The texture of the run.
+            uint32_t Flags;              // The draw flags of the run.
+            float Left;                  // The bounds of the quads within the run.
+            float Top;                   // The bounds of the quads within the run.
+            float Right;                 // The bounds of the quads within the run.
+            float Bottom;                // The bounds of the quads within the run.
+            std::vector<uint32_t> Quads; // The quads within the run, in draw order.
+        };
+
+        std::vector<primitivequad_t> m_Quads;
+        std::vector<uint32_t> m_Order;
+        std::vector<run_t> m_Runs;
+        uint32_t m_RunCount;
+        std::vector<primitivevertex_t> m_Vertices;
+        std::vector<draw_t> m_Draws;
+
+        static bool Overlaps(const primitivequad_t& a, const primitivequad_t& b)
+        {
+            return a.Left < b.Right && b.Left < a.Right && a.Top < b.Bottom && b.Top < a.Bottom;
+        }
+
+        /**
+         * Returns if a quad overlaps any quad of the given run. (Conservatively; large runs are tested by their bounds.)
+         */
+        bool Overlaps(const run_t& r, const primitivequad_t& q) const
+        {
+            if (!(q.Left < r.Right && r.Left < q.Right && q.Top < r.Bottom && r.Top < q.Bottom))
+                return false;
+            if (r.Quads.size() > MaxOverlapTests)
+                return true;
+
+            for (const auto index : r.Quads)
+            {
+                if (PrimitiveBatch::Overlaps(this->m_Quads[index], q))
+                    return true;
+            }
+
+            return false;
+        }
+
+    public:
+        PrimitiveBatch(void)
+            : m_RunCount(0)
+        {}
+
+        /**
+         * Removes every quad from the batch. (Keeps the allocated buffers.)
+         */
+        void Clear(void)
+        {
+            this->m_Quads.clear();
+            this->m_Vertices.clear();
+            this->m_Draws.clear();
+        }
+
+        /**
+         * Adds a quad to the batch.
+         *
+         * @param {primitivequad_t&} quad - The quad to add.
+         */
+        void Add(const primitivequad_t& quad)
+        {
+            // Skip empty and fully transparent quads..
+            if (quad.Right <= quad.Left || quad.Bottom <= quad.Top || (quad.Color >> 24) == 0)
+                return;
+
+            this->m_Quads.push_back(quad);
+        }
+
+        /**
+         * Builds the vertices and draw calls of the added quads.
+         */
+        void Build(void)
+        {
+            this->m_Vertices.clear();
+            this->m_Draws.clear();
+
+            // Order the quads by their z order, keeping the order they were added in for equal values..
+            this->m_Order.resize(this->m_Quads.size());
+            for (uint32_t x = 0; x < (uint32_t)this->m_Quads.size(); x++)
+                this->m_Order[x] = x;
+
+            std::stable_sort(this->m_Order.begin(), this->m_Order.end(), [this](const uint32_t a, const uint32_t b) {
+                return this->m_Quads[a].ZOrder < this->m_Quads[b].ZOrder;
+            });
+
+            // Assign each quad to a run, moving it into an earlier matching run when nothing drawn since overlaps it..
+            for (uint32_t x = 0; x < this->m_RunCount; x++)
+                this->m_Runs[x].Quads.clear();
+            this->m_RunCount = 0;
+
+            for (const auto index : this->m_Order)
+            {
+                const auto& q = this->m_Quads[index];
+
+                auto target     = this->m_RunCount;
+                const auto last = this->m_RunCount > MaxLookback ? this->m_RunCount - MaxLookback : 0;
+                for (auto x = this->m_RunCount; x > last; x--)
+                {
+                    const auto& r = this->m_Runs[x - 1];
+                    if (r.Texture == q.Texture && r.Flags == q.Flags)
+                    {
+                        target = x - 1;
+                        break;
+                    }
+                    if (this->Overlaps(r, q))
+                        break;
+                }
+
+                if (target == this->m_RunCount)
+                {
+                    if (this->m_Runs.size() == this->m_RunCount)
+                        this->m_Runs.emplace_back();
+
+                    auto& r   = this->m_Runs[this->m_RunCount++];
+                    r.Texture = q.Texture;
+                    r.Flags   = q.Flags;
+                    r.Left    = q.Left;
+                    r.Top     = q.Top;
+                    r.Right   = q.Right;
+                    r.Bottom  = q.Bottom;
+                }
+
+                auto& r  = this->m_Runs[target];
+                r.Left   = std::min(r.Left, q.Left);
+                r.Top    = std::min(r.Top, q.Top);
+                r.Right  = std::max(r.Right, q.Right);
+                r.Bottom = std::max(r.Bottom, q.Bottom);
+                r.Quads.push_back(index);
+            }
+
+            // Write the vertices of each run..
+            this->m_Vertices.reserve(this->m_Quads.size() * 6);
+            for (uint32_t x = 0; x < this->m_RunCount; x++)
+            {
+                const auto& r = this->m_Runs[x];
+                this->m_Draws.push_back({r.Texture, r.Flags, (uint32_t)this->m_Vertices.size(), (uint32_t)r.Quads.size() * 2});
+
+                for (const auto index : r.Quads)
+                {
+                    const auto& q = this->m_Quads[index];
+                    const auto x0 = q.Left - 0.5f;
+                    const auto y0 = q.Top - 0.5f;
+                    const auto x1 = q.Right - 0.5f;
+                    const auto y1 = q.Bottom - 0.5f;
+
+                    this->m_Vertices.push_back({x0, y0, 0.0f, 1.0f, q.Color, q.U0, q.V0});
+                    this->m_Vertices.push_back({x1, y0, 0.0f, 1.0f, q.Color, q.U1, q.V0});
+                    this->m_Vertices.push_back({x0, y1, 0.0f, 1.0f, q.Color, q.U0, q.V1});
+                    this->m_Vertices.push_back({x1, y0, 0.0f, 1.0f, q.Color, q.U1, q.V0});
+                    this->m_Vertices.push_back({x1, y1, 0.0f, 1.0f, q.Color, q.U1, q.V1});
+                    this->m_Vertices.push_back({x0, y1, 0.0f, 1.0f, q.Color, q.U0, q.V1});
+                }
+            }
+        }
+
+        /**
+         * Returns the number of quads in the batch.
+         *
+         * @return {uint32_t} The number of quads.
+         */
+        uint32_t GetQuadCount(void) const
+        {
+            return (uint32_t)this->m_Quads.size();
+        }
+
+        /**
+         * Returns the built vertices.
+         *
+         * @return {const std::vector<primitivevertex_t>&} The vertices.
+         */
+        const std::vector<primitivevertex_t>& GetVertices(void) const
+        {
+            return this->m_Vertices;
+        }
+
+        /**
+         * Returns the built draw calls.
+         *
+         * @return {const std::vector<draw_t>&} The draw calls.
+         */
+        const std::vector<draw_t>& GetDraws(void) const
+        {
+            return this->m_Draws;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PRIMITIVEBATCH_H_INCLUDED
\ No newline at end of file
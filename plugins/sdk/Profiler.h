@@ -0,0 +1,560 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_PROFILER_H_INCLUDED
+#define ASHITA_SDK_PROFILER_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Ashita
+{
+    /**
+     * Profiler Trace File Header
+     *
+     * The header at the start of every profiler trace file.
+     */
+    struct profilertraceheader_t
+    {
+        char Magic[4];      // The file magic. ('APRF')
+        uint16_t Version;   // The file format version.
+        uint16_t Size;      // The size of this header, in bytes. (Records start at this offset.)
+        uint64_t StartTime; // The time the trace was started. (Unix time, in milliseconds.)
+    };
+
+    /**
+     * Profiler Trace Record
+     *
+     * A record within a profiler trace file.
+     *
+     * @notes
+     *
+     *      Name records give the name of a handler before its first sample. The name follows the record directly,
+     *      padded to an 8 byte boundary, and its length is stored in Duration.
+     *
+     *      Sample records hold a single call of a handler. Frame records mark the end of a frame; their Start is
+     *      the start of the frame and Duration the full frame time. Times are in nanoseconds, relative to the
+     *      start of the trace.
+     */
+    struct profilertracerecord_t
+    {
+        uint16_t Type;     // The record type. (See: Profiler::RecordName, Profiler::RecordSample, Profiler::RecordFrame)
+        uint16_t Handler;  // The handler id.
+        uint32_t Frame;    // The frame number.
+        uint64_t Start;    // The start time, in nanoseconds.
+        uint64_t Duration; // The duration, in nanoseconds. (The name length for name records.)
+    };
+
+    static_assert(sizeof(profilertraceheader_t) == 16, "profilertraceheader_t must be 16 bytes.");
+    static_assert(sizeof(profilertracerecord_t) == 24, "profilertracerecord_t must be 24 bytes.");
+
+    /**
+     * Profiler Statistics Object
+     *
+     * The statistics of a handler over the profilers frame window. Times are the per-frame totals of the handler,
+     * in nanoseconds.
+     */
+    struct profilerstats_t
+    {
+        uint32_t Frames; // The number of frames the statistics cover.
+        double Calls;    // The average number of calls per frame.
+        double Mean;     // The mean time per frame.
+        uint64_t P50;    // The 50th percentile time per frame.
+        uint64_t P95;    // The 95th percentile time per frame.
+        uint64_t P99;    // The 99th percentile time per frame.
+        uint64_t Max;    // The largest time of a single frame.
+    };
+
+    /**
+     * Profiler
+     *
+     * Times named handlers (ie. plugin callbacks) with a high-resolution clock and aggregates their cost per
+     * frame. The statistics of each handler cover the last Profiler::Window frames, and the samples can be
+     * written to a binary trace file for offline analysis.
+     *
+     * @notes
+     *
+     *      Handlers are registered once by name and timed with a ProfilerScope, or by passing times taken from
+     *      Now to Record. EndFrame must be called once per frame (ie. from Direct3DPresent) to roll the totals of
+     *      the frame into the window.
+     *
+     *      Handlers may be timed from any thread (ie. packet handlers); recording is guarded by a lock. Samples
+     *      are attributed to the frame that is current when they end.
+     *
+     *      The trace file format is shared with the addon profiler library. (libs/profiler.lua)
+     */
+    class Profiler
+    {
+    public:
+        static constexpr uint16_t Version        = 1;          // The current trace file format version.
+        static constexpr uint16_t RecordName     = 0;          // The record type of handler names.
+        static constexpr uint16_t RecordSample   = 1;          // The record type of handler samples.
+        static constexpr uint16_t RecordFrame    = 2;          // The record type of frame ends.
+        static constexpr uint32_t Window         = 600;        // The number of frames statistics are kept for.
+        static constexpr uint32_t MaxHandlers    = 0xFFFF;     // The maximum number of handlers.
+        static constexpr uint32_t InvalidHandler = 0xFFFFFFFF; // The handler id returned on failure.
+
+    private:
+        /**
+         * Handler Object
+         */
+        struct handler_t
+        {
+            std::string Name;            // The handler name.
+            uint64_t Time;               // The total time of the current frame.
+            uint32_t Calls;              // The number of calls of the current frame.
+            std::vector<uint64_t> Times; // The total time of each frame in the window.
+            std::vector<uint32_t> Count; // The number of calls of each frame in the window.
+        };
+
+        mutable std::mutex m_Mutex;
+        std::chrono::steady_clock::time_point m_Start;
+        std::vector<handler_t> m_Handlers;
+        std::vector<uint64_t> m_Frames; // The time of each frame in the window.
+        uint64_t m_FrameStart;
+        uint32_t m_Frame;
+        uint32_t m_Filled;
+        bool m_IsEnabled;
+
+        std::ofstream m_Trace;
+        std::chrono::steady_clock::time_point m_TraceStart;
+        std::vector<uint8_t> m_TraceBuffer;
+
+        mutable std::vector<uint64_t> m_Scratch;
+
+    public:
+        Profiler(void)
+            : m_Start(std::chrono::steady_clock::now())
+            , m_Frames(Window, 0)
+            , m_FrameStart(0)
+            , m_Frame(0)
+            , m_Filled(0)
+            , m_IsEnabled(true)
+        {}
+        ~Profiler(void)
+        {
+            this->StopTrace();
+        }
+
+        Profiler(const Profiler&)            = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        /**
+         * Returns the current time of the profiler clock.
+         *
+         * @return {uint64_t} The time, in nanoseconds, since the profiler was created.
+         */
+        uint64_t Now(void) const
+        {
+            return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->m_Start).count();
+        }
+
+        /**
+         * Sets if the profiler records samples.
+         *
+         * @param {bool} enabled - The enabled state.
+         */
+        void SetEnabled(const bool enabled)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            this->m_IsEnabled = enabled;
+        }
+
+        /**
+         * Returns if the profiler records samples.
+         *
+         * @return {bool} True if enabled, false otherwise.
+         */
+        bool GetEnabled(void) const
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            return this->m_IsEnabled;
+        }
+
+        /**
+         * Registers a handler, or returns the id of the handler already registered with the given name.
+         *
+         * @param {const char*} name - The handler name.
+         * @return {uint32_t} The handler id on success, Profiler::InvalidHandler otherwise.
+         */
+        uint32_t Register(const char* name)
+        {
+            if (name == nullptr)
+                return InvalidHandler;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            for (uint32_t x = 0; x < (uint32_t)this->m_Handlers.size(); x++)
+            {
+                if (this->m_Handlers[x].Name == name)
+                    return x;
+            }
+
+            if (this->m_Handlers.size() >= MaxHandlers)
+                return InvalidHandler;
+
+            this->m_Handlers.push_back({name, 0, 0, std::vector<uint64_t>(Window, 0), std::vector<uint32_t>(Window, 0)});
+
+            const auto id = (uint32_t)this->m_Handlers.size() - 1;
+            if (this->m_Trace.is_open())
+                this->WriteName(id);
+
+            return id;
+        }
+
+        /**
+         * Returns the number of registered handlers.
+         *
+         * @return {uint32_t} The number of handlers.
+         */
+        uint32_t GetHandlerCount(void) const
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            return (uint32_t)this->m_Handlers.size();
+        }
+
+        /**
+         * Returns the name of a handler.
+         *
+         * @param {uint32_t} handler - The handler id.
+         * @return {std::string} The handler name, empty if invalid.
+         */
+        std::string GetHandlerName(const uint32_t handler) const
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            return handler < this->m_Handlers.size() ? this->m_Handlers[handler].Name : std::string();
+        }
+
+        /**
+         * Records a call of a handler.
+         *
+         * @param {uint32_t} handler - The handler id.
+         * @param {uint64_t} start - The start time of the call. (See: Now)
+         * @param {uint64_t} end - The end time of the call. (See: Now)
+         */
+        void Record(const uint32_t handler, const uint64_t start, const uint64_t end)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            if (!this->m_IsEnabled || handler >= this->m_Handlers.size())
+                return;
+
+            const auto duration = end > start ? end - start : 0;
+
+            auto& h = this->m_Handlers[handler];
+            h.Time += duration;
+            h.Calls++;
+
+            if (this->m_Trace.is_open())
+                this->WriteRecord(RecordSample, (uint16_t)handler, start, duration);
+        }
+
+        /**
+         * Ends the current frame, rolling the totals of each handler into the frame window.
+         */
+        void EndFrame(void)
+        {
+            const auto now = this->Now();
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            if (!this->m_IsEnabled)
+            {
+                this->m_FrameStart = now;
+                return;
+            }
+
+            const auto pos = this->m_Frame % Window;
+
+            this->m_Frames[pos] = now - this->m_FrameStart;
+            for (auto& h : this->m_Handlers)
+            {
+                h.Times[pos] = h.Time;
+                h.Count[pos] = h.Calls;
+                h.Time       = 0;
+                h.Calls      = 0;
+            }
+
+            if (this->m_Trace.is_open())
+                this->WriteRecord(RecordFrame, 0, this->m_FrameStart, now - this->m_FrameStart);
+
+            this->m_FrameStart = now;
+            this->m_Frame++;
+            this->m_Filled = this->m_Filled < Window ? this->m_Filled + 1 : Window;
+        }
+
+        /**
+         * Returns the number of frames ended since the profiler was created.
+         *
+         * @return {uint32_t} The number of frames.
+         */
+        uint32_t GetFrame(void) const
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            return this->m_Frame;
+        }
+
+        /**
+         * Returns the statistics of a handler over the frame window.
+         *
+         * @param {uint32_t} handler - The handler id.
+         * @param {profilerstats_t*} stats - The statistics object to fill.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool GetStats(const uint32_t handler, profilerstats_t* stats) const
+        {
+            if (stats == nullptr)
+                return false;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            if (handler >= this->m_Handlers.size())
+                return false;
+
+            const auto& h = this->m_Handlers[handler];
+
+            uint64_t calls = 0;
+            for (uint32_t x = 0; x < this->m_Filled; x++)
+                calls += h.Count[x];
+
+            this->GetWindowStats(h.Times, stats);
+            stats->Calls = this->m_Filled == 0 ? 0.0 : (double)calls / this->m_Filled;
+
+            return true;
+        }
+
+        /**
+         * Returns the statistics of the frame time over the frame window.
+         *
+         * @param {profilerstats_t*} stats - The statistics object to fill.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool GetFrameStats(profilerstats_t* stats) const
+        {
+            if (stats == nullptr)
+                return false;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            this->GetWindowStats(this->m_Frames, stats);
+            stats->Calls = this->m_Filled == 0 ? 0.0 : 1.0;
+
+            return true;
+        }
+
+        /**
+         * Starts writing samples to a trace file, replacing any existing file.
+         *
+         * @param {const char*} path - The path to the trace file.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool StartTrace(const char* path)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            this->StopTraceUnlocked();
+
+            if (path == nullptr)
+                return false;
+
+            this->m_Trace.open(path, std::ios::binary | std::ios::trunc);
+            if (!this->m_Trace.is_open())
+                return false;
+
+            profilertraceheader_t header{};
+            std::memcpy(header.Magic, "APRF", 4);
+            header.Version   = Version;
+            header.Size      = sizeof(profilertraceheader_t);
+            header.StartTime = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+            if (!this->m_Trace.write((const char*)&header, sizeof(header)))
+            {
+                this->StopTraceUnlocked();
+                return false;
+            }
+
+            // Trace times are relative to the start of the trace..
+            this->m_TraceStart = std::chrono::steady_clock::now();
+            this->m_TraceBuffer.reserve(64 * 1024 + 1024);
+
+            for (uint32_t x = 0; x < (uint32_t)this->m_Handlers.size(); x++)
+                this->WriteName(x);
+
+            return true;
+        }
+
+        /**
+         * Flushes and closes the trace file.
+         */
+        void StopTrace(void)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            this->StopTraceUnlocked();
+        }
+
+        /**
+         * Returns if a trace file is being written.
+         *
+         * @return {bool} True if tracing, false otherwise.
+         */
+        bool IsTracing(void) const
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            return this->m_Trace.is_open();
+        }
+
+    private:
+        void GetWindowStats(const std::vector<uint64_t>& times, profilerstats_t* stats) const
+        {
+            std::memset(stats, 0x00, sizeof(profilerstats_t));
+
+            const auto count = this->m_Filled;
+            if (count == 0)
+                return;
+
+            this->m_Scratch.assign(times.begin(), times.begin() + count);
+
+            uint64_t total = 0;
+            for (const auto t : this->m_Scratch)
+                total += t;
+
+            stats->Frames = count;
+            stats->Mean   = (double)total / count;
+
+            // Select each percentile in increasing order, so each selection only has to partition the remainder..
+            const auto select = [this](const uint32_t from, const uint32_t nth) {
+                const auto begin = this->m_Scratch.begin();
+                if (nth >= from)
+                    std::nth_element(begin + from, begin + nth, this->m_Scratch.end());
+                return this->m_Scratch[nth];
+            };
+
+            const auto p50 = (count * 50 + 99) / 100 - 1;
+            const auto p95 = (count * 95 + 99) / 100 - 1;
+            const auto p99 = (count * 99 + 99) / 100 - 1;
+
+            stats->P50 = select(0, p50);
+            stats->P95 = select(p50 + 1, p95);
+            stats->P99 = select(p95 + 1, p99);
+            stats->Max = *std::max_element(this->m_Scratch.begin() + p99, this->m_Scratch.end());
+        }
+
+        uint64_t GetTraceTime(const uint64_t time) const
+        {
+            const auto offset = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(this->m_TraceStart - this->m_Start).count();
+            return time > offset ? time - offset : 0;
+        }
+
+        void WriteRecord(const uint16_t type, const uint16_t handler, const uint64_t start, const uint64_t duration)
+        {
+            const profilertracerecord_t record{type, handler, this->m_Frame, this->GetTraceTime(start), duration};
+
+            const auto offset = this->m_TraceBuffer.size();
+            this->m_TraceBuffer.resize(offset + sizeof(record));
+            std::memcpy(this->m_TraceBuffer.data() + offset, &record, sizeof(record));
+
+            if (this->m_TraceBuffer.size() >= 64 * 1024)
+                this->FlushTrace();
+        }
+
+        void WriteName(const uint32_t handler)
+        {
+            const auto& name = this->m_Handlers[handler].Name;
+            const auto size  = (uint32_t)((name.size() + 7) & ~(size_t)7);
+
+            const profilertracerecord_t record{RecordName, (uint16_t)handler, this->m_Frame, 0, name.size()};
+
+            const auto offset = this->m_TraceBuffer.size();
+            this->m_TraceBuffer.resize(offset + sizeof(record) + size, 0);
+            std::memcpy(this->m_TraceBuffer.data() + offset, &record, sizeof(record));
+            std::memcpy(this->m_TraceBuffer.data() + offset + sizeof(record), name.data(), name.size());
+        }
+
+        void FlushTrace(void)
+        {
+            if (this->m_TraceBuffer.size() > 0)
+                this->m_Trace.write((const char*)this->m_TraceBuffer.data(), (std::streamsize)this->m_TraceBuffer.size());
+
+            this->m_TraceBuffer.clear();
+            this->m_Trace.flush();
+        }
+
+        void StopTraceUnlocked(void)
+        {
+            if (!this->m_Trace.is_open())
+                return;
+
+            this->FlushTrace();
+            this->m_Trace.close();
+            this->m_Trace.clear();
+        }
+    };
+
+    /**
+     * Profiler Scope
+     *
+     * Times a handler for the lifetime of the scope object.
+     *
+     * @notes
+     *
+     *      Example usage:
+     *
+     *          void Direct3DPresent(...)
+     *          {
+     *              Ashita::ProfilerScope scope(&this->m_Profiler, this->m_PresentHandler);
+     *              ...
+     *          }
+     */
+    class ProfilerScope
+    {
+        Profiler* m_Profiler;
+        uint32_t m_Handler;
+        uint64_t m_Start;
+
+    public:
+        ProfilerScope(Profiler* profiler, const uint32_t handler)
+            : m_Profiler(profiler)
+            , m_Handler(handler)
+            , m_Start(profiler == nullptr ? 0 : profiler->Now())
+        {}
+        ~ProfilerScope(void)
+        {
+            if (this->m_Profiler != nullptr)
+                this->m_Profiler->Record(this->m_Handler, this->m_Start, this->m_Profiler->Now());
+        }
+
+        ProfilerScope(const ProfilerScope&)            = delete;
+        ProfilerScope& operator=(const ProfilerScope&) = delete;
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_PROFILER_H_INCLUDED
\ No newline at end of file
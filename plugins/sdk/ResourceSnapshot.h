@@ -0,0 +1,638 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_RESOURCESNAPSHOT_H_INCLUDED
+#define ASHITA_SDK_RESOURCESNAPSHOT_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "AtomicFile.h"
+#include "MappedFile.h"
+
+namespace Ashita
+{
+    /**
+     * Resource Snapshot File Header
+     *
+     * The header at the start of every resource snapshot file.
+     */
+    struct resourcesnapshotheader_t
+    {
+        char Magic[4];         // The file magic. ('ARSS')
+        uint16_t Version;      // The file format version.
+        uint16_t Size;         // The size of this header, in bytes.
+        uint32_t SourceCount;  // The number of source DAT files.
+        uint32_t TableCount;   // The number of tables.
+        uint64_t SourceOffset; // The offset of the source DAT files.
+        uint64_t TableOffset;  // The offset of the tables.
+        uint64_t FileSize;     // The size of the snapshot file, in bytes. (Detects truncated files.)
+        uint64_t Key;          // The snapshot key. (ie. a hash of the DAT map configuration and parser version.)
+    };
+
+    /**
+     * Resource Snapshot Source
+     *
+     * A source DAT file the snapshot was built from.
+     */
+    struct resourcesnapshotsource_t
+    {
+        uint32_t FileId;   // The DAT file id.
+        uint32_t Reserved; // Reserved.
+        uint64_t Size;     // The size of the DAT file, in bytes.
+        uint64_t Hash;     // The hash of the DAT file contents. (See: ResourceSnapshot::Hash)
+    };
+
+    /**
+     * Resource Snapshot Table
+     *
+     * A table of parsed entries. (ie. the items, or a string table.)
+     */
+    struct resourcesnapshottable_t
+    {
+        char Name[48];        // The table name. (ie. the DAT map cache entry name.)
+        uint32_t Type;        // The table type. (See: ResourceSnapshot::TypeAbilitySpell, etc.)
+        uint32_t Count;       // The number of entries.
+        uint64_t IndexOffset; // The offset of the entry index. (Ordered by id.)
+        uint64_t DataOffset;  // The offset of the entry data.
+        uint64_t DataSize;    // The size of the entry data, in bytes.
+    };
+
+    /**
+     * Resource Snapshot Entry
+     *
+     * An entry of a table index.
+     */
+    struct resourcesnapshotentry_t
+    {
+        uint32_t Id;     // The entry id.
+        uint32_t Size;   // The size of the entry data, in bytes.
+        uint64_t Offset; // The offset of the entry data, relative to the table data.
+    };
+
+    static_assert(sizeof(resourcesnapshotheader_t) == 48, "resourcesnapshotheader_t must be 48 bytes.");
+    static_assert(sizeof(resourcesnapshotsource_t) == 24, "resourcesnapshotsource_t must be 24 bytes.");
+    static_assert(sizeof(resourcesnapshottable_t) == 80, "resourcesnapshottable_t must be 80 bytes.");
+    static_assert(sizeof(resourcesnapshotentry_t) == 16, "resourcesnapshotentry_t must be 16 bytes.");
+
+    namespace ResourceSnapshot
+    {
+        constexpr uint16_t Version          = 1; // The current file format version.
+        constexpr uint32_t Align            = 8; // The alignment of every section and entry.
+        constexpr uint32_t TypeAbilitySpell = 0; // Table type of ability/spell files. (Matches the DAT map types.)
+        constexpr uint32_t TypeDialog       = 1; // Table type of dialog text files.
+        constexpr uint32_t TypeItem         = 2; // Table type of item files.
+        constexpr uint32_t TypeString       = 3; // Table type of string files. (d_msg)
+        constexpr uint32_t TypeStatusIcon   = 4; // Table type of status icon files.
+
+        /**
+         * Returns the hash of the given data.
+         *
+         * @param {const uint8_t*} data - The data to hash.
+         * @param {size_t} size - The size of the data.
+         * @return {uint64_t} The hash of the data.
+         * @notes
+         *
+         *      A 64bit FNV-1a variant that consumes 8 bytes per step; intended for change detection, not security.
+         */
+        inline uint64_t Hash(const uint8_t* data, const size_t size)
+        {
+            auto hash = (uint64_t)0xCBF29CE484222325;
+
+            size_t x = 0;
+            for (; x + 8 <= size; x += 8)
+            {
+                uint64_t word = 0;
+                std::memcpy(&word, data + x, 8);
+                hash = (hash ^ word) * 0x100000001B3;
+                hash ^= hash >> 29;
+            }
+            for (; x < size; x++)
+                hash = (hash ^ data[x]) * 0x100000001B3;
+
+            return hash ^ size;
+        }
+
+        /**
+         * Returns the size and hash of a file.
+         *
+         * @param {const char*} path - The path to the file.
+         * @param {resourcesnapshotsource_t*} source - The source object to fill. (FileId is left untouched.)
+         * @return {bool} True on success, false otherwise.
+         */
+        inline bool HashFile(const char* path, resourcesnapshotsource_t* source)
+        {
+            if (source == nullptr)
+                return false;
+
+            MappedFile file;
+            if (!file.Open(path))
+                return false;
+
+            source->Size = file.GetSize();
+            source->Hash = ResourceSnapshot::Hash(file.GetData(), file.GetSize());
+
+            return true;
+        }
+    } // namespace ResourceSnapshot
+
+    /**
+     * Resource Snapshot Writer
+     *
+     * Builds a resource snapshot file from parsed DAT tables.
+     *
+     * @notes
+     *
+     *      Tables are keyed by name; adding a table with an existing name returns the existing table, so several
+     *      DAT files can merge into one table (ie. the item files). Entries with the same id replace earlier ones.
+     *
+     *      The snapshot is written to a temporary file and moved into place once complete, so a reader never
+     *      sees a partially written snapshot.
+     */
+    class ResourceSnapshotWriter
+    {
+        /**
+         * Table Build Object
+         */
+        struct table_t
+        {
+            std::string Name;
+            uint32_t Type;
+            std::vector<resourcesnapshotentry_t> Entries;
+            std::vector<uint8_t> Data;
+        };
+
+        uint64_t m_Key;
+        std::vector<resourcesnapshotsource_t> m_Sources;
+        std::vector<table_t> m_Tables;
+
+    public:
+        ResourceSnapshotWriter(void)
+            : m_Key(0)
+        {}
+
+        /**
+         * Sets the snapshot key.
+         *
+         * @param {uint64_t} key - The key. (ie. a hash of the DAT map configuration and parser version.)
+         */
+        void SetKey(const uint64_t key)
+        {
+            this->m_Key = key;
+        }
+
+        /**
+         * Adds a source DAT file, reading its size and hash.
+         *
+         * @param {uint32_t} fileId - The DAT file id.
+         * @param {const char*} path - The path to the DAT file.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool AddSource(const uint32_t fileId, const char* path)
+        {
+            resourcesnapshotsource_t source{};
+            source.FileId = fileId;
+
+            if (!ResourceSnapshot::HashFile(path, &source))
+                return false;
+
+            this->m_Sources.push_back(source);
+            return true;
+        }
+
+        /**
+         * Adds a table, or returns the table already added with the given name.
+         *
+         * @param {const char*} name - The table name. (Up to 47 characters.)
+         * @param {uint32_t} type - The table type.
+         * @return {uint32_t} The table index.
+         */
+        uint32_t AddTable(const char* name, const uint32_t type)
+        {
+            const std::string n(name == nullptr ? "" : name, 0, sizeof(resourcesnapshottable_t::Name) - 1);
+
+            for (uint32_t x = 0; x < (uint32_t)this->m_Tables.size(); x++)
+            {
+                if (this->m_Tables[x].Name == n)
+                    return x;
+            }
+
+            this->m_Tables.push_back({n, type, {}, {}});
+            return (uint32_t)this->m_Tables.size() - 1;
+        }
+
+        /**
+         * Adds an entry to a table.
+         *
+         * @param {uint32_t} table - The table index.
+         * @param {uint32_t} id - The entry id.
+         * @param {const void*} data - The entry data.
+         * @param {uint32_t} size - The size of the entry data.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool AddEntry(const uint32_t table, const uint32_t id, const void* data, const uint32_t size)
+        {
+            if (table >= this->m_Tables.size() || (data == nullptr && size > 0))
+                return false;
+
+            auto& t = this->m_Tables[table];
+
+            const auto offset = t.Data.size();
+            t.Data.resize((offset + size + (ResourceSnapshot::Align - 1)) & ~(size_t)(ResourceSnapshot::Align - 1), 0);
+            if (size > 0)
+                std::memcpy(t.Data.data() + offset, data, size);
+
+            t.Entries.push_back({id, size, offset});
+            return true;
+        }
+
+        /**
+         * Adds a string entry to a table. (Stored with its null terminator.)
+         *
+         * @param {uint32_t} table - The table index.
+         * @param {uint32_t} id - The entry id.
+         * @param {const char*} str - The string.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool AddString(const uint32_t table, const uint32_t id, const char* str)
+        {
+            return str != nullptr && this->AddEntry(table, id, str, (uint32_t)std::strlen(str) + 1);
+        }
+
+        /**
+         * Writes the snapshot file, replacing any existing file.
+         *
+         * @param {const char*} path - The path to the snapshot file.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool Write(const char* path)
+        {
+            if (path == nullptr)
+                return false;
+
+            // Order the entries of each table by id, keeping the last entry added for duplicate ids..
+            for (auto& t : this->m_Tables)
+            {
+                std::stable_sort(t.Entries.begin(), t.Entries.end(), [](const resourcesnapshotentry_t& a, const resourcesnapshotentry_t& b) {
+                    return a.Id < b.Id;
+                });
+
+                std::vector<resourcesnapshotentry_t> entries;
+                entries.reserve(t.Entries.size());
+                for (const auto& e : t.Entries)
+                {
+                    if (!entries.empty() && entries.back().Id == e.Id)
+                        entries.back() = e;
+                    else
+                        entries.push_back(e);
+                }
+                t.Entries.swap(entries);
+            }
+
+            // Lay out the file..
+            resourcesnapshotheader_t header{};
+            std::memcpy(header.Magic, "ARSS", 4);
+            header.Version      = ResourceSnapshot::Version;
+            header.Size         = sizeof(resourcesnapshotheader_t);
+            header.SourceCount  = (uint32_t)this->m_Sources.size();
+            header.TableCount   = (uint32_t)this->m_Tables.size();
+            header.SourceOffset = sizeof(resourcesnapshotheader_t);
+            header.TableOffset  = header.SourceOffset + sizeof(resourcesnapshotsource_t) * this->m_Sources.size();
+            header.Key          = this->m_Key;
+
+            std::vector<resourcesnapshottable_t> tables(this->m_Tables.size());
+
+            auto offset = header.TableOffset + sizeof(resourcesnapshottable_t) * tables.size();
+            for (size_t x = 0; x < tables.size(); x++)
+            {
+                const auto& t = this->m_Tables[x];
+
+                std::memset(&tables[x], 0x00, sizeof(resourcesnapshottable_t));
+                std::memcpy(tables[x].Name, t.Name.data(), t.Name.size());
+                tables[x].Type        = t.Type;
+                tables[x].Count       = (uint32_t)t.Entries.size();
+                tables[x].IndexOffset = offset;
+                tables[x].DataOffset  = offset + sizeof(resourcesnapshotentry_t) * t.Entries.size();
+                tables[x].DataSize    = t.Data.size();
+
+                offset = tables[x].DataOffset + t.Data.size();
+            }
+            header.FileSize = offset;
+
+            // Write the file to a temporary path, then move it into place..
+            AtomicFileWriter file(path);
+            if (!file.IsOpen())
+                return false;
+
+            auto& f = file.GetStream();
+            f.write((const char*)&header, sizeof(header));
+            f.write((const char*)this->m_Sources.data(), (std::streamsize)(sizeof(resourcesnapshotsource_t) * this->m_Sources.size()));
+            f.write((const char*)tables.data(), (std::streamsize)(sizeof(resourcesnapshottable_t) * tables.size()));
+
+            for (const auto& t : this->m_Tables)
+            {
+                f.write((const char*)t.Entries.data(), (std::streamsize)(sizeof(resourcesnapshotentry_t) * t.Entries.size()));
+                f.write((const char*)t.Data.data(), (std::streamsize)t.Data.size());
+            }
+
+            return file.Commit();
+        }
+    };
+
+    /**
+     * Resource Snapshot Reader
+     *
+     * Maps a resource snapshot file and reads its tables in place.
+     *
+     * @notes
+     *
+     *      Every offset of the snapshot is validated when it is opened, so lookups do no further bounds checks.
+     *
+     *      Before using a snapshot, IsCurrent must be used to check that it was built with the expected key and
+     *      that none of its source DAT files changed since. (ie. after a game update.) When it is not current,
+     *      the DAT files are parsed as normal and a new snapshot written with ResourceSnapshotWriter.
+     */
+    class ResourceSnapshotReader
+    {
+        MappedFile m_File;
+
+    public:
+        /**
+         * Opens and maps a snapshot file.
+         *
+         * @param {const char*} path - The path to the snapshot file.
+         * @return {bool} True on success, false otherwise. (Fails if the file is damaged or of another version.)
+         */
+        bool Open(const char* path)
+        {
+            if (!this->m_File.Open(path))
+                return false;
+
+            if (!this->Validate())
+            {
+                this->m_File.Close();
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * Unmaps and closes the snapshot file.
+         */
+        void Close(void)
+        {
+            this->m_File.Close();
+        }
+
+        /**
+         * Returns the snapshot header.
+         *
+         * @return {const resourcesnapshotheader_t*} The header if open, nullptr otherwise.
+         */
+        const resourcesnapshotheader_t* GetHeader(void) const
+        {
+            return (const resourcesnapshotheader_t*)this->m_File.GetData();
+        }
+
+        /**
+         * Returns the source DAT files of the snapshot.
+         *
+         * @param {uint32_t*} count - The number of source files.
+         * @return {const resourcesnapshotsource_t*} The source files.
+         */
+        const resourcesnapshotsource_t* GetSources(uint32_t* count) const
+        {
+            const auto header = this->GetHeader();
+            if (count != nullptr)
+                *count = header == nullptr ? 0 : header->SourceCount;
+
+            return header == nullptr ? nullptr : (const resourcesnapshotsource_t*)(this->m_File.GetData() + header->SourceOffset);
+        }
+
+        /**
+         * Returns if the snapshot was built with the given key from the current source DAT files.
+         *
+         * @param {uint64_t} key - The expected snapshot key.
+         * @param {std::function} resolve - Function returning the path of a DAT file, given its file id.
+         * @return {bool} True if current, false otherwise.
+         */
+        bool IsCurrent(const uint64_t key, const std::function<std::string(uint32_t)>& resolve) const
+        {
+            const auto header = this->GetHeader();
+            if (header == nullptr || header->Key != key || !resolve)
+                return false;
+
+            uint32_t count = 0;
+            const auto sources = this->GetSources(&count);
+
+            // Compare the file sizes first; they are cheap to read and catch most changes..
+            for (uint32_t x = 0; x < count; x++)
+            {
+                std::error_code ec;
+                const auto size = std::filesystem::file_size(resolve(sources[x].FileId), ec);
+                if (ec || size != sources[x].Size)
+                    return false;
+            }
+
+            for (uint32_t x = 0; x < count; x++)
+            {
+                resourcesnapshotsource_t source{};
+                if (!ResourceSnapshot::HashFile(resolve(sources[x].FileId).c_str(), &source) || source.Size != sources[x].Size || source.Hash != sources[x].Hash)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * Returns if the snapshot was built with the given key from the current source DAT files.
+         *
+         * @param {uint64_t} key - The expected snapshot key.
+         * @param {T*} resources - The resource manager. (Any object implementing GetFilePath; ie. IResourceManager.)
+         * @return {bool} True if current, false otherwise.
+         */
+        template<typename T>
+        bool IsCurrent(const uint64_t key, T* resources) const
+        {
+            if (resources == nullptr)
+                return false;
+
+            return this->IsCurrent(key, [resources](const uint32_t fileId) {
+                constexpr uint32_t PathSize = 260; // (MAX_PATH)
+
+                char path[PathSize]{};
+                resources->GetFilePath(fileId, path, PathSize);
+                return std::string(path);
+            });
+        }
+
+        /**
+         * Returns a table by name.
+         *
+         * @param {const char*} name - The table name.
+         * @return {const resourcesnapshottable_t*} The table if found, nullptr otherwise.
+         */
+        const resourcesnapshottable_t* GetTable(const char* name) const
+        {
+            const auto header = this->GetHeader();
+            if (header == nullptr || name == nullptr)
+                return nullptr;
+
+            const auto tables = (const resourcesnapshottable_t*)(this->m_File.GetData() + header->TableOffset);
+            for (uint32_t x = 0; x < header->TableCount; x++)
+            {
+                if (std::strncmp(tables[x].Name, name, sizeof(tables[x].Name)) == 0)
+                    return &tables[x];
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * Returns the entry index of a table.
+         *
+         * @param {const resourcesnapshottable_t*} table - The table.
+         * @return {const resourcesnapshotentry_t*} The entries, ordered by id. (table->Count entries.)
+         */
+        const resourcesnapshotentry_t* GetEntries(const resourcesnapshottable_t* table) const
+        {
+            return table == nullptr ? nullptr : (const resourcesnapshotentry_t*)(this->m_File.GetData() + table->IndexOffset);
+        }
+
+        /**
+         * Returns the data of an entry.
+         *
+         * @param {const resourcesnapshottable_t*} table - The table.
+         * @param {const resourcesnapshotentry_t*} entry - The entry.
+         * @return {const uint8_t*} The entry data.
+         */
+        const uint8_t* GetData(const resourcesnapshottable_t* table, const resourcesnapshotentry_t* entry) const
+        {
+            return table == nullptr || entry == nullptr ? nullptr : this->m_File.GetData() + table->DataOffset + entry->Offset;
+        }
+
+        /**
+         * Returns the data of an entry by id.
+         *
+         * @param {const resourcesnapshottable_t*} table - The table.
+         * @param {uint32_t} id - The entry id.
+         * @param {uint32_t*} size - The size of the entry data. (Optional.)
+         * @return {const uint8_t*} The entry data if found, nullptr otherwise.
+         */
+        const uint8_t* Find(const resourcesnapshottable_t* table, const uint32_t id, uint32_t* size) const
+        {
+            const auto entries = this->GetEntries(table);
+            if (entries == nullptr)
+                return nullptr;
+
+            const auto end   = entries + table->Count;
+            const auto entry = std::lower_bound(entries, end, id, [](const resourcesnapshotentry_t& e, const uint32_t v) {
+                return e.Id < v;
+            });
+
+            if (entry == end || entry->Id != id)
+                return nullptr;
+
+            if (size != nullptr)
+                *size = entry->Size;
+
+            return this->GetData(table, entry);
+        }
+
+        /**
+         * Returns a string entry by id.
+         *
+         * @param {const resourcesnapshottable_t*} table - The table.
+         * @param {uint32_t} id - The entry id.
+         * @return {const char*} The string if found, nullptr otherwise.
+         */
+        const char* FindString(const resourcesnapshottable_t* table, const uint32_t id) const
+        {
+            uint32_t size = 0;
+            const auto data = this->Find(table, id, &size);
+
+            // String entries are stored with their null terminator..
+            return data == nullptr || size == 0 || data[size - 1] != '\0' ? nullptr : (const char*)data;
+        }
+
+    private:
+        static bool IsRange(const uint64_t offset, const uint64_t size, const uint64_t limit)
+        {
+            return offset <= limit && size <= limit - offset;
+        }
+
+        bool Validate(void) const
+        {
+            const auto data = this->m_File.GetData();
+            const auto size = (uint64_t)this->m_File.GetSize();
+
+            if (size < sizeof(resourcesnapshotheader_t))
+                return false;
+
+            const auto header = (const resourcesnapshotheader_t*)data;
+            if (std::memcmp(header->Magic, "ARSS", 4) != 0 || header->Version != ResourceSnapshot::Version || header->Size != sizeof(resourcesnapshotheader_t) || header->FileSize != size)
+                return false;
+
+            if ((header->SourceOffset % ResourceSnapshot::Align) != 0 || (header->TableOffset % ResourceSnapshot::Align) != 0)
+                return false;
+            if (!IsRange(header->SourceOffset, (uint64_t)header->SourceCount * sizeof(resourcesnapshotsource_t), size))
+                return false;
+            if (!IsRange(header->TableOffset, (uint64_t)header->TableCount * sizeof(resourcesnapshottable_t), size))
+                return false;
+
+            const auto tables = (const resourcesnapshottable_t*)(data + header->TableOffset);
+            for (uint32_t x = 0; x < header->TableCount; x++)
+            {
+                const auto& t = tables[x];
+                if ((t.IndexOffset % ResourceSnapshot::Align) != 0 || !IsRange(t.IndexOffset, (uint64_t)t.Count * sizeof(resourcesnapshotentry_t), size) || !IsRange(t.DataOffset, t.DataSize, size))
+                    return false;
+                if (t.Name[sizeof(t.Name) - 1] != '\0')
+                    return false;
+
+                const auto entries = (const resourcesnapshotentry_t*)(data + t.IndexOffset);
+                for (uint32_t y = 0; y < t.Count; y++)
+                {
+                    if (!IsRange(entries[y].Offset, entries[y].Size, t.DataSize))
+                        return false;
+                    if (y > 0 && entries[y - 1].Id >= entries[y].Id)
+                        return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_RESOURCESNAPSHOT_H_INCLUDED
\ No newline at end of file
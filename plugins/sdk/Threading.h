@@ -26,12 +26,27 @@
 #pragma once
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_WIN32)
 #include <Windows.h>
 #include <eh.h>
-#include <string>
+#endif
 
 namespace Ashita::Threading
 {
+#if defined(_WIN32)
     /**
      * Implements a basic synchronization object backed by Win32 event API.
      *
@@ -148,6 +163,8 @@ namespace Ashita::Threading
         }
     };
 
+#endif // defined(_WIN32)
+
     /**
      * Thread Priority Enumeration
      */
@@ -160,6 +177,7 @@ namespace Ashita::Threading
         Highest     = 2
     };
 
+#if defined(_WIN32)
     /**
      * Implements a basic threading object. Backed by events using the above Event class object.
      *
@@ -208,7 +226,6 @@ namespace Ashita::Threading
 
             // Reset and raise the events..
             this->m_EventEnd.Reset();
-            ::Sleep(10);
             this->m_EventStart.Raise();
 
             // Run the thread..
@@ -356,6 +373,585 @@ namespace Ashita::Threading
         }
     };
 
+#endif // defined(_WIN32)
+
+    class TaskPool;
+
+    /**
+     * Task Object
+     *
+     * A move-only, type-erased callable. Holds the tasks and continuations queued on a TaskPool in place of
+     * std::function, which requires copyable callables, so tasks may capture move-only objects. (ie. a
+     * std::unique_ptr or std::promise.)
+     */
+    class Task
+    {
+        /**
+         * Callable Object
+         */
+        struct callable_t
+        {
+            virtual ~callable_t(void) = default;
+            virtual void Invoke(void) = 0;
+        };
+
+        /**
+         * Callable Implementation Object
+         */
+        template<typename F>
+        struct callableimpl_t final : callable_t
+        {
+            F Func;
+
+            template<typename U>
+            explicit callableimpl_t(U&& func)
+                : Func(std::forward<U>(func))
+            {}
+
+            void Invoke(void) override
+            {
+                this->Func();
+            }
+        };
+
+        std::unique_ptr<callable_t> m_Callable;
+
+    public:
+        Task(void) = default;
+        template<typename F, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, Task>::value>::type>
+        Task(F&& func)
+            : m_Callable(std::make_unique<callableimpl_t<typename std::decay<F>::type>>(std::forward<F>(func)))
+        {}
+
+        Task(Task&&)                 = default;
+        Task& operator=(Task&&)      = default;
+        Task(const Task&)            = delete;
+        Task& operator=(const Task&) = delete;
+
+        /**
+         * Returns if the task holds a callable.
+         *
+         * @return {bool} True if valid, false otherwise.
+         */
+        bool IsValid(void) const
+        {
+            return this->m_Callable != nullptr;
+        }
+
+        /**
+         * Invokes the task.
+         */
+        void operator()(void) const
+        {
+            this->m_Callable->Invoke();
+        }
+
+        /**
+         * Releases the held callable, and anything it captured.
+         */
+        void Reset(void)
+        {
+            this->m_Callable.reset();
+        }
+    };
+
+    /**
+     * Future State Object
+     *
+     * The shared state of a task and the futures referencing it.
+     */
+    template<typename T>
+    struct futurestate_t
+    {
+        using value_t = typename std::conditional<std::is_void<T>::value, char, T>::type;
+
+        std::mutex Mutex;
+        std::condition_variable Condition;
+        bool IsReady = false;                                  // Flag if the task has completed.
+        std::optional<value_t> Value;                          // The value of the task. (Empty if the task threw.)
+        std::exception_ptr Exception;                          // The exception thrown by the task, if any.
+        std::vector<Task> Continuations;                      // The continuations to run once the task completes.
+    };
+
+    /**
+     * Future Object
+     *
+     * References the result of a task submitted to a TaskPool.
+     *
+     * @notes
+     *
+     *      Waiting on a future from a task pool worker thread runs other queued tasks while waiting, so tasks can
+     *      wait on the tasks they submit without exhausting the pool.
+     */
+    template<typename T>
+    class Future
+    {
+        std::shared_ptr<futurestate_t<T>> m_State;
+        TaskPool* m_Pool;
+
+    public:
+        Future(void)
+            : m_Pool(nullptr)
+        {}
+        Future(std::shared_ptr<futurestate_t<T>> state, TaskPool* pool)
+            : m_State(std::move(state))
+            , m_Pool(pool)
+        {}
+
+        /**
+         * Returns if the future references a task.
+         *
+         * @return {bool} True if valid, false otherwise.
+         */
+        bool IsValid(void) const
+        {
+            return this->m_State != nullptr;
+        }
+
+        /**
+         * Returns if the task has completed.
+         *
+         * @return {bool} True if completed, false otherwise.
+         */
+        bool IsReady(void) const
+        {
+            if (this->m_State == nullptr)
+                return false;
+
+            std::lock_guard<std::mutex> lock(this->m_State->Mutex);
+            return this->m_State->IsReady;
+        }
+
+        /**
+         * Waits for the task to complete.
+         */
+        void Wait(void) const;
+
+        /**
+         * Waits for the task to complete and returns its value. (Rethrows the exception thrown by the task, if any.)
+         *
+         * @return {T} The value of the task.
+         */
+        T Get(void) const
+        {
+            this->Wait();
+
+            if (this->m_State->Exception)
+                std::rethrow_exception(this->m_State->Exception);
+
+            if constexpr (!std::is_void<T>::value)
+                return *this->m_State->Value;
+        }
+
+        /**
+         * Submits a continuation to run once the task completes.
+         *
+         * @param {F} func - The continuation. (Called with the completed future, so it can handle its exception.)
+         * @param {ThreadPriority} priority - The priority of the continuation.
+         * @return {Future} The future of the continuation.
+         */
+        template<typename F>
+        auto Then(F&& func, ThreadPriority priority = ThreadPriority::Normal) const -> Future<typename std::invoke_result<F, Future<T>>::type>;
+    };
+
+    /**
+     * Task Pool
+     *
+     * A portable pool of worker threads that plugins can submit background work to, instead of each starting
+     * their own threads.
+     *
+     * @notes
+     *
+     *      Each worker owns a work-stealing deque per priority. Tasks submitted from a worker are pushed onto its
+     *      own deque and popped in LIFO order (keeping related work on the same, cache-warm, thread); tasks from
+     *      other threads are spread over the workers round robin. Idle workers steal the oldest tasks of other
+     *      workers. Higher priority tasks are always taken before lower priority tasks.
+     *
+     *      The priority of a task only orders it within the pool; the worker threads themselves run at the
+     *      normal thread priority.
+     *
+     *      Destroying the pool runs every queued task before the workers exit.
+     */
+    class TaskPool
+    {
+        static constexpr uint32_t PriorityCount = 5;
+
+        /**
+         * Worker Queue Object
+         */
+        struct queue_t
+        {
+            std::mutex Mutex;
+            std::deque<Task> Tasks[PriorityCount]; // The queued tasks, per priority. (Lowest first.)
+        };
+
+        /**
+         * Worker Thread Information Object
+         */
+        struct worker_t
+        {
+            TaskPool* Pool; // The pool of the current thread, if it is a worker thread.
+            uint32_t Index; // The index of the current thread within its pool.
+        };
+
+        std::vector<std::unique_ptr<queue_t>> m_Queues;
+        std::vector<std::thread> m_Threads;
+        std::atomic<uint32_t> m_Next;
+        std::atomic<int64_t> m_Pending;
+        std::atomic<uint32_t> m_Sleeping;
+        std::atomic<bool> m_IsStopping;
+
+        std::mutex m_SleepMutex;
+        std::condition_variable m_SleepCondition;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param {uint32_t} threadCount - The number of worker threads. (0 to use one less than the number of cores.)
+         */
+        explicit TaskPool(uint32_t threadCount = 0)
+            : m_Next(0)
+            , m_Pending(0)
+            , m_Sleeping(0)
+            , m_IsStopping(false)
+        {
+            if (threadCount == 0)
+                threadCount = TaskPool::GetDefaultThreadCount();
+
+            for (uint32_t x = 0; x < threadCount; x++)
+                this->m_Queues.push_back(std::make_unique<queue_t>());
+            for (uint32_t x = 0; x < threadCount; x++)
+                this->m_Threads.emplace_back(&TaskPool::WorkerEntry, this, x);
+        }
+        ~TaskPool(void)
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->m_SleepMutex);
+                this->m_IsStopping = true;
+            }
+            this->m_SleepCondition.notify_all();
+
+            for (auto& t : this->m_Threads)
+                t.join();
+        }
+
+        TaskPool(const TaskPool&)            = delete;
+        TaskPool& operator=(const TaskPool&) = delete;
+
+        /**
+         * Returns the default number of worker threads. (One less than the number of cores, at least one.)
+         *
+         * @return {uint32_t} The number of threads.
+         */
+        static uint32_t GetDefaultThreadCount(void)
+        {
+            const auto cores = std::thread::hardware_concurrency();
+            return cores > 1 ? cores - 1 : 1;
+        }
+
+        /**
+         * Returns the number of worker threads configured for the cores own task pool. ([ashita.taskpool] threadcount)
+         *
+         * @param {T*} config - The configuration manager. (Any object implementing GetInt32; ie. IConfigurationManager.)
+         * @return {uint32_t} The number of threads, or the default number if not configured.
+         */
+        template<typename T>
+        static uint32_t GetConfiguredThreadCount(T* config)
+        {
+            const auto count = config == nullptr ? -1 : config->GetInt32("boot", "ashita.taskpool", "threadcount", -1);
+            return count > 0 ? (uint32_t)count : TaskPool::GetDefaultThreadCount();
+        }
+
+        /**
+         * Returns the number of worker threads.
+         *
+         * @return {uint32_t} The number of threads.
+         */
+        uint32_t GetThreadCount(void) const
+        {
+            return (uint32_t)this->m_Threads.size();
+        }
+
+        /**
+         * Returns the number of queued tasks. (Not including running tasks.)
+         *
+         * @return {uint32_t} The number of tasks.
+         */
+        uint32_t GetPendingCount(void) const
+        {
+            const auto pending = this->m_Pending.load(std::memory_order_relaxed);
+            return pending > 0 ? (uint32_t)pending : 0;
+        }
+
+        /**
+         * Returns if the calling thread is a worker thread of this pool.
+         *
+         * @return {bool} True if a worker thread, false otherwise.
+         */
+        bool IsWorkerThread(void) const
+        {
+            return TaskPool::GetWorker().Pool == this;
+        }
+
+        /**
+         * Submits a task to the pool.
+         *
+         * @param {F} func - The task function. (May be move-only.)
+         * @param {ThreadPriority} priority - The priority of the task.
+         * @return {Future} The future of the task.
+         */
+        template<typename F>
+        auto Submit(F&& func, ThreadPriority priority = ThreadPriority::Normal) -> Future<typename std::invoke_result<F>::type>
+        {
+            using result_t = typename std::invoke_result<F>::type;
+
+            auto state = std::make_shared<futurestate_t<result_t>>();
+            auto task  = [state, f = std::forward<F>(func)]() mutable {
+                TaskPool::Run(state, f);
+            };
+
+            this->Push(std::move(task), priority);
+
+            return Future<result_t>(state, this);
+        }
+
+        /**
+         * Runs a single queued task on the calling thread, if any.
+         *
+         * @return {bool} True if a task was run, false otherwise.
+         */
+        bool RunOne(void)
+        {
+            const auto& worker = TaskPool::GetWorker();
+
+            Task task;
+            if (!this->TryPop(worker.Pool == this ? worker.Index : 0, &task))
+                return false;
+
+            task();
+            return true;
+        }
+
+        /**
+         * Pushes a raw task onto the pool. (Used by Submit and continuations.)
+         *
+         * @param {Task} task - The task function.
+         * @param {ThreadPriority} priority - The priority of the task.
+         */
+        void Push(Task task, const ThreadPriority priority)
+        {
+            const auto& worker = TaskPool::GetWorker();
+            const auto index   = worker.Pool == this ? worker.Index : this->m_Next.fetch_add(1, std::memory_order_relaxed) % (uint32_t)this->m_Queues.size();
+            const auto level   = TaskPool::GetLevel(priority);
+
+            {
+                auto& queue = *this->m_Queues[index];
+                std::lock_guard<std::mutex> lock(queue.Mutex);
+                queue.Tasks[level].push_back(std::move(task));
+                this->m_Pending.fetch_add(1);
+            }
+
+            // Wake a sleeping worker, if any; taking the sleep lock orders this with a worker about to sleep..
+            if (this->m_Sleeping.load() > 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(this->m_SleepMutex);
+                }
+                this->m_SleepCondition.notify_one();
+            }
+        }
+
+        /**
+         * Completes a future state with the result of the given function.
+         *
+         * @param {std::shared_ptr} state - The future state.
+         * @param {F} func - The function to invoke.
+         */
+        template<typename R, typename F>
+        static void Run(const std::shared_ptr<futurestate_t<R>>& state, F& func)
+        {
+            std::optional<typename futurestate_t<R>::value_t> value;
+            std::exception_ptr exception;
+
+            try
+            {
+                if constexpr (std::is_void<R>::value)
+                {
+                    func();
+                    value.emplace('\0');
+                }
+                else
+                {
+                    value.emplace(func());
+                }
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+
+            std::vector<Task> continuations;
+            {
+                std::lock_guard<std::mutex> lock(state->Mutex);
+                state->Value     = std::move(value);
+                state->Exception = exception;
+                state->IsReady   = true;
+                continuations.swap(state->Continuations);
+            }
+            state->Condition.notify_all();
+
+            for (auto& c : continuations)
+                c();
+        }
+
+    private:
+        static worker_t& GetWorker(void)
+        {
+            thread_local worker_t worker{nullptr, 0};
+            return worker;
+        }
+
+        static uint32_t GetLevel(const ThreadPriority priority)
+        {
+            const auto level = (int32_t)priority - (int32_t)ThreadPriority::Lowest;
+            return level < 0 ? 0 : (level >= (int32_t)PriorityCount ? PriorityCount - 1 : (uint32_t)level);
+        }
+
+        bool TryPop(const uint32_t index, Task* task)
+        {
+            if (this->m_Pending.load(std::memory_order_acquire) <= 0)
+                return false;
+
+            const auto count = (uint32_t)this->m_Queues.size();
+
+            for (auto level = (int32_t)PriorityCount - 1; level >= 0; level--)
+            {
+                // Take the newest task of the own queue, then steal the oldest task of the other queues..
+                for (uint32_t x = 0; x < count; x++)
+                {
+                    auto& queue = *this->m_Queues[(index + x) % count];
+                    std::lock_guard<std::mutex> lock(queue.Mutex);
+
+                    auto& tasks = queue.Tasks[level];
+                    if (tasks.empty())
+                        continue;
+
+                    if (x == 0)
+                    {
+                        *task = std::move(tasks.back());
+                        tasks.pop_back();
+                    }
+                    else
+                    {
+                        *task = std::move(tasks.front());
+                        tasks.pop_front();
+                    }
+
+                    this->m_Pending.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void WorkerEntry(const uint32_t index)
+        {
+            TaskPool::GetWorker() = {this, index};
+
+            Task task;
+            for (;;)
+            {
+                if (this->TryPop(index, &task))
+                {
+                    task();
+                    task.Reset();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(this->m_SleepMutex);
+                if (this->m_IsStopping && this->m_Pending.load() <= 0)
+                    break;
+
+                // Mark the worker as sleeping before checking for work, so a pushing thread either sees the worker
+                // sleeping or the worker sees the pushed task..
+                this->m_Sleeping.fetch_add(1);
+                this->m_SleepCondition.wait(lock, [this]() {
+                    return this->m_IsStopping || this->m_Pending.load() > 0;
+                });
+                this->m_Sleeping.fetch_sub(1);
+            }
+
+            TaskPool::GetWorker() = {nullptr, 0};
+        }
+    };
+
+    template<typename T>
+    void Future<T>::Wait(void) const
+    {
+        if (this->m_State == nullptr)
+            return;
+
+        // Help run queued tasks while waiting on a worker thread, so waiting tasks cannot exhaust the pool..
+        if (this->m_Pool != nullptr && this->m_Pool->IsWorkerThread())
+        {
+            while (!this->IsReady())
+            {
+                if (!this->m_Pool->RunOne())
+                {
+                    std::unique_lock<std::mutex> lock(this->m_State->Mutex);
+                    this->m_State->Condition.wait_for(lock, std::chrono::milliseconds(1), [this]() {
+                        return this->m_State->IsReady;
+                    });
+                }
+            }
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(this->m_State->Mutex);
+        this->m_State->Condition.wait(lock, [this]() {
+            return this->m_State->IsReady;
+        });
+    }
+
+    template<typename T>
+    template<typename F>
+    auto Future<T>::Then(F&& func, ThreadPriority priority) const -> Future<typename std::invoke_result<F, Future<T>>::type>
+    {
+        using result_t = typename std::invoke_result<F, Future<T>>::type;
+
+        if (this->m_State == nullptr || this->m_Pool == nullptr)
+            return Future<result_t>();
+
+        auto next = std::make_shared<futurestate_t<result_t>>();
+
+        const auto self = *this;
+        auto pool       = this->m_Pool;
+        auto submit     = [self, next, pool, priority, f = std::forward<F>(func)]() mutable {
+            auto task = [self, next, f = std::move(f)]() mutable {
+                auto call = [&self, &f]() {
+                    return f(self);
+                };
+                TaskPool::Run(next, call);
+            };
+
+            pool->Push(std::move(task), priority);
+        };
+
+        // Submit the continuation now if the task already completed, otherwise once it does..
+        {
+            std::unique_lock<std::mutex> lock(this->m_State->Mutex);
+            if (!this->m_State->IsReady)
+            {
+                this->m_State->Continuations.push_back(std::move(submit));
+                return Future<result_t>(next, pool);
+            }
+        }
+
+        submit();
+        return Future<result_t>(next, pool);
+    }
 } // namespace Ashita::Threading
 
 #endif // ASHITA_SDK_THREADING_H_INCLUDED
\ No newline at end of file
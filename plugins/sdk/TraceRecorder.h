@@ -0,0 +1,465 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_TRACERECORDER_H_INCLUDED
+#define ASHITA_SDK_TRACERECORDER_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
+
+namespace Ashita
+{
+    /**
+     * Trace Event Object
+     *
+     * A span read back from a trace recorder.
+     */
+    struct traceevent_t
+    {
+        uint64_t Start;    // The start time of the span, in nanoseconds. (See: TraceRecorder::Now)
+        uint64_t Duration; // The duration of the span, in nanoseconds.
+        uint64_t Arg;      // The argument of the span. (ie. the packet id.) TraceRecorder::NoArg if not set.
+        uint32_t Name;     // The name id of the span.
+        uint32_t Thread;   // The id of the thread the span was recorded on.
+    };
+
+    /**
+     * Trace Recorder
+     *
+     * Records timed spans (ie. plugin callbacks) into a fixed size ring buffer, so the last few seconds of
+     * activity can be dumped to a Chrome trace file when the client hitches. Trace files can be opened with
+     * chrome://tracing or https://ui.perfetto.dev/
+     *
+     * @notes
+     *
+     *      Recording is lock-free and wait-free: a span claims a slot with a single atomic increment and
+     *      publishes it with a per-slot sequence number. (A seqlock.) Reading the buffer never blocks the
+     *      recording threads; spans being overwritten while they are read are skipped.
+     *
+     *      Span names are registered once, up front, and referenced by id when recording. The names of the
+     *      plugin callbacks are registered by default. (See: TraceRecorder::EventIncomingPacket, etc.)
+     *
+     *      Times are taken from the steady clock since its epoch, which on Windows is the performance counter.
+     *      This is the same clock used by the addon profiler library, so plugin and addon traces line up.
+     */
+    class TraceRecorder
+    {
+    public:
+        static constexpr uint32_t InvalidName = 0xFFFFFFFF; // The name id returned on failure.
+        static constexpr uint64_t NoArg       = UINT64_MAX; // The argument of spans without one.
+
+        static constexpr uint32_t EventIncomingPacket = 0; // The name id of IPlugin::HandleIncomingPacket.
+        static constexpr uint32_t EventOutgoingPacket = 1; // The name id of IPlugin::HandleOutgoingPacket.
+        static constexpr uint32_t EventIncomingText   = 2; // The name id of IPlugin::HandleIncomingText.
+        static constexpr uint32_t EventOutgoingText   = 3; // The name id of IPlugin::HandleOutgoingText.
+        static constexpr uint32_t EventCommand        = 4; // The name id of IPlugin::HandleCommand.
+        static constexpr uint32_t EventPluginEvent    = 5; // The name id of IPlugin::HandleEvent.
+        static constexpr uint32_t EventBeginScene     = 6; // The name id of IPlugin::Direct3DBeginScene.
+        static constexpr uint32_t EventEndScene       = 7; // The name id of IPlugin::Direct3DEndScene.
+        static constexpr uint32_t EventPresent        = 8; // The name id of IPlugin::Direct3DPresent.
+
+    private:
+        /**
+         * Ring Buffer Slot Object
+         *
+         * The sequence of a slot is odd while the slot is being written, and (index + 1) * 2 once the span
+         * with the given ring index is published.
+         */
+        struct slot_t
+        {
+            std::atomic<uint64_t> Sequence;
+            std::atomic<uint64_t> Start;
+            std::atomic<uint64_t> Duration;
+            std::atomic<uint64_t> Arg;
+            std::atomic<uint64_t> Info; // The name id (low) and thread id (high) of the span.
+        };
+
+        /**
+         * Span Name Object
+         */
+        struct name_t
+        {
+            std::string Name;     // The span name.
+            std::string Category; // The span category.
+        };
+
+        std::unique_ptr<slot_t[]> m_Slots;
+        uint64_t m_Mask;
+        std::atomic<uint64_t> m_Head;
+        std::atomic<bool> m_IsEnabled;
+
+        mutable std::mutex m_Mutex; // Guards the names; only taken when registering names and reading the buffer.
+        std::vector<name_t> m_Names;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param {uint32_t} capacity - The number of spans to keep. (Rounded up to a power of two.)
+         */
+        explicit TraceRecorder(const uint32_t capacity = 65536)
+            : m_Mask(0)
+            , m_Head(0)
+            , m_IsEnabled(true)
+        {
+            uint64_t size = 1024;
+            while (size < capacity)
+                size <<= 1;
+
+            this->m_Slots.reset(new slot_t[size]);
+            this->m_Mask = size - 1;
+
+            for (uint64_t x = 0; x < size; x++)
+                this->m_Slots[x].Sequence.store(0, std::memory_order_relaxed);
+
+            this->Register("HandleIncomingPacket", "packet");
+            this->Register("HandleOutgoingPacket", "packet");
+            this->Register("HandleIncomingText", "text");
+            this->Register("HandleOutgoingText", "text");
+            this->Register("HandleCommand", "command");
+            this->Register("HandleEvent", "event");
+            this->Register("Direct3DBeginScene", "d3d");
+            this->Register("Direct3DEndScene", "d3d");
+            this->Register("Direct3DPresent", "d3d");
+        }
+
+        TraceRecorder(const TraceRecorder&)            = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+        /**
+         * Returns the current time of the trace clock.
+         *
+         * @return {uint64_t} The time, in nanoseconds.
+         */
+        static uint64_t Now(void)
+        {
+            return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * Returns the id of the calling thread.
+         *
+         * @return {uint32_t} The thread id.
+         */
+        static uint32_t GetThreadId(void)
+        {
+#if defined(_WIN32)
+            return (uint32_t)::GetCurrentThreadId();
+#else
+            return (uint32_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+#endif
+        }
+
+        /**
+         * Returns the number of spans the recorder keeps.
+         *
+         * @return {uint32_t} The capacity.
+         */
+        uint32_t GetCapacity(void) const
+        {
+            return (uint32_t)(this->m_Mask + 1);
+        }
+
+        /**
+         * Sets if the recorder records spans.
+         *
+         * @param {bool} enabled - The enabled state.
+         */
+        void SetEnabled(const bool enabled)
+        {
+            this->m_IsEnabled.store(enabled, std::memory_order_relaxed);
+        }
+
+        /**
+         * Returns if the recorder records spans.
+         *
+         * @return {bool} True if enabled, false otherwise.
+         */
+        bool GetEnabled(void) const
+        {
+            return this->m_IsEnabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Registers a span name, or returns the id of the name already registered.
+         *
+         * @param {const char*} name - The span name.
+         * @param {const char*} category - The span category. (Optional.)
+         * @return {uint32_t} The name id on success, TraceRecorder::InvalidName otherwise.
+         */
+        uint32_t Register(const char* name, const char* category = nullptr)
+        {
+            if (name == nullptr)
+                return InvalidName;
+
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            for (uint32_t x = 0; x < (uint32_t)this->m_Names.size(); x++)
+            {
+                if (this->m_Names[x].Name == name)
+                    return x;
+            }
+
+            this->m_Names.push_back({name, category == nullptr ? "" : category});
+            return (uint32_t)this->m_Names.size() - 1;
+        }
+
+        /**
+         * Records a span.
+         *
+         * @param {uint32_t} name - The name id of the span.
+         * @param {uint64_t} start - The start time of the span. (See: Now)
+         * @param {uint64_t} end - The end time of the span. (See: Now)
+         * @param {uint64_t} arg - The argument of the span. (Optional.)
+         */
+        void Record(const uint32_t name, const uint64_t start, const uint64_t end, const uint64_t arg = NoArg)
+        {
+            if (!this->m_IsEnabled.load(std::memory_order_relaxed))
+                return;
+
+            const auto index = this->m_Head.fetch_add(1, std::memory_order_relaxed);
+            auto& slot       = this->m_Slots[index & this->m_Mask];
+
+            slot.Sequence.store(index * 2 + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            slot.Start.store(start, std::memory_order_relaxed);
+            slot.Duration.store(end > start ? end - start : 0, std::memory_order_relaxed);
+            slot.Arg.store(arg, std::memory_order_relaxed);
+            slot.Info.store(((uint64_t)TraceRecorder::GetThreadId() << 32) | name, std::memory_order_relaxed);
+
+            slot.Sequence.store(index * 2 + 2, std::memory_order_release);
+        }
+
+        /**
+         * Returns the total number of spans recorded. (Including spans since overwritten.)
+         *
+         * @return {uint64_t} The number of spans.
+         */
+        uint64_t GetRecordedCount(void) const
+        {
+            return this->m_Head.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Reads the spans of the ring buffer that end at or after the given time.
+         *
+         * @param {uint64_t} since - The time to read spans from. (See: Now)
+         * @param {std::vector<traceevent_t>*} events - The vector to fill with the spans, ordered by start time.
+         */
+        void Read(const uint64_t since, std::vector<traceevent_t>* events) const
+        {
+            if (events == nullptr)
+                return;
+
+            events->clear();
+
+            const auto head  = this->m_Head.load(std::memory_order_acquire);
+            const auto first = head > this->m_Mask + 1 ? head - (this->m_Mask + 1) : 0;
+
+            for (auto index = first; index < head; index++)
+            {
+                const auto& slot = this->m_Slots[index & this->m_Mask];
+
+                const auto seq = slot.Sequence.load(std::memory_order_acquire);
+                if (seq != index * 2 + 2)
+                    continue;
+
+                traceevent_t e{};
+                e.Start       = slot.Start.load(std::memory_order_relaxed);
+                e.Duration    = slot.Duration.load(std::memory_order_relaxed);
+                e.Arg         = slot.Arg.load(std::memory_order_relaxed);
+                const auto in = slot.Info.load(std::memory_order_relaxed);
+
+                // Skip the span if it was overwritten while being read..
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.Sequence.load(std::memory_order_relaxed) != seq)
+                    continue;
+
+                e.Name   = (uint32_t)in;
+                e.Thread = (uint32_t)(in >> 32);
+
+                if (e.Start + e.Duration >= since)
+                    events->push_back(e);
+            }
+
+            std::sort(events->begin(), events->end(), [](const traceevent_t& a, const traceevent_t& b) {
+                return a.Start < b.Start;
+            });
+        }
+
+        /**
+         * Returns the spans of the last given number of seconds as Chrome trace JSON.
+         *
+         * @param {double} seconds - The number of seconds to include.
+         * @return {std::string} The trace JSON.
+         */
+        std::string GetChromeTrace(const double seconds) const
+        {
+            const auto now   = TraceRecorder::Now();
+            const auto range = (uint64_t)(std::max(seconds, 0.0) * 1000000000.0);
+
+            std::vector<traceevent_t> events;
+            this->Read(now > range ? now - range : 0, &events);
+
+            std::vector<name_t> names;
+            {
+                std::lock_guard<std::mutex> lock(this->m_Mutex);
+                names = this->m_Names;
+            }
+
+            std::string ret;
+            ret.reserve(events.size() * 128 + 64);
+            ret += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+            char buffer[256]{};
+            for (size_t x = 0; x < events.size(); x++)
+            {
+                const auto& e = events[x];
+                const auto n  = e.Name < names.size() ? &names[e.Name] : nullptr;
+
+                ret += x == 0 ? "\n{\"name\":\"" : ",\n{\"name\":\"";
+                TraceRecorder::AppendEscaped(&ret, n == nullptr ? "unknown" : n->Name);
+                ret += "\",\"cat\":\"";
+                TraceRecorder::AppendEscaped(&ret, n == nullptr || n->Category.empty() ? "plugin" : n->Category);
+
+                ::snprintf(buffer, sizeof(buffer), "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f", e.Thread, static_cast<double>(e.Start) / 1000.0, static_cast<double>(e.Duration) / 1000.0);
+                ret += buffer;
+
+                if (e.Arg != NoArg)
+                {
+                    ::snprintf(buffer, sizeof(buffer), ",\"args\":{\"arg\":%" PRIu64 "}", e.Arg);
+                    ret += buffer;
+                }
+
+                ret += "}";
+            }
+
+            ret += "\n]}\n";
+            return ret;
+        }
+
+        /**
+         * Writes the spans of the last given number of seconds to a Chrome trace file.
+         *
+         * @param {const char*} path - The path to the trace file.
+         * @param {double} seconds - The number of seconds to include.
+         * @return {bool} True on success, false otherwise.
+         */
+        bool WriteChromeTrace(const char* path, const double seconds) const
+        {
+            if (path == nullptr)
+                return false;
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+                return false;
+
+            const auto json = this->GetChromeTrace(seconds);
+            file.write(json.data(), (std::streamsize)json.size());
+
+            return file.good();
+        }
+
+    private:
+        static void AppendEscaped(std::string* out, const std::string& str)
+        {
+            for (const auto c : str)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    out->push_back('\\');
+                    out->push_back(c);
+                }
+                else if ((uint8_t)c < 0x20)
+                {
+                    char buffer[8]{};
+                    ::snprintf(buffer, sizeof(buffer), "\\u%04x", (uint32_t)(uint8_t)c);
+                    out->append(buffer);
+                }
+                else
+                {
+                    out->push_back(c);
+                }
+            }
+        }
+    };
+
+    /**
+     * Trace Scope
+     *
+     * Records a span for the lifetime of the scope object.
+     *
+     * @notes
+     *
+     *      Example usage:
+     *
+     *          bool HandleIncomingPacket(uint16_t id, ...)
+     *          {
+     *              Ashita::TraceScope scope(&this->m_Trace, Ashita::TraceRecorder::EventIncomingPacket, id);
+     *              ...
+     *          }
+     */
+    class TraceScope
+    {
+        TraceRecorder* m_Recorder;
+        uint32_t m_Name;
+        uint64_t m_Arg;
+        uint64_t m_Start;
+
+    public:
+        TraceScope(TraceRecorder* recorder, const uint32_t name, const uint64_t arg = TraceRecorder::NoArg)
+            : m_Recorder(recorder)
+            , m_Name(name)
+            , m_Arg(arg)
+            , m_Start(TraceRecorder::Now())
+        {}
+        ~TraceScope(void)
+        {
+            if (this->m_Recorder != nullptr)
+                this->m_Recorder->Record(this->m_Name, this->m_Start, TraceRecorder::Now(), this->m_Arg);
+        }
+
+        TraceScope(const TraceScope&)            = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_TRACERECORDER_H_INCLUDED
\ No newline at end of file
@@ -0,0 +1,421 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASHITA_SDK_ZONEASSETCACHE_H_INCLUDED
+#define ASHITA_SDK_ZONEASSETCACHE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "DatFileSystem.h"
+#include "Threading.h"
+
+namespace Ashita
+{
+    /**
+     * Zone Npc Entry
+     *
+     * An entry of a zones npc list DAT.
+     */
+    struct zonenpc_t
+    {
+        uint32_t Id;   // The npc server id.
+        char Name[29]; // The npc name. (Null terminated.)
+
+        /**
+         * Returns the npc entity (target) index.
+         *
+         * @return {uint16_t} The entity index.
+         */
+        uint16_t GetIndex(void) const
+        {
+            return (uint16_t)(this->Id & 0x0FFF);
+        }
+    };
+
+    /**
+     * Zone Assets
+     *
+     * The parsed assets of a zone.
+     */
+    struct zoneassets_t
+    {
+        uint16_t ZoneId;                // The zone id.
+        uint16_t SubId;                 // The zone sub id.
+        std::vector<zonenpc_t> Npcs;    // The zones npc list.
+        std::vector<DatFileView> Files; // The mapped views of the additional DATs of the zone. (See: ZoneAssetCache::SetResolver)
+    };
+
+    /**
+     * Zone Asset Cache
+     *
+     * Loads and caches the parsed assets (npc list and any additional DATs, ie. map data) of zones on a task
+     * pool, so they are ready when the zone is entered instead of being read on the game thread while the client
+     * is loading the zone.
+     *
+     * @notes
+     *
+     *      Incoming packets are passed to HandleIncomingPacket:
+     *
+     *          - Zone Exit (0x000B): Prefetches the zones most recently entered from the current zone. The packet
+     *            does not hold the destination zone, so the likely destinations are learned from the zone changes
+     *            seen this session.
+     *          - Zone Enter (0x000A): Records the zone change and loads the entered zones assets, if they are not
+     *            already cached or loading.
+     *
+     *      Assets are cached per zone id and sub id; the least recently used zones are dropped once the cache is
+     *      full. Get returns the assets of a zone, waiting for them if they are still loading. Zones whose npc list
+     *      cannot be loaded are not cached, so they are retried on the next request.
+     *
+     *      The cache is thread-safe. The DAT file system and task pool must outlive the cache.
+     */
+    class ZoneAssetCache
+    {
+    public:
+        typedef std::shared_ptr<const zoneassets_t> assets_t;
+        typedef std::function<void(uint16_t zoneId, uint16_t subId, std::vector<uint32_t>* fileIds)> resolver_f;
+
+        static constexpr uint32_t MaxTransitions = 3; // The number of destinations remembered per zone.
+
+    private:
+        typedef std::pair<uint32_t, Threading::Future<assets_t>> entry_t;
+
+        DatFileSystem* m_FileSystem;
+        Threading::TaskPool* m_Pool;
+        uint32_t m_MaxZones;
+        resolver_f m_Resolver;
+
+        mutable std::mutex m_Mutex;
+        std::list<entry_t> m_Entries; // The cached zones, most recently used first.
+        std::unordered_map<uint32_t, std::list<entry_t>::iterator> m_Lookup;
+        std::unordered_map<uint32_t, std::vector<uint32_t>> m_Transitions; // The zones entered from each zone, most recent first.
+        uint32_t m_Current;                                                 // The current zone key. (0xFFFFFFFF if unknown.)
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param {DatFileSystem*} fs - The DAT file system to read from.
+         * @param {Threading::TaskPool*} pool - The task pool to load on.
+         * @param {uint32_t} maxZones - The maximum number of cached zones.
+         */
+        ZoneAssetCache(DatFileSystem* fs, Threading::TaskPool* pool, const uint32_t maxZones = 8)
+            : m_FileSystem(fs)
+            , m_Pool(pool)
+            , m_MaxZones(std::max(maxZones, 1u))
+            , m_Current(0xFFFFFFFF)
+        {}
+
+        ZoneAssetCache(const ZoneAssetCache&)            = delete;
+        ZoneAssetCache& operator=(const ZoneAssetCache&) = delete;
+
+        /**
+         * Returns the DAT file id of the given zones npc list.
+         *
+         * @param {uint16_t} zoneId - The zone id. (Zone Enter (0x000A) offset 0x30.)
+         * @param {uint16_t} subId - The zone sub id. (Zone Enter (0x000A) offset 0x9E.)
+         * @return {uint32_t} The DAT file id.
+         */
+        static uint32_t GetNpcListFileId(const uint16_t zoneId, const uint16_t subId)
+        {
+            if (subId < 1000 || subId > 1299)
+                return zoneId < 256 ? zoneId + 6720 : zoneId + 86235;
+
+            return subId + 66911;
+        }
+
+        /**
+         * Sets the function returning the additional DATs to load for a zone. (ie. the zones map DATs.)
+         *
+         * @param {resolver_f} resolver - The resolver function. (Called on the task pool.)
+         */
+        void SetResolver(resolver_f resolver)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            this->m_Resolver = std::move(resolver);
+        }
+
+        /**
+         * Starts loading the assets of a zone, if they are not already cached or loading.
+         *
+         * @param {uint16_t} zoneId - The zone id.
+         * @param {uint16_t} subId - The zone sub id.
+         */
+        void Prefetch(const uint16_t zoneId, const uint16_t subId)
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+            this->Request(zoneId, subId);
+        }
+
+        /**
+         * Returns the assets of a zone, loading them if needed. (Waits for the assets if they are loading.)
+         *
+         * @param {uint16_t} zoneId - The zone id.
+         * @param {uint16_t} subId - The zone sub id.
+         * @return {assets_t} The zone assets, nullptr if the zones npc list could not be loaded.
+         *
+         * @notes
+         *
+         *      Failed loads are not cached; the next request for the zone loads it again.
+         */
+        assets_t Get(const uint16_t zoneId, const uint16_t subId)
+        {
+            Threading::Future<assets_t> future;
+            {
+                std::lock_guard<std::mutex> lock(this->m_Mutex);
+                future = this->Request(zoneId, subId);
+            }
+
+            if (!future.IsValid())
+                return nullptr;
+
+            future.Wait();
+            if (ZoneAssetCache::IsFailed(future))
+            {
+                std::lock_guard<std::mutex> lock(this->m_Mutex);
+                this->EraseFailed(ZoneAssetCache::GetKey(zoneId, subId));
+                return nullptr;
+            }
+
+            return future.Get();
+        }
+
+        /**
+         * Returns the assets of a zone, only if they are cached and loaded.
+         *
+         * @param {uint16_t} zoneId - The zone id.
+         * @param {uint16_t} subId - The zone sub id.
+         * @return {assets_t} The zone assets if loaded, nullptr otherwise.
+         */
+        assets_t TryGet(const uint16_t zoneId, const uint16_t subId) const
+        {
+            std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+            const auto iter = this->m_Lookup.find(ZoneAssetCache::GetKey(zoneId, subId));
+            if (iter == this->m_Lookup.end() || !iter->second->second.IsReady() || ZoneAssetCache::IsFailed(iter->second->second))
+                return nullptr;
+
+            return iter->second->second.Get();
+        }
+
+        /**
+         * Returns the assets of the current zone. (Waits for the assets if they are loading.)
+         *
+         * @return {assets_t} The zone assets, nullptr if the current zone is unknown.
+         */
+        assets_t GetCurrent(void)
+        {
+            uint32_t current = 0;
+            {
+                std::lock_guard<std::mutex> lock(this->m_Mutex);
+                current = this->m_Current;
+            }
+
+            return current == 0xFFFFFFFF ? nullptr : this->Get((uint16_t)(current >> 16), (uint16_t)current);
+        }
+
+        /**
+         * Updates the cache from an incoming packet.
+         *
+         * @param {uint16_t} id - The packet id.
+         * @param {uint32_t} size - The size of the packet data.
+         * @param {const uint8_t*} data - The packet data.
+         */
+        void HandleIncomingPacket(const uint16_t id, const uint32_t size, const uint8_t* data)
+        {
+            if (data == nullptr)
+                return;
+
+            switch (id)
+            {
+                // Packet: Zone Enter
+                case 0x000A:
+                {
+                    if (size < 0xA0 || data[0x80] == 1)
+                        break;
+
+                    uint16_t zoneId = 0;
+                    uint16_t subId  = 0;
+                    std::memcpy(&zoneId, data + 0x30, sizeof(zoneId));
+                    std::memcpy(&subId, data + 0x9E, sizeof(subId));
+
+                    const auto key = ZoneAssetCache::GetKey(zoneId, subId);
+
+                    std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+                    // Remember the zone change, most recent destination first..
+                    if (this->m_Current != 0xFFFFFFFF && this->m_Current != key)
+                    {
+                        auto& dests = this->m_Transitions[this->m_Current];
+                        dests.erase(std::remove(dests.begin(), dests.end(), key), dests.end());
+                        dests.insert(dests.begin(), key);
+                        if (dests.size() > MaxTransitions)
+                            dests.pop_back();
+                    }
+
+                    this->m_Current = key;
+                    this->Request(zoneId, subId);
+                    break;
+                }
+
+                // Packet: Zone Exit
+                case 0x000B:
+                {
+                    // Ignore logouts..
+                    if (size < 0x05 || data[0x04] == 1)
+                        break;
+
+                    std::lock_guard<std::mutex> lock(this->m_Mutex);
+
+                    const auto iter = this->m_Transitions.find(this->m_Current);
+                    if (iter == this->m_Transitions.end())
+                        break;
+
+                    // Prefetch in reverse so the most likely destination is the most recently used..
+                    for (auto it = iter->second.rbegin(); it != iter->second.rend(); ++it)
+                        this->Request((uint16_t)(*it >> 16), (uint16_t)*it);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+    private:
+        static uint32_t GetKey(const uint16_t zoneId, const uint16_t subId)
+        {
+            return ((uint32_t)zoneId << 16) | subId;
+        }
+
+        static bool IsFailed(const Threading::Future<assets_t>& future)
+        {
+            if (!future.IsReady())
+                return false;
+
+            try
+            {
+                return future.Get() == nullptr;
+            }
+            catch (...)
+            {
+                return true;
+            }
+        }
+
+        void EraseFailed(const uint32_t key)
+        {
+            const auto iter = this->m_Lookup.find(key);
+            if (iter == this->m_Lookup.end() || !ZoneAssetCache::IsFailed(iter->second->second))
+                return;
+
+            this->m_Entries.erase(iter->second);
+            this->m_Lookup.erase(iter);
+        }
+
+        Threading::Future<assets_t> Request(const uint16_t zoneId, const uint16_t subId)
+        {
+            const auto key = ZoneAssetCache::GetKey(zoneId, subId);
+
+            // Drop a previously failed load so it is retried..
+            this->EraseFailed(key);
+
+            const auto iter = this->m_Lookup.find(key);
+            if (iter != this->m_Lookup.end())
+            {
+                this->m_Entries.splice(this->m_Entries.begin(), this->m_Entries, iter->second);
+                return iter->second->second;
+            }
+
+            if (this->m_FileSystem == nullptr || this->m_Pool == nullptr)
+                return Threading::Future<assets_t>();
+
+            auto fs       = this->m_FileSystem;
+            auto resolver = this->m_Resolver;
+            auto future   = this->m_Pool->Submit([fs, resolver, zoneId, subId]() {
+                return ZoneAssetCache::Load(fs, resolver, zoneId, subId);
+            });
+
+            this->m_Entries.emplace_front(key, future);
+            this->m_Lookup[key] = this->m_Entries.begin();
+
+            while (this->m_Entries.size() > this->m_MaxZones)
+            {
+                this->m_Lookup.erase(this->m_Entries.back().first);
+                this->m_Entries.pop_back();
+            }
+
+            return future;
+        }
+
+        static assets_t Load(DatFileSystem* fs, const resolver_f& resolver, const uint16_t zoneId, const uint16_t subId)
+        {
+            // Parse the npc list; each entry is a 28 byte name followed by the npc server id..
+            const auto view = fs->GetFileView(ZoneAssetCache::GetNpcListFileId(zoneId, subId));
+            if (!view.IsValid() || (view.GetSize() % 0x20) != 0)
+                return nullptr;
+
+            auto assets    = std::make_shared<zoneassets_t>();
+            assets->ZoneId = zoneId;
+            assets->SubId  = subId;
+            assets->Npcs.resize(view.GetSize() / 0x20);
+
+            for (size_t x = 0; x < assets->Npcs.size(); x++)
+            {
+                auto& npc         = assets->Npcs[x];
+                const auto record = view.GetData() + x * 0x20;
+
+                std::memcpy(npc.Name, record, 28);
+                std::memcpy(&npc.Id, record + 28, sizeof(npc.Id));
+                npc.Name[28] = '\0';
+            }
+
+            if (resolver)
+            {
+                std::vector<uint32_t> fileIds;
+                resolver(zoneId, subId, &fileIds);
+
+                for (const auto fileId : fileIds)
+                {
+                    auto file = fs->GetFileView(fileId);
+                    if (file.IsValid())
+                        assets->Files.push_back(std::move(file));
+                }
+            }
+
+            return assets;
+        }
+    };
+
+} // namespace Ashita
+
+#endif // ASHITA_SDK_ZONEASSETCACHE_H_INCLUDED
\ No newline at end of file
@@ -0,0 +1,279 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Font Atlas Tests
+ *
+ * Tests the font atlas (FontAtlas.h) with a stub rasterizer: skyline packing until a page overflows, glyphs
+ * spilling onto new pages and clearing the atlas once every page is full, glyphs larger than a page, and the
+ * UTF-8 decoding and draw call merging of glyph batches.
+ *
+ * Build: (From this directory.)
+ *
+ *      g++ -std=c++17 -O2 FontAtlasTests.cpp -o FontAtlasTests
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "../FontAtlas.h"
+
+using Ashita::AtlasPacker;
+using Ashita::FontAtlas;
+using Ashita::GlyphBatch;
+
+static int32_t g_Failures = 0;
+
+/**
+ * Reports the result of a check.
+ *
+ * @param {bool} passed - Flag if the check passed.
+ * @param {const char*} name - The name of the check.
+ */
+void Check(const bool passed, const char* name)
+{
+    std::printf("[%s] %s\n", passed ? " OK " : "FAIL", name);
+    if (!passed)
+        g_Failures++;
+}
+
+/**
+ * Stub Rasterizer
+ *
+ * Rasterizes every glyph as a solid block of the low byte of its codepoint. 'W' is 100 pixels wide, ' ' is
+ * blank and '!' returns a bitmap missing its pixels. Every requested codepoint is recorded.
+ */
+struct StubRasterizer
+{
+    uint32_t Size = 16;
+    std::vector<uint32_t> Requested;
+
+    bool operator()(const Ashita::fontkey_t& font, const uint32_t codepoint, Ashita::glyphbitmap_t* bitmap)
+    {
+        (void)font;
+
+        this->Requested.push_back(codepoint);
+
+        bitmap->Advance = 10.0f;
+        if (codepoint == ' ')
+            return true;
+
+        bitmap->Width  = codepoint == 'W' ? 100 : this->Size;
+        bitmap->Height = this->Size;
+        if (codepoint != '!')
+            bitmap->Pixels.assign((size_t)bitmap->Width * bitmap->Height, (uint8_t)codepoint);
+
+        return true;
+    }
+};
+
+/**
+ * Returns the stats of an atlas.
+ */
+Ashita::fontatlasstats_t GetStats(const FontAtlas& atlas)
+{
+    Ashita::fontatlasstats_t stats{};
+    atlas.GetStats(&stats);
+    return stats;
+}
+
+/**
+ * Returns the codepoints decoded from the given text, in order.
+ */
+std::vector<uint32_t> Decode(const char* text)
+{
+    StubRasterizer raster;
+    FontAtlas atlas(std::ref(raster), 64, 1, 0);
+    GlyphBatch batch(&atlas);
+    batch.AddText(atlas.GetFont({"Arial", 16, 0, 0}), 0.0f, 0.0f, text, 0xFFFFFFFF);
+    return raster.Requested;
+}
+
+void TestPacker(void)
+{
+    // Equal rectangles fill the page exactly, then overflow..
+    AtlasPacker packer(64, 64);
+
+    std::vector<uint8_t> used(64 * 64, 0);
+    auto overlaps = false;
+    auto packed   = 0;
+
+    uint32_t x = 0, y = 0;
+    while (packer.Pack(8, 8, &x, &y))
+    {
+        for (uint32_t row = y; row < y + 8; row++)
+            for (uint32_t col = x; col < x + 8; col++)
+                overlaps |= used[row * 64 + col]++ != 0;
+        packed++;
+    }
+
+    Check(packed == 64 && !overlaps, "equal rectangles fill the page without overlapping");
+    Check(packer.GetOccupancy() == 1.0f, "full page occupancy");
+    Check(!packer.Pack(1, 1, &x, &y), "full page rejects more rectangles");
+
+    packer.Reset();
+    Check(packer.GetOccupancy() == 0.0f && packer.Pack(64, 64, &x, &y) && x == 0 && y == 0, "reset page fits a page sized rectangle");
+    Check(!AtlasPacker(64, 64).Pack(65, 1, &x, &y) && !AtlasPacker(64, 64).Pack(1, 65, &x, &y), "rectangles larger than the page are rejected");
+    Check(!packer.Pack(0, 8, &x, &y), "empty rectangles are rejected");
+
+    // Glyph sized rectangles pack tightly and stay in bounds until the page overflows..
+    std::mt19937 rng(0x464F4E54);
+    AtlasPacker mixed(256, 256);
+    std::vector<uint8_t> cover(256 * 256, 0);
+
+    overlaps     = false;
+    auto inside  = true;
+    auto area    = (uint64_t)0;
+    auto failed  = 0;
+    while (failed < 16)
+    {
+        const auto w = 6 + rng() % 12;
+        const auto h = 14 + rng() % 6;
+        if (!mixed.Pack(w, h, &x, &y))
+        {
+            failed++;
+            continue;
+        }
+
+        inside &= x + w <= 256 && y + h <= 256;
+        for (uint32_t row = y; row < y + h && row < 256; row++)
+            for (uint32_t col = x; col < x + w && col < 256; col++)
+                overlaps |= cover[row * 256 + col]++ != 0;
+        area += (uint64_t)w * h;
+    }
+
+    std::printf("       mixed occupancy: %.3f\n", mixed.GetOccupancy());
+    Check(inside && !overlaps, "mixed rectangles stay in bounds without overlapping");
+    Check(mixed.GetOccupancy() == (float)((double)area / (256.0 * 256.0)) && mixed.GetOccupancy() > 0.85f, "mixed rectangles pack tightly");
+}
+
+void TestAtlas(void)
+{
+    StubRasterizer raster;
+    FontAtlas atlas(std::ref(raster), 64, 2, 0);
+    const auto font = atlas.GetFont({"Arial", 16, 0, 0});
+    Check(atlas.GetFont({"Arial", 16, 0, 0}) == font && atlas.GetFont({"Arial", 16, 1, 0}) != font, "fonts are keyed by their settings");
+
+    // Each page holds 16 glyphs..
+    const Ashita::glyph_t* g = nullptr;
+    for (uint32_t cp = 0x100; cp < 0x110; cp++)
+        g = atlas.GetGlyph(font, cp);
+    Check(g != nullptr && g->Page == 0 && atlas.GetPageCount() == 1, "first page fills");
+
+    g = atlas.GetGlyph(font, 0x110);
+    Check(g != nullptr && g->Page == 1 && atlas.GetPageCount() == 2, "glyphs overflow onto a new page");
+
+    // The glyph pixels are copied to the location of its texture coordinates..
+    const auto page = atlas.GetPage(1);
+    const auto px   = (uint32_t)(g->U0 * 64.0f);
+    const auto py   = (uint32_t)(g->V0 * 64.0f);
+    Check(page != nullptr && page->Pixels[(py + 15) * 64 + px + 15] == 0x10 && g->U1 - g->U0 == 0.25f, "glyph pixels and coordinates");
+    Check(page != nullptr && page->GetIsDirty() && page->DirtyRight - page->DirtyLeft == 16 && page->DirtyBottom - page->DirtyTop == 16, "page tracks the changed area");
+
+    atlas.ClearPageDirty(1);
+    Check(!atlas.GetPage(1)->GetIsDirty(), "uploaded page is clean");
+
+    const auto requested = raster.Requested.size();
+    Check(atlas.GetGlyph(font, 0x110) == g && raster.Requested.size() == requested, "glyphs are rasterized once");
+
+    for (uint32_t cp = 0x111; cp < 0x120; cp++)
+        atlas.GetGlyph(font, cp);
+    Check(atlas.GetGeneration() == 0 && GetStats(atlas).Clears == 0, "both pages fill");
+
+    // Every page is full; the atlas is cleared and the glyph placed into the fresh atlas..
+    g = atlas.GetGlyph(font, 0x120);
+    Check(g != nullptr && g->Page == 0 && atlas.GetPageCount() == 1, "glyph is placed after clearing the full atlas");
+    Check(atlas.GetGeneration() == 1 && GetStats(atlas).Clears == 1, "clearing increments the generation");
+    Check(atlas.GetGlyph(font, 0x100) != nullptr && raster.Requested.back() == 0x100, "cleared glyphs are rasterized again");
+    Check(GetStats(atlas).Rasterized == 34, "rasterized glyphs are counted");
+}
+
+void TestOversized(void)
+{
+    StubRasterizer raster;
+    FontAtlas atlas(std::ref(raster), 64, 1, 1);
+    const auto font = atlas.GetFont({"Arial", 16, 0, 0});
+
+    atlas.GetGlyph(font, 'a');
+    Check(atlas.GetGlyph(font, 'W') == nullptr, "glyph wider than a page fails");
+    Check(GetStats(atlas).Oversized == 1 && GetStats(atlas).Clears == 0 && atlas.GetGlyph(font, 'a') != nullptr, "oversized glyph is counted and leaves the atlas as is");
+    Check(atlas.GetGlyph(font, 'W') == nullptr && GetStats(atlas).Oversized == 2, "oversized glyph is not cached");
+
+    // A glyph exactly the page size, less the padding, still fits..
+    raster.Size = 63;
+    Check(atlas.GetGlyph(font, 'b') != nullptr && GetStats(atlas).Clears == 1, "page sized glyph fits a cleared page");
+    raster.Size = 64;
+    Check(atlas.GetGlyph(font, 'c') == nullptr && GetStats(atlas).Oversized == 3, "glyph and padding larger than a page fails");
+
+    raster.Size = 16;
+    Check(atlas.GetGlyph(font, '!') == nullptr && GetStats(atlas).Failed == 1, "bitmap missing its pixels fails");
+
+    const auto g = atlas.GetGlyph(font, ' ');
+    Check(g != nullptr && g->Width == 0 && g->Advance == 10.0f, "blank glyph keeps its metrics");
+}
+
+void TestBatch(void)
+{
+    StubRasterizer raster;
+    FontAtlas atlas(std::ref(raster), 64, 2, 0);
+    const auto font = atlas.GetFont({"Arial", 16, 0, 0});
+
+    GlyphBatch batch(&atlas);
+    const auto width = batch.AddText(font, 10.0f, 20.0f, "ab c\nd", 0xFFFFFFFF);
+    Check(width == 40.0f, "text width");
+    Check(batch.GetVertices().size() == 24 && batch.GetDraws().size() == 1 && batch.GetDraws()[0].Primitives == 8, "glyphs on one page share a draw");
+    Check(batch.GetVertices()[18].Y == 20.0f + 16.0f - 0.5f, "new lines move down a line");
+
+    // Fill the first page so the next glyphs land on the second page..
+    for (uint32_t cp = 0x100; cp < 0x10C; cp++)
+        atlas.GetGlyph(font, cp);
+    batch.AddText(font, 0.0f, 0.0f, "efa", 0xFFFFFFFF);
+    Check(batch.GetDraws().size() == 3 && batch.GetDraws()[1].Page == 1 && batch.GetDraws()[2].Page == 0, "page changes start a new draw");
+
+    Check(!batch.GetIsStale(), "batch is current");
+    atlas.Clear();
+    Check(batch.GetIsStale(), "clearing the atlas makes the batch stale");
+    batch.Clear();
+    Check(!batch.GetIsStale() && batch.GetVertices().empty(), "cleared batch is current");
+}
+
+void TestDecode(void)
+{
+    Check(Decode("\xE2\x82\xAC\xF0\x9F\x98\x80") == std::vector<uint32_t>{0x20AC, 0x1F600}, "multi-byte sequences");
+    Check(Decode("\xF8\x80") == std::vector<uint32_t>{0xFFFD, 0x80} && Decode("\xFF") == std::vector<uint32_t>{0xFFFD}, "invalid lead bytes decode as U+FFFD");
+    Check(Decode("\xF4\x90\x80\x80") == std::vector<uint32_t>{0xFFFD}, "sequences past U+10FFFF decode as U+FFFD");
+    Check(Decode("\xC3g\xE2\x82") == std::vector<uint32_t>{0xC3, 'g', 0xE2, 0x82}, "broken sequences decode as single bytes");
+}
+
+int main(void)
+{
+    TestPacker();
+    TestAtlas();
+    TestOversized();
+    TestBatch();
+    TestDecode();
+
+    std::printf("failures: %d\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
\ No newline at end of file
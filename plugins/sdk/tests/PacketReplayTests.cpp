@@ -0,0 +1,326 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Packet Replay Tests
+ *
+ * Tests the packet capture and replay (PacketCapture.h): a capture is written through PacketCaptureWriter, read
+ * back through the memory mapped PacketCaptureReader, then replayed through a plugin initialized against a
+ * stubbed core, followed by a plain handler. Damaged captures are also checked.
+ *
+ * Build: (From this directory.)
+ *
+ *      g++ -std=c++17 -O2 -pthread PacketReplayTests.cpp -o PacketReplayTests
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "../PacketCapture.h"
+
+using Ashita::PacketDirection;
+
+static int32_t g_Failures = 0;
+
+/**
+ * Reports the result of a check.
+ *
+ * @param {bool} passed - Flag if the check passed.
+ * @param {const char*} name - The name of the check.
+ */
+void Check(const bool passed, const char* name)
+{
+    std::printf("[%s] %s\n", passed ? " OK " : "FAIL", name);
+    if (!passed)
+        g_Failures++;
+}
+
+/**
+ * Stub Core
+ *
+ * Stands in for the Ashita core, holding the state the stub plugin reports into.
+ */
+struct StubCore
+{
+    uint32_t Incoming = 0; // The number of incoming packets seen by the plugin.
+    uint32_t Outgoing = 0; // The number of outgoing packets seen by the plugin.
+    uint32_t Blocked  = 0; // The number of packets that were already blocked when seen by the plugin.
+};
+
+/**
+ * Stub Plugin
+ *
+ * A minimal plugin, implementing only the packet handlers used by PacketReplay::AddPlugin. Incoming action
+ * packets (0x0028) are marked in the modified buffer, and outgoing actions (0x001A) are blocked.
+ */
+class StubPlugin
+{
+    StubCore* m_AshitaCore;
+    uint32_t m_PluginId;
+
+public:
+    StubPlugin(void)
+        : m_AshitaCore(nullptr)
+        , m_PluginId(0)
+    {}
+
+    bool Initialize(StubCore* core, const uint32_t id)
+    {
+        this->m_AshitaCore = core;
+        this->m_PluginId   = id;
+        return true;
+    }
+
+    bool HandleIncomingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked)
+    {
+        (void)data;
+        (void)sizeChunk;
+        (void)dataChunk;
+        (void)injected;
+
+        this->m_AshitaCore->Incoming++;
+        this->m_AshitaCore->Blocked += blocked ? 1 : 0;
+
+        if (id == 0x0028 && size > 4)
+            modified[4] = 0xAA;
+
+        return false;
+    }
+
+    bool HandleOutgoingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked)
+    {
+        (void)size;
+        (void)data;
+        (void)modified;
+        (void)sizeChunk;
+        (void)dataChunk;
+        (void)injected;
+
+        this->m_AshitaCore->Outgoing++;
+        this->m_AshitaCore->Blocked += blocked ? 1 : 0;
+
+        return id == 0x001A;
+    }
+};
+
+/**
+ * Packet Object
+ *
+ * A packet written to the test capture.
+ */
+struct packet_t
+{
+    PacketDirection Direction;
+    uint16_t Id;
+    std::vector<uint8_t> Data;
+    bool Injected;
+    bool Blocked;
+};
+
+/**
+ * Returns the packets written to the test capture.
+ */
+std::vector<packet_t> MakePackets(void)
+{
+    std::vector<packet_t> packets;
+
+    // Packet sizes include odd lengths, so the record padding is exercised..
+    packets.push_back({PacketDirection::Incoming, 0x000A, std::vector<uint8_t>(260, 0x0A), false, false});
+    packets.push_back({PacketDirection::Incoming, 0x0028, std::vector<uint8_t>(57, 0x28), false, false});
+    packets.push_back({PacketDirection::Outgoing, 0x0015, std::vector<uint8_t>(32, 0x15), false, false});
+    packets.push_back({PacketDirection::Outgoing, 0x001A, std::vector<uint8_t>(27, 0x1A), true, false});
+    packets.push_back({PacketDirection::Incoming, 0x0028, std::vector<uint8_t>(93, 0x28), false, true});
+    packets.push_back({PacketDirection::Incoming, 0x0017, std::vector<uint8_t>(), false, false});
+
+    for (auto& p : packets)
+    {
+        for (size_t x = 0; x < p.Data.size(); x++)
+            p.Data[x] = (uint8_t)(p.Data[x] + x);
+    }
+
+    return packets;
+}
+
+void TestWriteRead(const char* path, const std::vector<packet_t>& packets)
+{
+    Ashita::PacketCaptureWriter writer;
+    Check(writer.Open(path), "writer opens the capture");
+    for (const auto& p : packets)
+        writer.Write(p.Direction, p.Id, (uint32_t)p.Data.size(), p.Data.data(), p.Injected, p.Blocked);
+    writer.Close();
+    Check(!writer.IsOpen(), "writer closes the capture");
+
+    Ashita::PacketCaptureReader reader;
+    Check(reader.Open(path), "reader maps the capture");
+    Check(reader.GetHeader() != nullptr && std::memcmp(reader.GetHeader()->Magic, "APKT", 4) == 0 && reader.GetHeader()->Version == Ashita::PacketCapture::Version, "capture header is valid");
+
+    const Ashita::packetcapturerecord_t* record = nullptr;
+    const uint8_t* data                         = nullptr;
+
+    uint32_t count = 0;
+    auto matched   = true;
+    auto aligned   = true;
+    auto monotonic = true;
+    auto timestamp = (uint64_t)0;
+    while (reader.Next(&record, &data))
+    {
+        if (count < packets.size())
+        {
+            const auto& p = packets[count];
+            matched &= record->Id == p.Id && record->Size == p.Data.size() && record->Direction == (uint8_t)p.Direction && record->Sequence == count;
+            matched &= ((record->Flags & Ashita::PacketCapture::FlagInjected) != 0) == p.Injected && ((record->Flags & Ashita::PacketCapture::FlagBlocked) != 0) == p.Blocked;
+            matched &= p.Data.empty() || std::memcmp(data, p.Data.data(), p.Data.size()) == 0;
+        }
+
+        aligned &= (record->Length % Ashita::PacketCapture::RecordAlign) == 0;
+        monotonic &= record->Timestamp >= timestamp;
+        timestamp = record->Timestamp;
+        count++;
+    }
+
+    Check(count == packets.size(), "reader returns every record");
+    Check(matched, "records match the written packets");
+    Check(aligned, "records are padded to the record alignment");
+    Check(monotonic, "record timestamps never go backwards");
+
+    reader.Rewind();
+    Check(reader.Next(&record, nullptr) && record->Sequence == 0, "rewind returns to the first record");
+}
+
+void TestReplay(const char* path, const std::vector<packet_t>& packets)
+{
+    constexpr uint32_t Iterations = 3;
+
+    StubCore core;
+    StubPlugin plugin;
+    plugin.Initialize(&core, 1);
+
+    uint32_t incoming = 0;
+    uint32_t blocked  = 0;
+    uint32_t marked   = 0;
+    uint32_t original = 0;
+
+    Ashita::PacketReplay replay;
+    replay.AddPlugin("stub", &plugin);
+    replay.AddHandler(
+        "handler",
+        [&](uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t, const uint8_t*, bool, bool isBlocked) {
+            incoming++;
+            blocked += isBlocked ? 1 : 0;
+            if (id == 0x0028 && size > 4)
+            {
+                marked += modified[4] == 0xAA ? 1 : 0;
+                original += data[4] != 0xAA ? 1 : 0;
+            }
+            return false;
+        },
+        [&](uint16_t, uint32_t, const uint8_t*, uint8_t*, uint32_t, const uint8_t*, bool, bool isBlocked) {
+            blocked += isBlocked ? 1 : 0;
+            return false;
+        });
+
+    Ashita::PacketCaptureReader reader;
+    reader.Open(path);
+
+    const auto count = replay.Run(reader, Iterations);
+
+    uint32_t in      = 0;
+    uint32_t out     = 0;
+    uint32_t action  = 0;
+    uint32_t flagged = 0;
+    for (const auto& p : packets)
+    {
+        (p.Direction == PacketDirection::Incoming ? in : out)++;
+        action += p.Id == 0x0028 ? 1 : 0;
+        flagged += p.Blocked ? 1 : 0;
+    }
+
+    Check(count == packets.size() * Iterations, "replay dispatches every record of every iteration");
+    Check(core.Incoming == in * Iterations && core.Outgoing == out * Iterations, "plugin sees every packet in its direction");
+    Check(incoming == in * Iterations, "handler sees every incoming packet");
+    Check(marked == action * Iterations && original == action * Iterations, "handler sees the plugin's changes in the modified buffer only");
+    Check(core.Blocked == flagged * Iterations, "plugin sees packets blocked in the capture as blocked");
+    Check(blocked == (flagged + 1) * Iterations, "handler sees packets blocked by the plugin as blocked");
+
+    const auto hist0 = replay.GetHistogram(0);
+    const auto hist1 = replay.GetHistogram(1);
+    Check(hist0 != nullptr && hist0->GetCount() == packets.size() * Iterations, "plugin handler timings are recorded");
+    Check(hist1 != nullptr && hist1->GetCount() == packets.size() * Iterations, "handler timings are recorded");
+    Check(replay.GetHistogram(2) == nullptr, "invalid handler has no histogram");
+
+    std::printf("%s", replay.GetReport().c_str());
+}
+
+void TestDamaged(const char* path)
+{
+    std::vector<uint8_t> file;
+    {
+        std::ifstream stream(path, std::ios::binary);
+        file.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    Ashita::PacketCaptureReader reader;
+    Check(!reader.Open("PacketReplayTests.missing"), "missing capture is rejected");
+
+    // Truncate the capture in the middle of the second record..
+    const auto first = (size_t)((const Ashita::packetcaptureheader_t*)file.data())->Size + ((const Ashita::packetcapturerecord_t*)(file.data() + sizeof(Ashita::packetcaptureheader_t)))->Length;
+    Check(reader.Open(file.data(), first + 16), "truncated capture opens");
+
+    uint32_t count = 0;
+    while (reader.Next(nullptr, nullptr))
+        count++;
+    Check(count == 1, "truncated record is not returned");
+
+    // Damage the length of the first record..
+    auto damaged = file;
+    ((Ashita::packetcapturerecord_t*)(damaged.data() + sizeof(Ashita::packetcaptureheader_t)))->Length = 8;
+    Check(reader.Open(damaged.data(), damaged.size()) && !reader.Next(nullptr, nullptr), "record shorter than its header is rejected");
+
+    auto magic = file;
+    magic[0]   = 'X';
+    Check(!reader.Open(magic.data(), magic.size()), "capture with a bad magic is rejected");
+    Check(!reader.Open(file.data(), sizeof(Ashita::packetcaptureheader_t) - 1), "capture shorter than its header is rejected");
+
+    {
+        std::ofstream empty("PacketReplayTests.empty", std::ios::binary | std::ios::trunc);
+    }
+    Check(!reader.Open("PacketReplayTests.empty"), "empty capture is rejected");
+    std::remove("PacketReplayTests.empty");
+}
+
+int main(void)
+{
+    const auto path    = "PacketReplayTests.apkt";
+    const auto packets = MakePackets();
+
+    TestWriteRead(path, packets);
+    TestReplay(path, packets);
+    TestDamaged(path);
+
+    std::remove(path);
+
+    std::printf("failures: %d\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Packet Schema Tests
+ *
+ * Tests the packet schema decoder (PacketSchema.h) against the bytes of an incoming 0x0028 action packet (a
+ * melee round of two hits, the second answered by spikes), and against damaged copies of it whose counts would
+ * otherwise have the decoder produce elements that read nothing.
+ *
+ * Build: (From this directory.)
+ *
+ *      g++ -std=c++17 -O2 PacketSchemaTests.cpp -o PacketSchemaTests
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+#include "../PacketSchema.h"
+
+using Ashita::DecodedPacket;
+using Ashita::PacketDirection;
+using Ashita::PacketSchema;
+
+static int32_t g_Failures = 0;
+
+/**
+ * Reports the result of a check.
+ *
+ * @param {bool} passed - Flag if the check passed.
+ * @param {const char*} name - The name of the check.
+ */
+void Check(const bool passed, const char* name)
+{
+    std::printf("[%s] %s\n", passed ? " OK " : "FAIL", name);
+    if (!passed)
+        g_Failures++;
+}
+
+// Incoming 0x0028 packet; actor 0x0100A1B2 hits 0x010C3004 for 37 and 41 damage, taking 44 damage from spikes..
+static const std::vector<uint8_t> ActionPacket = {
+    0x28, 0x0D, 0x3C, 0x12, 0x00, 0xB2, 0xA1, 0x00, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x0C, 0x43, 0x80, 0x04, 0x00, 0x80, 0xA0, 0x04, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x40, 0x90, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x00,
+    0x2C, 0x00, 0x00, 0x00,
+};
+
+/**
+ * Declares the layout of the 0x0028 action packet.
+ *
+ * @param {PacketSchema&} schema - The schema to declare into.
+ */
+void DeclareAction(PacketSchema& schema)
+{
+    schema.Seek(5)
+        .Field("actor", 32)
+        .Field("target_count", 6)
+        .Field("result", 4)
+        .Field("category", 4)
+        .Field("param", 32)
+        .Field("recast", 32)
+        .BeginArray("targets", "target_count")
+            .Field("id", 32)
+            .Field("result_count", 4)
+            .BeginArray("results", "result_count")
+                .Field("miss", 3)
+                .Field("kind", 2)
+                .Field("sub_kind", 12)
+                .Field("info", 5)
+                .Field("scale", 5)
+                .Field("param", 17)
+                .Field("message", 10)
+                .Field("bit", 31)
+                .Field("has_proc", 1)
+                .BeginIf("has_proc")
+                    .Field("proc_kind", 6)
+                    .Field("proc_info", 4)
+                    .Field("proc_param", 17)
+                    .Field("proc_message", 10)
+                .EndIf()
+                .Field("has_react", 1)
+                .BeginIf("has_react")
+                    .Field("react_kind", 6)
+                    .Field("react_info", 4)
+                    .Field("react_param", 14)
+                    .Field("react_message", 10)
+                .EndIf()
+            .EndArray()
+        .EndArray();
+}
+
+void TestDecode(void)
+{
+    PacketSchema schema(0x0028, PacketDirection::Incoming);
+    DeclareAction(schema);
+    Check(schema.Compile(), "action schema compiles");
+
+    DecodedPacket packet;
+    Check(schema.Decode(ActionPacket.data(), (uint32_t)ActionPacket.size(), &packet), "action packet decodes");
+    Check(packet.Get("actor") == 0x0100A1B2 && packet.Get("category") == 1, "actor and category");
+
+    const auto root    = packet.GetRoot();
+    const auto targets = schema.Find("targets");
+    const auto results = schema.Find("targets.results");
+    Check(root.GetCount(targets) == 1, "target count");
+
+    const auto target = root.GetElement(targets, 0);
+    Check(target.Get(schema.Find("targets.id")) == 0x010C3004 && target.GetCount(results) == 2, "target id and result count");
+
+    const auto hit1 = target.GetElement(results, 0);
+    const auto hit2 = target.GetElement(results, 1);
+    Check(hit1.Get(schema.Find("targets.results.param")) == 37 && hit1.Get(schema.Find("targets.results.has_react")) == 0, "first result");
+    Check(hit2.Get(schema.Find("targets.results.param")) == 41 && hit2.Get(schema.Find("targets.results.message")) == 1, "second result");
+    Check(hit2.Get(schema.Find("targets.results.react_param")) == 6 && hit2.Get(schema.Find("targets.results.react_message")) == 44, "second result reaction");
+    Check(!target.GetElement(results, 2).IsValid(), "out of range result");
+
+    // Truncate the packet inside the last result..
+    Check(!schema.Decode(ActionPacket.data(), 40, &packet), "truncated packet is rejected");
+}
+
+void TestHostileCounts(void)
+{
+    PacketSchema schema(0x0028, PacketDirection::Incoming);
+    DeclareAction(schema);
+    schema.Compile();
+
+    // Raise the target count to the largest 6bit value; the packet ends long before 63 targets are read..
+    auto data = ActionPacket;
+    data[9] |= 0xFC;
+    DecodedPacket packet;
+    Check(!schema.Decode(data.data(), (uint32_t)data.size(), &packet), "target count past the packet end is rejected");
+
+    // A count larger than the bits remaining is rejected before any element is decoded..
+    PacketSchema counted(0x0100, PacketDirection::Incoming);
+    counted.Seek(4).Field("count", 32).BeginArray("items", "count").Field("value", 1).EndArray();
+    Check(counted.Compile(), "counted schema compiles");
+
+    std::vector<uint8_t> items = {0x00, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00};
+    Check(!counted.Decode(items.data(), (uint32_t)items.size(), &packet), "count larger than the bits remaining is rejected");
+    Check(packet.GetSlotCount() <= counted.GetScopeSize(0), "rejected count allocates no elements");
+
+    items[4] = 32;
+    items[5] = items[6] = items[7] = 0;
+    Check(counted.Decode(items.data(), (uint32_t)items.size(), &packet) && packet.GetRoot().GetCount(counted.Find("items")) == 32, "count equal to the bits remaining decodes");
+
+    // Elements that seek back and read the same bits do not advance the reader..
+    PacketSchema rewind(0x0101, PacketDirection::Incoming);
+    rewind.Seek(4).Field("count", 8).BeginArray("items", "count").Seek(4).Field("value", 8).EndArray();
+    Check(rewind.Compile(), "rewinding schema compiles");
+
+    std::vector<uint8_t> loop = {0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00};
+    Check(!rewind.Decode(loop.data(), (uint32_t)loop.size(), &packet), "counted elements that consume no bits are rejected");
+
+    // Fixed count arrays are declared by the schema and are not bounded..
+    PacketSchema fixed(0x0102, PacketDirection::Incoming);
+    fixed.Seek(4).BeginArray("items", 3).Seek(4).Field("value", 8).EndArray();
+    Check(fixed.Compile(), "fixed schema compiles");
+    Check(fixed.Decode(loop.data(), (uint32_t)loop.size(), &packet) && packet.GetRoot().GetCount(fixed.Find("items")) == 3, "fixed count elements may reread bits");
+}
+
+int main(void)
+{
+    TestDecode();
+    TestHostileCounts();
+
+    std::printf("failures: %d\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Pattern Scanner Benchmark
+ *
+ * Compares the compiled pattern scanner (Pattern.h) against the previous std::search based scanner used by
+ * Memory::FindPattern, over a synthetic module image. Each pattern is scanned for with both scanners and the
+ * results are compared, so the benchmark doubles as a differential test.
+ *
+ * Build: (From this directory.)
+ *
+ *      g++ -std=c++17 -O2 -msse2 PatternBenchmark.cpp -o PatternBenchmark
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../Pattern.h"
+
+namespace Previous
+{
+    /**
+     * The previous Memory::FindPattern implementation, kept as the benchmark baseline.
+     */
+    uintptr_t FindPattern(const uintptr_t baseAddress, const uintptr_t size, const char* pattern, const intptr_t offset, const uintptr_t count)
+    {
+        if (baseAddress == 0 || size == 0)
+            return 0;
+
+        const auto len = strlen(pattern);
+        if (len == 0 || len % 2 > 0)
+            return 0;
+
+        std::vector<std::pair<uint8_t, bool>> vpattern;
+        for (size_t x = 0, y = len / 2; x < y; x++)
+        {
+            const auto str = std::string(pattern + (x * 2), 2);
+            if (str == "??")
+                vpattern.push_back(std::make_pair((uint8_t)0, false));
+            else
+                vpattern.push_back(std::make_pair((uint8_t)strtol(str.c_str(), nullptr, 16), true));
+        }
+
+        const auto begin = (const uint8_t*)baseAddress;
+        const auto end   = begin + size;
+        auto scanStart   = begin;
+        auto result      = (uintptr_t)0;
+
+        while (true)
+        {
+            auto ret = std::search(scanStart, end, vpattern.begin(), vpattern.end(), [](const uint8_t curr, const std::pair<uint8_t, bool> currPattern) {
+                return !currPattern.second || curr == currPattern.first;
+            });
+
+            if (ret == end)
+                break;
+
+            if (result == count || count == 0)
+                return (uintptr_t)(ret - begin) + baseAddress + offset;
+
+            ++result;
+            scanStart = ++ret;
+        }
+
+        return 0;
+    }
+} // namespace Previous
+
+/**
+ * Returns the elapsed time of the given function, in milliseconds.
+ */
+template<typename T>
+double Measure(T&& func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(void)
+{
+    constexpr size_t ImageSize    = 16 * 1024 * 1024;
+    constexpr size_t PatternCount = 64;
+
+    std::mt19937 rng(0x41534954);
+
+    // Build an image whose byte distribution roughly follows x86 code; half of the bytes are common opcodes..
+    static constexpr uint8_t common[] = {0x00, 0xFF, 0x8B, 0x24, 0x44, 0x89, 0x01, 0xE8, 0x04, 0x83, 0x08, 0x10, 0x0F, 0x85, 0xC0, 0x74};
+    std::vector<uint8_t> image(ImageSize);
+    for (auto& b : image)
+        b = (rng() & 1) ? common[rng() % sizeof(common)] : (uint8_t)rng();
+
+    // Take the patterns from the back half of the image, wildcarding some bytes..
+    std::vector<std::string> patterns;
+    for (size_t x = 0; x < PatternCount; x++)
+    {
+        const auto len = 12 + (rng() % 20);
+        const auto pos = (ImageSize / 2) + (rng() % (ImageSize / 2 - len));
+
+        std::string pattern;
+        for (size_t y = 0; y < len; y++)
+        {
+            char buf[3]{};
+            if (y > 0 && (rng() % 5) == 0)
+                std::strcpy(buf, "??");
+            else
+                std::snprintf(buf, sizeof(buf), "%02X", image[pos + y]);
+            pattern += buf;
+        }
+        patterns.push_back(pattern);
+    }
+
+    const auto base = (uintptr_t)image.data();
+
+    // Scan with the previous scanner..
+    std::vector<uintptr_t> previous(PatternCount, 0);
+    const auto previousTime = Measure([&]() {
+        for (size_t x = 0; x < PatternCount; x++)
+            previous[x] = Previous::FindPattern(base, ImageSize, patterns[x].c_str(), 0, 0);
+    });
+
+    // Scan with the compiled scanner, one pattern at a time. (Memory::FindPattern.)
+    std::vector<Ashita::compiledpattern_t> compiled(PatternCount);
+    std::vector<uintptr_t> single(PatternCount, 0);
+    const auto singleTime = Measure([&]() {
+        for (size_t x = 0; x < PatternCount; x++)
+        {
+            Ashita::PatternScanner::Compile(patterns[x].c_str(), 0, 0, &compiled[x]);
+            single[x] = Ashita::PatternScanner::Scan(base, ImageSize, compiled[x]);
+        }
+    });
+
+    // Scan with the compiled scanner, all patterns in a single pass. (Memory::FindPatterns.)
+    std::vector<uintptr_t> batch(PatternCount, 0);
+    const auto batchTime = Measure([&]() {
+        Ashita::PatternScanner::ScanBatch(base, ImageSize, compiled.data(), compiled.size(), batch.data());
+    });
+
+    auto mismatches = 0;
+    for (size_t x = 0; x < PatternCount; x++)
+    {
+        if (previous[x] != single[x] || previous[x] != batch[x] || previous[x] == 0)
+            mismatches++;
+    }
+
+    const auto mb = (double)ImageSize / (1024.0 * 1024.0);
+    std::printf("image: %.0f MB, patterns: %zu\n", mb, PatternCount);
+    std::printf("previous (std::search)  : %9.2f ms (%8.1f MB/s per pattern)\n", previousTime, mb * PatternCount / (previousTime / 1000.0));
+    std::printf("compiled (per pattern)  : %9.2f ms (%8.1f MB/s per pattern)\n", singleTime, mb * PatternCount / (singleTime / 1000.0));
+    std::printf("compiled (batch)        : %9.2f ms (%8.1f MB/s per pattern)\n", batchTime, mb * PatternCount / (batchTime / 1000.0));
+    std::printf("mismatches: %d\n", mismatches);
+
+    return mismatches == 0 ? 0 : 1;
+}
\ No newline at end of file
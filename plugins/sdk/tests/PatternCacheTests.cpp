@@ -0,0 +1,258 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Pattern Cache Tests
+ *
+ * Tests the pattern cache (PatternCache.h) over a synthetic module image: cached lookups, verification of the
+ * cached bytes and of Count-th matches, identity changes, and saving and loading the cache file, including a
+ * damaged file.
+ *
+ * Build: (From this directory.)
+ *
+ *      g++ -std=c++17 -O2 -msse2 PatternCacheTests.cpp -o PatternCacheTests
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "../PatternCache.h"
+
+static int32_t g_Failures = 0;
+
+/**
+ * Reports the result of a check.
+ *
+ * @param {bool} passed - Flag if the check passed.
+ * @param {const char*} name - The name of the check.
+ */
+void Check(const bool passed, const char* name)
+{
+    std::printf("[%s] %s\n", passed ? " OK " : "FAIL", name);
+    if (!passed)
+        g_Failures++;
+}
+
+/**
+ * Synthetic Module
+ *
+ * A block of random bytes with the test patterns placed at known offsets.
+ */
+struct module_t
+{
+    std::vector<uint8_t> Data;
+
+    uintptr_t Base(void) const
+    {
+        return (uintptr_t)this->Data.data();
+    }
+    uintptr_t Size(void) const
+    {
+        return (uintptr_t)this->Data.size();
+    }
+    void Place(const size_t offset, const std::vector<uint8_t>& bytes)
+    {
+        std::memcpy(this->Data.data() + offset, bytes.data(), bytes.size());
+    }
+};
+
+// The bytes matched by the test patterns..
+static const std::vector<uint8_t> UniqueBytes   = {0x8B, 0x0D, 0x11, 0x22, 0x33, 0x44, 0x85, 0xC9, 0x74, 0x1F};
+static const std::vector<uint8_t> RepeatedBytes = {0xA1, 0x55, 0x66, 0x77, 0x88, 0xC3, 0xCC, 0xCC};
+
+constexpr auto UniquePattern   = "8B0D????????85C9741F";
+constexpr auto RepeatedPattern = "A1????????C3CCCC";
+
+/**
+ * Returns a synthetic module with the unique pattern placed once and the repeated pattern placed three times.
+ */
+module_t MakeModule(void)
+{
+    module_t mod;
+    mod.Data.resize(256 * 1024);
+
+    // Random bytes, avoiding the first byte of each pattern so the only matches are the placed ones..
+    std::mt19937 rng(0x41534954);
+    for (auto& b : mod.Data)
+    {
+        do
+        {
+            b = (uint8_t)rng();
+        } while (b == 0x8B || b == 0xA1);
+    }
+
+    mod.Place(0x12340, UniqueBytes);
+    mod.Place(0x01000, RepeatedBytes);
+    mod.Place(0x08000, RepeatedBytes);
+    mod.Place(0x20000, RepeatedBytes);
+
+    return mod;
+}
+
+void TestResolve(void)
+{
+    auto mod = MakeModule();
+    Ashita::PatternCache cache;
+    cache.SetModuleIdentity("Test.dll", {mod.Size(), 1, 2});
+
+    bool cached = true;
+    auto result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), UniquePattern, 2, 0, &cached);
+    Check(result == mod.Base() + 0x12340 + 2 && !cached, "first resolve scans");
+    Check(cache.GetIsDirty(), "first resolve stores the result");
+
+    result = cache.Resolve("test.DLL", mod.Base(), mod.Size(), UniquePattern, 2, 0, &cached);
+    Check(result == mod.Base() + 0x12340 + 2 && cached, "second resolve uses the cache, ignoring the module name case");
+
+    // Move the pattern; the cached bytes no longer match..
+    std::memset(mod.Data.data() + 0x12340, 0, UniqueBytes.size());
+    mod.Place(0x30000, UniqueBytes);
+    result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), UniquePattern, 2, 0, &cached);
+    Check(result == mod.Base() + 0x30000 + 2 && !cached, "changed bytes at the cached address fall back to a scan");
+
+    // Remove the pattern; the stale entry is dropped..
+    std::memset(mod.Data.data() + 0x30000, 0, UniqueBytes.size());
+    result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), UniquePattern, 2, 0, &cached);
+    Check(result == 0 && !cached, "missing pattern is not found");
+
+    uintptr_t found = 0;
+    Ashita::compiledpattern_t cpattern;
+    Ashita::PatternScanner::Compile(UniquePattern, 2, 0, &cpattern);
+    Check(!cache.Lookup("Test.dll", mod.Base(), mod.Size(), UniquePattern, cpattern, &found), "missing pattern removes the cached entry");
+}
+
+void TestCount(void)
+{
+    auto mod = MakeModule();
+    Ashita::PatternCache cache;
+    cache.SetModuleIdentity("Test.dll", {mod.Size(), 1, 2});
+
+    bool cached = true;
+    auto result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), RepeatedPattern, 1, 1, &cached);
+    Check(result == mod.Base() + 0x08000 + 1 && !cached, "count selects the later match");
+
+    result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), RepeatedPattern, 1, 1, &cached);
+    Check(result == mod.Base() + 0x08000 + 1 && cached, "counted match is reused while it is still the count-th match");
+
+    // Add a match before the cached one; the cached bytes still match, but it is no longer the count-th match..
+    mod.Place(0x00400, RepeatedBytes);
+    result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), RepeatedPattern, 1, 1, &cached);
+    Check(result == mod.Base() + 0x01000 + 1 && !cached, "earlier match invalidates the counted match");
+
+    // Remove the earlier matches; the cached address is no longer reached by the count..
+    std::memset(mod.Data.data() + 0x00400, 0, RepeatedBytes.size());
+    std::memset(mod.Data.data() + 0x08000, 0, RepeatedBytes.size());
+    result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), RepeatedPattern, 1, 1, &cached);
+    Check(result == mod.Base() + 0x20000 + 1 && !cached, "removed match invalidates the counted match");
+
+    result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), RepeatedPattern, 1, 0, &cached);
+    Check(result == mod.Base() + 0x01000 + 1 && !cached, "count is part of the cache key");
+}
+
+void TestIdentity(void)
+{
+    auto mod = MakeModule();
+    Ashita::PatternCache cache;
+    cache.SetModuleIdentity("Test.dll", {mod.Size(), 1, 2});
+
+    bool cached = false;
+    cache.Resolve("Test.dll", mod.Base(), mod.Size(), UniquePattern, 0, 0, &cached);
+
+    cache.SetModuleIdentity("Test.dll", {mod.Size(), 1, 2});
+    cache.Resolve("Test.dll", mod.Base(), mod.Size(), UniquePattern, 0, 0, &cached);
+    Check(cached, "same identity keeps the cached entries");
+
+    cache.SetModuleIdentity("Test.dll", {mod.Size(), 1, 3});
+    cache.Resolve("Test.dll", mod.Base(), mod.Size(), UniquePattern, 0, 0, &cached);
+    Check(!cached, "changed identity discards the cached entries");
+
+    const auto hash = Ashita::PatternCache::Hash(mod.Data.data(), mod.Data.size());
+    const auto part = Ashita::PatternCache::Hash(mod.Data.data() + 100, mod.Data.size() - 100, Ashita::PatternCache::Hash(mod.Data.data(), 100));
+    Check(hash == part, "hash can be computed over multiple blocks");
+
+    mod.Data[0x10] ^= 1;
+    Check(hash != Ashita::PatternCache::Hash(mod.Data.data(), mod.Data.size()), "hash changes with the section bytes");
+}
+
+void TestSaveLoad(void)
+{
+    const auto path = "PatternCacheTests.cache";
+
+    auto mod = MakeModule();
+    {
+        Ashita::PatternCache cache;
+        cache.SetModuleIdentity("Test.dll", {mod.Size(), 1, 2});
+        cache.Resolve("Test.dll", mod.Base(), mod.Size(), UniquePattern, 2, 0);
+        cache.Resolve("Test.dll", mod.Base(), mod.Size(), RepeatedPattern, 1, 2);
+        Check(cache.Save(path) && !cache.GetIsDirty(), "cache saves");
+    }
+
+    Ashita::PatternCache cache;
+    Check(cache.Load(path) && !cache.GetIsDirty(), "cache loads");
+
+    cache.SetModuleIdentity("Test.dll", {mod.Size(), 1, 2});
+
+    bool cached = false;
+    auto result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), UniquePattern, 2, 0, &cached);
+    Check(result == mod.Base() + 0x12340 + 2 && cached, "loaded entry is used");
+    result = cache.Resolve("Test.dll", mod.Base(), mod.Size(), RepeatedPattern, 1, 2, &cached);
+    Check(result == mod.Base() + 0x20000 + 1 && cached, "loaded counted entry is used");
+
+    // Truncate the file in the middle of the entries..
+    std::vector<char> file;
+    {
+        std::ifstream f(path, std::ios::binary);
+        file.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+        f.write(file.data(), (std::streamsize)(file.size() - 6));
+    }
+
+    Check(!cache.Load(path), "truncated cache is rejected");
+    cache.SetModuleIdentity("Test.dll", {mod.Size(), 1, 2});
+    cache.Resolve("Test.dll", mod.Base(), mod.Size(), UniquePattern, 2, 0, &cached);
+    Check(!cached, "truncated cache leaves no entries");
+
+    // Damage the magic..
+    file[0] = 'X';
+    {
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+        f.write(file.data(), (std::streamsize)file.size());
+    }
+    Check(!cache.Load(path), "cache with a bad magic is rejected");
+
+    std::remove(path);
+}
+
+int main(void)
+{
+    TestResolve();
+    TestCount();
+    TestIdentity();
+    TestSaveLoad();
+
+    std::printf("failures: %d\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
\ No newline at end of file
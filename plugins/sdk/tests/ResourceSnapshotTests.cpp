@@ -0,0 +1,284 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Resource Snapshot Tests
+ *
+ * Tests the resource snapshot files (ResourceSnapshot.h): writing a snapshot and reading its tables back in
+ * place, checking it against its source files, and rejecting truncated, damaged and inconsistent files.
+ *
+ * Build: (From this directory.)
+ *
+ *      g++ -std=c++17 -O2 ResourceSnapshotTests.cpp -o ResourceSnapshotTests
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../ResourceSnapshot.h"
+
+using Ashita::ResourceSnapshotReader;
+using Ashita::ResourceSnapshotWriter;
+
+static int32_t g_Failures = 0;
+
+constexpr auto SnapshotPath = "ResourceSnapshotTests.snapshot";
+constexpr auto DamagedPath  = "ResourceSnapshotTests.damaged";
+constexpr auto SourcePath1  = "ResourceSnapshotTests.1.dat";
+constexpr auto SourcePath2  = "ResourceSnapshotTests.2.dat";
+constexpr uint64_t Key      = 0x0123456789ABCDEF;
+
+/**
+ * Reports the result of a check.
+ *
+ * @param {bool} passed - Flag if the check passed.
+ * @param {const char*} name - The name of the check.
+ */
+void Check(const bool passed, const char* name)
+{
+    std::printf("[%s] %s\n", passed ? " OK " : "FAIL", name);
+    if (!passed)
+        g_Failures++;
+}
+
+/**
+ * Reads a whole file.
+ *
+ * @param {const char*} path - The path to the file.
+ * @return {std::vector<uint8_t>} The file contents.
+ */
+std::vector<uint8_t> ReadFile(const char* path)
+{
+    std::ifstream f(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+/**
+ * Writes a whole file.
+ *
+ * @param {const char*} path - The path to the file.
+ * @param {const std::vector<uint8_t>&} data - The file contents.
+ */
+void WriteFile(const char* path, const std::vector<uint8_t>& data)
+{
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    f.write((const char*)data.data(), (std::streamsize)data.size());
+}
+
+/**
+ * Stub Resource Manager
+ *
+ * Resolves the file ids of the test source files, in place of IResourceManager.
+ */
+struct StubResources
+{
+    uint32_t GetFilePath(const uint32_t fileId, char* buffer, const uint32_t bufferSize) const
+    {
+        return (uint32_t)std::snprintf(buffer, bufferSize, "%s", fileId == 1 ? SourcePath1 : fileId == 2 ? SourcePath2 : "");
+    }
+};
+
+/**
+ * Writes the source files and the snapshot built from them.
+ *
+ * @return {bool} True on success, false otherwise.
+ */
+bool WriteSnapshot(void)
+{
+    WriteFile(SourcePath1, std::vector<uint8_t>(4096, 0x11));
+    WriteFile(SourcePath2, std::vector<uint8_t>(1000, 0x22));
+
+    ResourceSnapshotWriter writer;
+    writer.SetKey(Key);
+    if (!writer.AddSource(1, SourcePath1) || !writer.AddSource(2, SourcePath2))
+        return false;
+
+    // Items are merged from two tables with the same name..
+    const auto items = writer.AddTable("items", Ashita::ResourceSnapshot::TypeItem);
+    const uint32_t item1[] = {1, 2, 3};
+    const uint32_t item2[] = {4, 5, 6, 7, 8};
+    writer.AddEntry(items, 20, item2, sizeof(item2));
+    writer.AddEntry(items, 10, item1, sizeof(item1));
+    writer.AddEntry(writer.AddTable("items", Ashita::ResourceSnapshot::TypeItem), 15, nullptr, 0);
+
+    const auto strings = writer.AddTable("d_msg", Ashita::ResourceSnapshot::TypeString);
+    writer.AddString(strings, 3, "Ashita");
+    writer.AddString(strings, 1, "old");
+    writer.AddString(strings, 1, "Vana'diel");
+    writer.AddEntry(strings, 2, "abc", 3);
+
+    return writer.Write(SnapshotPath);
+}
+
+void TestRoundTrip(void)
+{
+    Check(WriteSnapshot(), "snapshot is written");
+
+    ResourceSnapshotReader reader;
+    Check(reader.Open(SnapshotPath), "snapshot opens");
+    Check(reader.GetHeader() != nullptr && reader.GetHeader()->TableCount == 2 && reader.GetHeader()->Key == Key, "header");
+
+    uint32_t count = 0;
+    const auto sources = reader.GetSources(&count);
+    Check(count == 2 && sources[0].FileId == 1 && sources[0].Size == 4096 && sources[1].FileId == 2 && sources[1].Size == 1000, "sources");
+
+    const auto items = reader.GetTable("items");
+    Check(items != nullptr && items->Count == 3 && items->Type == Ashita::ResourceSnapshot::TypeItem, "merged table");
+
+    const auto entries = reader.GetEntries(items);
+    Check(entries != nullptr && entries[0].Id == 10 && entries[1].Id == 15 && entries[2].Id == 20, "entries are ordered by id");
+
+    uint32_t size = 0;
+    auto data     = reader.Find(items, 20, &size);
+    Check(data != nullptr && size == 20 && ((const uint32_t*)data)[4] == 8, "entry data");
+    Check(((uintptr_t)data % Ashita::ResourceSnapshot::Align) == 0, "entry data is aligned");
+
+    data = reader.Find(items, 15, &size);
+    Check(data != nullptr && size == 0, "empty entry");
+    Check(reader.Find(items, 11, &size) == nullptr && reader.Find(items, 99, &size) == nullptr, "missing entries");
+
+    const auto strings = reader.GetTable("d_msg");
+    Check(strings != nullptr && std::strcmp(reader.FindString(strings, 3), "Ashita") == 0, "string entry");
+    Check(strings != nullptr && std::strcmp(reader.FindString(strings, 1), "Vana'diel") == 0, "duplicate id keeps the last entry");
+    Check(strings != nullptr && reader.FindString(strings, 2) == nullptr, "unterminated entry is not returned as a string");
+    Check(reader.GetTable("missing") == nullptr, "missing table");
+}
+
+void TestIsCurrent(void)
+{
+    WriteSnapshot();
+
+    StubResources resources;
+    const auto resolve = [](const uint32_t fileId) {
+        return std::string(fileId == 1 ? SourcePath1 : SourcePath2);
+    };
+
+    ResourceSnapshotReader reader;
+    reader.Open(SnapshotPath);
+    Check(reader.IsCurrent(Key, &resources), "snapshot is current");
+    Check(reader.IsCurrent(Key, resolve), "snapshot is current, resolving paths with a function");
+    Check(!reader.IsCurrent(Key + 1, &resources), "changed key");
+
+    // Same size, different contents..
+    auto source = ReadFile(SourcePath2);
+    source[500] ^= 0xFF;
+    WriteFile(SourcePath2, source);
+    Check(!reader.IsCurrent(Key, &resources), "changed source contents");
+
+    source.push_back(0);
+    WriteFile(SourcePath2, source);
+    Check(!reader.IsCurrent(Key, &resources), "changed source size");
+
+    std::remove(SourcePath2);
+    Check(!reader.IsCurrent(Key, &resources), "missing source");
+}
+
+/**
+ * Writes a damaged copy of the snapshot and returns if it was opened.
+ *
+ * @param {const std::vector<uint8_t>&} data - The damaged snapshot contents.
+ * @return {bool} True if the reader opened the damaged snapshot, false otherwise.
+ */
+bool OpenDamaged(const std::vector<uint8_t>& data)
+{
+    WriteFile(DamagedPath, data);
+
+    ResourceSnapshotReader reader;
+    const auto ret = reader.Open(DamagedPath);
+    reader.Close();
+    return ret;
+}
+
+void TestDamaged(void)
+{
+    WriteSnapshot();
+
+    const auto file = ReadFile(SnapshotPath);
+    Check(OpenDamaged(file), "undamaged copy opens");
+
+    const auto header = (const Ashita::resourcesnapshotheader_t*)file.data();
+    const auto table  = header->TableOffset;
+    const auto index  = ((const Ashita::resourcesnapshottable_t*)(file.data() + table))->IndexOffset;
+
+    auto data = file;
+    data.resize(data.size() - 8);
+    Check(!OpenDamaged(data), "truncated file is rejected");
+
+    data = file;
+    data.push_back(0);
+    Check(!OpenDamaged(data), "file with trailing data is rejected");
+
+    Check(!OpenDamaged(std::vector<uint8_t>(file.begin(), file.begin() + 20)), "file shorter than the header is rejected");
+
+    data    = file;
+    data[0] = 'X';
+    Check(!OpenDamaged(data), "bad magic is rejected");
+
+    data    = file;
+    data[4] = 2;
+    Check(!OpenDamaged(data), "other version is rejected");
+
+    // Point the table count past the end of the file..
+    data = file;
+    ((Ashita::resourcesnapshotheader_t*)data.data())->TableCount = 0x10000;
+    Check(!OpenDamaged(data), "table count past the file end is rejected");
+
+    data = file;
+    ((Ashita::resourcesnapshottable_t*)(data.data() + table))->IndexOffset += 4;
+    Check(!OpenDamaged(data), "misaligned index is rejected");
+
+    data = file;
+    ((Ashita::resourcesnapshottable_t*)(data.data() + table))->DataSize = file.size();
+    Check(!OpenDamaged(data), "table data past the file end is rejected");
+
+    data = file;
+    std::memset(((Ashita::resourcesnapshottable_t*)(data.data() + table))->Name, 'A', sizeof(Ashita::resourcesnapshottable_t::Name));
+    Check(!OpenDamaged(data), "unterminated table name is rejected");
+
+    data = file;
+    ((Ashita::resourcesnapshotentry_t*)(data.data() + index))[2].Offset = 0x1000;
+    Check(!OpenDamaged(data), "entry past the table data is rejected");
+
+    data = file;
+    ((Ashita::resourcesnapshotentry_t*)(data.data() + index))[1].Id = 10;
+    Check(!OpenDamaged(data), "unordered entry ids are rejected");
+
+    std::remove(DamagedPath);
+}
+
+int main(void)
+{
+    TestRoundTrip();
+    TestIsCurrent();
+    TestDamaged();
+
+    std::remove(SnapshotPath);
+    std::remove(SourcePath1);
+    std::remove(SourcePath2);
+
+    std::printf("failures: %d\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
\ No newline at end of file
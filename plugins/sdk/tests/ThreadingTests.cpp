@@ -0,0 +1,299 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * Threading Tests
+ *
+ * Tests the task pool (Threading.h): continuations, exceptions, tasks waiting on the tasks they submit, priority
+ * ordering, move-only tasks and draining on destruction. Then compares the throughput of small tasks submitted
+ * to the pool against std::async.
+ *
+ * Build: (From this directory.)
+ *
+ *      g++ -std=c++17 -O2 -pthread ThreadingTests.cpp -o ThreadingTests
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../Threading.h"
+
+using Ashita::Threading::Future;
+using Ashita::Threading::TaskPool;
+using Ashita::Threading::ThreadPriority;
+
+static int32_t g_Failures = 0;
+
+/**
+ * Reports the result of a check.
+ *
+ * @param {bool} passed - Flag if the check passed.
+ * @param {const char*} name - The name of the check.
+ */
+void Check(const bool passed, const char* name)
+{
+    std::printf("[%s] %s\n", passed ? " OK " : "FAIL", name);
+    if (!passed)
+        g_Failures++;
+}
+
+/**
+ * Returns the elapsed time of the given function, in milliseconds.
+ */
+template<typename T>
+double Measure(T&& func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Computes a fibonacci number by submitting one half of each step to the pool and waiting on it, nesting waits
+ * far deeper than the number of workers.
+ *
+ * @param {TaskPool&} pool - The task pool.
+ * @param {int32_t} n - The fibonacci number to compute.
+ * @return {int64_t} The fibonacci number.
+ */
+int64_t Fibonacci(TaskPool& pool, const int32_t n)
+{
+    if (n < 16)
+    {
+        int64_t a = 0, b = 1;
+        for (auto x = 0; x < n; x++)
+        {
+            const auto t = a + b;
+            a            = b;
+            b            = t;
+        }
+        return a;
+    }
+
+    auto f = pool.Submit([&pool, n]() {
+        return Fibonacci(pool, n - 1);
+    });
+    const auto b = Fibonacci(pool, n - 2);
+    return f.Get() + b;
+}
+
+void TestContinuations(void)
+{
+    TaskPool pool(4);
+
+    auto a = pool.Submit([]() {
+        return 21;
+    });
+    auto b = a.Then([](Future<int32_t> f) {
+        return f.Get() * 2;
+    });
+    Check(b.Get() == 42, "continuation receives the task value");
+
+    auto c = pool.Submit([]() -> int32_t {
+        throw std::runtime_error("failed");
+    });
+    auto d = c.Then([](Future<int32_t> f) {
+        try
+        {
+            f.Get();
+            return false;
+        }
+        catch (const std::runtime_error&)
+        {
+            return true;
+        }
+    });
+    Check(d.Get(), "continuation observes the task exception");
+
+    auto thrown = false;
+    try
+    {
+        c.Get();
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    Check(thrown, "Get rethrows the task exception");
+
+    auto e = pool.Submit([]() {
+        return 1;
+    });
+    e.Wait();
+    Check(e.Then([](Future<int32_t> f) { return f.Get() + 1; }).Get() == 2, "continuation of a completed task runs");
+
+    auto chain = pool.Submit([]() {
+        return 0;
+    });
+    for (auto x = 0; x < 1000; x++)
+    {
+        chain = chain.Then([](Future<int32_t> f) {
+            return f.Get() + 1;
+        });
+    }
+    Check(chain.Get() == 1000, "long continuation chain completes");
+}
+
+void TestNestedWaits(void)
+{
+    TaskPool pool(2);
+    Check(Fibonacci(pool, 27) == 196418, "nested waits on a 2 thread pool complete");
+
+    TaskPool single(1);
+    auto f = single.Submit([&single]() {
+        auto inner = single.Submit([]() {
+            return 7;
+        });
+        return inner.Get() * 6;
+    });
+    Check(f.Get() == 42, "nested wait on a 1 thread pool completes");
+}
+
+void TestPriorities(void)
+{
+    // Block the only worker, queue one task per priority, then release it..
+    TaskPool pool(1);
+
+    std::atomic<bool> release(false);
+    auto gate = pool.Submit([&release]() {
+        while (!release)
+            std::this_thread::yield();
+    });
+
+    std::mutex mutex;
+    std::vector<int32_t> order;
+    std::vector<Future<void>> tasks;
+    for (auto x = (int32_t)ThreadPriority::Lowest; x <= (int32_t)ThreadPriority::Highest; x++)
+    {
+        tasks.push_back(pool.Submit([&mutex, &order, x]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(x);
+        }, (ThreadPriority)x));
+    }
+
+    release = true;
+    for (auto& t : tasks)
+        t.Wait();
+
+    Check(order == std::vector<int32_t>({2, 1, 0, -1, -2}), "higher priority tasks run first");
+}
+
+void TestMoveOnly(void)
+{
+    TaskPool pool(2);
+
+    auto value = std::make_unique<int32_t>(42);
+    auto a     = pool.Submit([v = std::move(value)]() {
+        return *v;
+    });
+    Check(a.Get() == 42, "move-only task runs");
+
+    auto promise = std::promise<int32_t>();
+    auto result  = promise.get_future();
+    auto b       = a.Then([p = std::move(promise)](Future<int32_t> f) mutable {
+        p.set_value(f.Get() + 1);
+    });
+    b.Wait();
+    Check(result.get() == 43, "move-only continuation runs");
+}
+
+void TestShutdown(void)
+{
+    std::atomic<int32_t> count(0);
+    {
+        TaskPool pool(2);
+        for (auto x = 0; x < 10000; x++)
+        {
+            pool.Submit([&count]() {
+                count++;
+            });
+        }
+    }
+    Check(count == 10000, "destroying the pool runs every queued task");
+}
+
+void BenchmarkThroughput(void)
+{
+    constexpr int32_t TaskCount = 20000;
+
+    const auto work = [](const int32_t x) {
+        auto v = (uint64_t)x;
+        for (auto y = 0; y < 256; y++)
+            v = v * 6364136223846793005ull + 1442695040888963407ull;
+        return v;
+    };
+
+    uint64_t sum0 = 0;
+    uint64_t sum1 = 0;
+
+    TaskPool pool;
+
+    const auto t0 = Measure([&]() {
+        std::vector<std::future<uint64_t>> futures;
+        futures.reserve(TaskCount);
+        for (auto x = 0; x < TaskCount; x++)
+            futures.push_back(std::async(std::launch::async, work, x));
+        for (auto& f : futures)
+            sum0 += f.get();
+    });
+    const auto t1 = Measure([&]() {
+        std::vector<Future<uint64_t>> futures;
+        futures.reserve(TaskCount);
+        for (auto x = 0; x < TaskCount; x++)
+        {
+            futures.push_back(pool.Submit([&work, x]() {
+                return work(x);
+            }));
+        }
+        for (auto& f : futures)
+            sum1 += f.Get();
+    });
+
+    Check(sum0 == sum1, "pool and std::async results match");
+    std::printf("%d tasks  std::async: %8.2f ms  TaskPool (%u threads): %8.2f ms  %5.2fx\n", TaskCount, t0, pool.GetThreadCount(), t1, t0 / t1);
+
+    const auto t2 = Measure([&]() {
+        sum1 = (uint64_t)Fibonacci(pool, 30);
+    });
+    std::printf("nested fibonacci(30): %8.2f ms\n", t2);
+}
+
+int main(void)
+{
+    TestContinuations();
+    TestNestedWaits();
+    TestPriorities();
+    TestMoveOnly();
+    TestShutdown();
+    BenchmarkThroughput();
+
+    std::printf("failures: %d\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+/**
+ * Ashita SDK - Copyright (c) 2025 Ashita Development Team
+ * Contact: https://www.ashitaxi.com/
+ * Contact: https://discord.gg/Ashita
+ *
+ * This file is part of Ashita.
+ *
+ * Ashita is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Ashita is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Ashita.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Trace Recorder Tests
+ *
+ * Tests the trace recorder (TraceRecorder.h): name registration, reading spans back in order, wrapping of the
+ * ring buffer, reading while other threads record (every span read must be one that was recorded whole), and
+ * the Chrome trace JSON export.
+ *
+ * Build: (From this directory.)
+ *
+ *      g++ -std=c++17 -O2 -pthread TraceRecorderTests.cpp -o TraceRecorderTests
+ */
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../TraceRecorder.h"
+
+using Ashita::TraceRecorder;
+using Ashita::traceevent_t;
+
+static int32_t g_Failures = 0;
+
+/**
+ * Reports the result of a check.
+ *
+ * @param {bool} passed - Flag if the check passed.
+ * @param {const char*} name - The name of the check.
+ */
+void Check(const bool passed, const char* name)
+{
+    std::printf("[%s] %s\n", passed ? " OK " : "FAIL", name);
+    if (!passed)
+        g_Failures++;
+}
+
+/**
+ * Returns the number of times the given string appears within another.
+ *
+ * @param {const std::string&} str - The string to search.
+ * @param {const char*} find - The string to count.
+ * @return {size_t} The number of occurrences.
+ */
+size_t CountOf(const std::string& str, const char* find)
+{
+    size_t count = 0;
+    for (auto pos = str.find(find); pos != std::string::npos; pos = str.find(find, pos + 1))
+        count++;
+    return count;
+}
+
+void TestRegister(void)
+{
+    TraceRecorder recorder(16);
+    Check(recorder.GetCapacity() == 1024, "capacity is rounded up to the minimum");
+    Check(TraceRecorder(3000).GetCapacity() == 4096, "capacity is rounded up to a power of two");
+
+    Check(recorder.Register("HandleIncomingPacket") == TraceRecorder::EventIncomingPacket, "plugin callbacks are registered by default");
+    Check(recorder.Register("Direct3DPresent") == TraceRecorder::EventPresent, "last default name id");
+
+    const auto id = recorder.Register("custom", "addon");
+    Check(id == TraceRecorder::EventPresent + 1 && recorder.Register("custom") == id, "names are registered once");
+    Check(recorder.Register(nullptr) == TraceRecorder::InvalidName, "null name is rejected");
+}
+
+void TestRecordRead(void)
+{
+    TraceRecorder recorder(1024);
+
+    // Record out of start order; spans are read back sorted by start..
+    recorder.Record(TraceRecorder::EventCommand, 3000, 3500);
+    recorder.Record(TraceRecorder::EventIncomingPacket, 1000, 1250, 0x0028);
+    recorder.Record(TraceRecorder::EventPresent, 2000, 1900);
+
+    std::vector<traceevent_t> events;
+    recorder.Read(0, &events);
+    Check(events.size() == 3, "recorded spans are read back");
+    Check(events.size() == 3 && events[0].Start == 1000 && events[1].Start == 2000 && events[2].Start == 3000, "spans are ordered by start");
+    Check(events.size() == 3 && events[0].Duration == 250 && events[0].Arg == 0x0028 && events[0].Name == TraceRecorder::EventIncomingPacket, "span fields");
+    Check(events.size() == 3 && events[1].Duration == 0 && events[1].Arg == TraceRecorder::NoArg, "span ending before its start has no duration");
+    Check(events.size() == 3 && events[0].Thread == TraceRecorder::GetThreadId(), "span thread id");
+
+    recorder.Read(2000, &events);
+    Check(events.size() == 2 && events[0].Start == 2000, "spans ending before the given time are skipped");
+
+    recorder.SetEnabled(false);
+    recorder.Record(TraceRecorder::EventCommand, 4000, 4100);
+    recorder.SetEnabled(true);
+    Check(recorder.GetRecordedCount() == 3, "disabled recorder records nothing");
+}
+
+void TestWrap(void)
+{
+    TraceRecorder recorder(1024);
+
+    for (uint64_t x = 0; x < 2500; x++)
+        recorder.Record(TraceRecorder::EventEndScene, x * 10, x * 10 + 5, x);
+
+    std::vector<traceevent_t> events;
+    recorder.Read(0, &events);
+    Check(recorder.GetRecordedCount() == 2500, "recorded count includes overwritten spans");
+    Check(events.size() == 1024, "ring buffer keeps its capacity of spans");
+    Check(events.size() == 1024 && events.front().Arg == 2500 - 1024 && events.back().Arg == 2499, "ring buffer keeps the newest spans");
+}
+
+void TestConcurrent(void)
+{
+    TraceRecorder recorder(1024);
+
+    constexpr uint32_t Writers = 4;
+    constexpr uint64_t Spans   = 200000;
+
+    std::atomic<uint32_t> running(Writers);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < Writers; t++)
+    {
+        threads.emplace_back([&recorder, &running, t]() {
+            for (uint64_t x = 1; x <= Spans; x++)
+            {
+                // Every field is derived from the start, so a span mixing two writes is detectable..
+                const auto start = (x << 8) | t;
+                recorder.Record(t, start, start + (start & 0xFFFF), start * 3);
+            }
+            running--;
+        });
+    }
+
+    uint64_t reads = 0;
+    uint64_t torn  = 0;
+    std::vector<traceevent_t> events;
+    while (running.load() != 0 || reads == 0)
+    {
+        recorder.Read(0, &events);
+        for (const auto& e : events)
+        {
+            if (e.Duration != (e.Start & 0xFFFF) || e.Arg != e.Start * 3 || e.Name != (e.Start & 0xFF))
+                torn++;
+        }
+        reads++;
+    }
+
+    for (auto& t : threads)
+        t.join();
+
+    recorder.Read(0, &events);
+    std::printf("       %" PRIu64 " reads while recording\n", reads);
+    Check(torn == 0, "spans read while recording are never torn");
+    Check(recorder.GetRecordedCount() == Writers * Spans && events.size() == 1024, "every span is counted once recording ends");
+}
+
+void TestChromeTrace(void)
+{
+    TraceRecorder recorder(1024);
+    const auto quoted = recorder.Register("say \"hi\"\\\n", "addon");
+
+    const auto now = TraceRecorder::Now();
+    recorder.Record(TraceRecorder::EventIncomingPacket, now - 2000000, now - 1500000, 0x00DF);
+    recorder.Record(quoted, now - 1000000, now - 999500);
+    recorder.Record(250, now - 500000, now - 400000);
+    recorder.Record(TraceRecorder::EventCommand, now - 30000000000ull, now - 29000000000ull);
+
+    const auto json = recorder.GetChromeTrace(5.0);
+    Check(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0 && json.size() > 4 && json.compare(json.size() - 4, 4, "\n]}\n") == 0, "trace is a JSON object with an event array");
+    Check(CountOf(json, "\"ph\":\"X\"") == 3, "spans older than the range are left out");
+    Check(json.find("{\"name\":\"HandleIncomingPacket\",\"cat\":\"packet\",\"ph\":\"X\",\"pid\":1,") != std::string::npos, "span name and category");
+    Check(json.find(",\"args\":{\"arg\":223}}") != std::string::npos, "span argument");
+    Check(json.find("\"name\":\"say \\\"hi\\\"\\\\\\u000a\",\"cat\":\"addon\"") != std::string::npos, "names are escaped");
+    Check(json.find("\"name\":\"unknown\",\"cat\":\"plugin\"") != std::string::npos, "unregistered name ids are exported as unknown");
+    Check(json.find("\"dur\":500.000") != std::string::npos, "durations are exported in microseconds");
+    Check(CountOf(json, "{") == CountOf(json, "}") && CountOf(json, "[") == CountOf(json, "]"), "trace brackets are balanced");
+
+    const auto empty = TraceRecorder(1024).GetChromeTrace(5.0);
+    Check(empty == "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n]}\n", "empty trace");
+
+    const auto path = "TraceRecorderTests.json";
+    Check(recorder.WriteChromeTrace(path, 5.0), "trace file is written");
+
+    std::ifstream file(path, std::ios::binary);
+    const std::string read((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    Check(CountOf(read, "\"ph\":\"X\"") == 3, "trace file holds the spans");
+    std::remove(path);
+}
+
+int main(void)
+{
+    TestRegister();
+    TestRecordRead();
+    TestWrap();
+    TestConcurrent();
+    TestChromeTrace();
+
+    std::printf("failures: %d\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
\ No newline at end of file